@@ -0,0 +1,792 @@
+/*
+  Filter speed benchmark
+
+  Pushes a fixed amount of audio through each filter and reports the speed
+  in machine-readable form, so results of different builds and releases can
+  be compared:
+
+    bench [options] [name...]
+
+    -t <seconds>   audio length per test (default 10)
+    -c <samples>   input chunk size (default 4096)
+    -f <format>    report format: text, csv or json (default text)
+    -o <file>      write the report to the file instead of stdout
+    --tag <text>   build label included into the report (release name, etc)
+    --file <file>  also benchmark the decoder for the compressed file
+                   (AC3, DTS, MPA); may be given several times
+    --no-simd      disable SIMD code (see set_cpu_features_mask())
+    name...        run only tests whose names start with one of the names
+
+  Input is made by generators (NoiseGen) and by AC3Enc for the parser test,
+  output goes to NullSink. Only Filter::process() and Filter::flush() calls
+  are timed (wall-clock time), input generation is not.
+
+  FFT/<n> tests measure the FFT throughput for lengths 64..65536: pairs of
+  forward and inverse transforms (with the input copy) are done on
+  seconds * 1M points. Samples are the transform points processed.
+
+  Report fields:
+    name          test name
+    input         input format
+    output        output format
+    samples       number of samples processed (per channel). Input samples
+                  are counted for linear and PCM input, output samples for
+                  compressed input.
+    sec           processing time
+    samples_per_sec, ns_per_sample
+    realtime      audio duration / processing time
+    allocs        number of heap allocations (operator new) during the
+                  processing
+    alloc_bytes   size of memory allocated with operator new during the
+                  processing
+    open_allocs   number of operator new allocations made by open()
+    pool_allocs   number of buffer allocations (pool_alloc(), including the
+                  blocks of arenas) during the processing
+    pool_bytes    size of buffers allocated during the processing
+    open_pool_allocs  number of buffer allocations made by open()
+
+  Buffers (AutoBuf, SampleBuf) take memory from the buffer pool and do not
+  use operator new, so they are counted by pool_* fields only.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <new>
+#include <vector>
+
+#include "buffer.h"
+#include "mem_pool.h"
+#include "cpu.h"
+#include "rng.h"
+#include "filter.h"
+#include "dsp/fft.h"
+#include "fir/param_fir.h"
+#include "filters/agc.h"
+#include "filters/bass_redir.h"
+#include "filters/convert.h"
+#include "filters/convolver.h"
+#include "filters/delay.h"
+#include "filters/dither.h"
+#include "filters/drc.h"
+#include "filters/gain.h"
+#include "filters/levels.h"
+#include "filters/mixer.h"
+#include "filters/resample.h"
+#include "parsers/ac3/ac3_enc.h"
+#include "parsers/ac3/ac3_parser.h"
+#include "parsers/dts/dts_parser.h"
+#include "parsers/mpa/mpa_parser.h"
+#include "parsers/uni/uni_frame_parser.h"
+#include "sink/sink_null.h"
+#include "source/file_parser.h"
+#include "source/generator.h"
+
+static const int seed = 8273465;
+
+///////////////////////////////////////////////////////////////////////////////
+// Allocation counter
+// Global operator new counts allocations while counting is on. Buffer
+// allocations are counted by the pool (see pool_stat()).
+
+static bool     alloc_counting = false;
+static uint64_t alloc_count = 0;
+static uint64_t alloc_bytes = 0;
+static uint64_t pool_alloc_count = 0;
+static uint64_t pool_alloc_bytes = 0;
+static PoolStat pool_start;
+
+static void *counted_alloc(size_t size)
+{
+  if (alloc_counting)
+  {
+    alloc_count++;
+    alloc_bytes += size;
+  }
+  void *ptr = malloc(size? size: 1);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void *operator new(size_t size) { return counted_alloc(size); }
+void *operator new[](size_t size) { return counted_alloc(size); }
+void operator delete(void *ptr) throw() { free(ptr); }
+void operator delete[](void *ptr) throw() { free(ptr); }
+
+static void start_alloc_count()
+{
+  alloc_count = 0;
+  alloc_bytes = 0;
+  pool_alloc_count = 0;
+  pool_alloc_bytes = 0;
+  pool_start = pool_stat();
+  alloc_counting = true;
+}
+
+static void stop_alloc_count()
+{
+  if (!alloc_counting)
+    return;
+
+  alloc_counting = false;
+  PoolStat stat = pool_stat();
+  pool_alloc_count = stat.allocs - pool_start.allocs;
+  pool_alloc_bytes = stat.bytes - pool_start.bytes;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// FrameList
+// Compressed frames stored in memory, one frame per chunk.
+
+class FrameList : public Source
+{
+protected:
+  Speakers spk;
+  Rawdata data;
+  size_t data_size;
+  std::vector<size_t> frames; // frame start positions, last is the end
+  size_t pos;
+
+public:
+  FrameList(): data_size(0), pos(0)
+  {}
+
+  void init(Speakers spk_)
+  {
+    spk = spk_;
+    data_size = 0;
+    frames.clear();
+    frames.push_back(0);
+    pos = 0;
+  }
+
+  void add_frame(const uint8_t *frame, size_t size)
+  {
+    if (data_size + size > data.size())
+      data.reallocate(MAX(data_size + size, data.size() * 2));
+    memcpy(data.begin() + data_size, frame, size);
+    data_size += size;
+    frames.push_back(data_size);
+  }
+
+  size_t nframes() const
+  { return frames.size() - 1; }
+
+  /////////////////////////////////////////////////////////
+  // Source interface
+
+  virtual bool get_chunk(Chunk &out)
+  {
+    if (pos >= nframes())
+      return false;
+    out.set_rawdata(data.begin() + frames[pos], frames[pos + 1] - frames[pos]);
+    pos++;
+    return true;
+  }
+
+  virtual void reset()
+  { pos = 0; }
+
+  virtual bool new_stream() const
+  { return false; }
+
+  virtual Speakers get_output() const
+  { return spk; }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Test cases
+
+struct Result
+{
+  string   name;
+  Speakers in_spk;
+  Speakers out_spk;
+  uint64_t samples;
+  vtime_t  time;
+  uint64_t allocs;
+  uint64_t alloc_bytes;
+  uint64_t open_allocs;
+  uint64_t pool_allocs;
+  uint64_t pool_bytes;
+  uint64_t open_pool_allocs;
+
+  double samples_per_sec() const { return time > 0? samples / time: 0; }
+  double ns_per_sample() const { return samples > 0? time * 1e9 / samples: 0; }
+  double realtime() const
+  {
+    int sample_rate = in_spk.is_linear() || in_spk.is_pcm()? in_spk.sample_rate: out_spk.sample_rate;
+    return time > 0 && sample_rate > 0? samples / time / sample_rate: 0;
+  }
+};
+
+struct Options
+{
+  double seconds;
+  size_t chunk_size;
+  std::vector<string> names;
+
+  bool match(const string &name) const
+  {
+    if (names.empty())
+      return true;
+    for (size_t i = 0; i < names.size(); i++)
+      if (name.compare(0, names[i].size(), names[i]) == 0)
+        return true;
+    return false;
+  }
+};
+
+static uint64_t count_samples(Speakers spk, const Chunk &chunk)
+{
+  if (spk.is_linear())
+    return chunk.size;
+  if (spk.is_pcm() && spk.nch() > 0)
+    return chunk.size / (spk.sample_size() * spk.nch());
+  return 0;
+}
+
+// Run the source through the filter into NullSink.
+// Returns false when the filter cannot be opened or fails.
+static bool run(const string &name, Filter *filter, Source *src, Result &result)
+{
+  Speakers spk = src->get_output();
+  bool count_input = spk.is_linear() || spk.is_pcm();
+  NullSink sink;
+  CPUMeter cpu;
+  Chunk in, out;
+
+  result.name = name;
+  result.in_spk = spk;
+  result.out_spk = spk_unknown;
+  result.samples = 0;
+  result.time = 0;
+  result.allocs = 0;
+  result.alloc_bytes = 0;
+  result.open_allocs = 0;
+  result.pool_allocs = 0;
+  result.pool_bytes = 0;
+  result.open_pool_allocs = 0;
+
+  start_alloc_count();
+  bool opened = filter->open(spk);
+  stop_alloc_count();
+  result.open_allocs = alloc_count;
+  result.open_pool_allocs = pool_alloc_count;
+  if (!opened)
+    return false;
+
+  uint64_t allocs = 0, bytes = 0;
+  uint64_t pool_allocs = 0, pool_bytes = 0;
+  try
+  {
+    bool more = true;
+    while (more)
+    {
+      more = src->get_chunk(in);
+      if (count_input && more)
+        result.samples += count_samples(spk, in);
+
+      cpu.start();
+      start_alloc_count();
+      while (more? filter->process(in, out): filter->flush(out))
+      {
+        if (filter->new_stream() || !sink.is_open())
+          sink.open(filter->get_output());
+        if (!count_input)
+          result.samples += count_samples(filter->get_output(), out);
+        sink.process(out);
+      }
+      stop_alloc_count();
+      cpu.stop();
+
+      allocs += alloc_count;
+      bytes += alloc_bytes;
+      pool_allocs += pool_alloc_count;
+      pool_bytes += pool_alloc_bytes;
+    }
+  }
+  catch (...)
+  {
+    stop_alloc_count();
+    return false;
+  }
+
+  result.out_spk = filter->get_output();
+  result.time = cpu.get_system_time();
+  result.allocs = allocs;
+  result.alloc_bytes = bytes;
+  result.pool_allocs = pool_allocs;
+  result.pool_bytes = pool_bytes;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Filter factories
+
+typedef Filter *(*create_t)();
+
+static const ParamFIR low_pass(ParamFIR::low_pass, 0.25, 0, 0.01, 100, true);
+
+static Filter *new_mixer_stereo()
+{
+  Mixer *f = new Mixer(4096);
+  f->set_output(Speakers(FORMAT_LINEAR, MODE_STEREO, 0));
+  return f;
+}
+
+static Filter *new_mixer_5_1()
+{
+  Mixer *f = new Mixer(4096);
+  f->set_output(Speakers(FORMAT_LINEAR, MODE_5_1, 0));
+  return f;
+}
+
+static Filter *new_resample_48k() { return new Resample(48000); }
+static Filter *new_resample_44k() { return new Resample(44100); }
+static Filter *new_convolver() { return new Convolver(&low_pass); }
+static Filter *new_gain() { return new Gain(0.5); }
+static Filter *new_dither() { return new Dither(1.0 / 32768); }
+static Filter *new_levels() { return new Levels(); }
+
+static Filter *new_bass_redir()
+{
+  BassRedir *f = new BassRedir();
+  f->set_enabled(true);
+  return f;
+}
+
+static Filter *new_agc()
+{
+  AGC *f = new AGC();
+  f->auto_gain = true;
+  f->normalize = false;
+  return f;
+}
+
+static Filter *new_drc()
+{
+  DRC *f = new DRC();
+  f->drc = true;
+  f->drc_power = 6;
+  return f;
+}
+
+static Filter *new_delay()
+{
+  float delays[CH_NAMES];
+  for (int ch = 0; ch < CH_NAMES; ch++)
+    delays[ch] = float(ch + 1);
+
+  Delay *f = new Delay();
+  f->set_units(DELAY_MS);
+  f->set_delays(delays);
+  f->set_enabled(true);
+  return f;
+}
+
+template <int format> static Filter *new_converter()
+{
+  Converter *f = new Converter(4096);
+  f->set_format(format);
+  return f;
+}
+
+static Filter *new_ac3enc()
+{
+  AC3Enc *f = new AC3Enc();
+  f->set_bitrate(448000);
+  return f;
+}
+
+static Filter *new_ac3parser() { return new AC3Parser(); }
+static Filter *new_dtsparser() { return new DTSParser(); }
+static Filter *new_mpaparser() { return new MPAParser(); }
+
+///////////////////////////////////////////////////////////////////////////////
+// Test table
+// Each filter is tested with all input formats listed.
+
+struct Test
+{
+  const char *name;
+  create_t create;
+  int format;
+  int modes[4];     // zero-terminated list of channel modes
+  int sample_rate;
+};
+
+static const Test tests[] =
+{
+  { "Mixer>2.0",    new_mixer_stereo, FORMAT_LINEAR, { MODE_5_1, MODE_7_1 }, 48000 },
+  { "Mixer>5.1",    new_mixer_5_1,    FORMAT_LINEAR, { MODE_STEREO }, 48000 },
+  { "Resample>48k", new_resample_48k, FORMAT_LINEAR, { MODE_MONO, MODE_STEREO, MODE_5_1 }, 44100 },
+  { "Resample>44k", new_resample_44k, FORMAT_LINEAR, { MODE_MONO, MODE_STEREO, MODE_5_1 }, 48000 },
+  { "Convolver",    new_convolver,    FORMAT_LINEAR, { MODE_MONO, MODE_STEREO, MODE_5_1 }, 48000 },
+  { "AGC",          new_agc,          FORMAT_LINEAR, { MODE_MONO, MODE_STEREO, MODE_5_1 }, 48000 },
+  { "DRC",          new_drc,          FORMAT_LINEAR, { MODE_MONO, MODE_STEREO, MODE_5_1 }, 48000 },
+  { "Delay",        new_delay,        FORMAT_LINEAR, { MODE_MONO, MODE_STEREO, MODE_5_1 }, 48000 },
+  { "Gain",         new_gain,         FORMAT_LINEAR, { MODE_MONO, MODE_STEREO, MODE_5_1 }, 48000 },
+  { "BassRedir",    new_bass_redir,   FORMAT_LINEAR, { MODE_5_1, MODE_7_1 }, 48000 },
+  { "Dither",       new_dither,       FORMAT_LINEAR, { MODE_MONO, MODE_STEREO, MODE_5_1 }, 48000 },
+  { "Levels",       new_levels,       FORMAT_LINEAR, { MODE_MONO, MODE_STEREO, MODE_5_1 }, 48000 },
+  { "Converter>PCM16",    new_converter<FORMAT_PCM16>,    FORMAT_LINEAR, { MODE_MONO, MODE_STEREO, MODE_5_1 }, 48000 },
+  { "Converter>PCM24",    new_converter<FORMAT_PCM24>,    FORMAT_LINEAR, { MODE_MONO, MODE_STEREO, MODE_5_1 }, 48000 },
+  { "Converter>PCMFLOAT", new_converter<FORMAT_PCMFLOAT>, FORMAT_LINEAR, { MODE_MONO, MODE_STEREO, MODE_5_1 }, 48000 },
+  { "Converter>Linear",   new_converter<FORMAT_LINEAR>,   FORMAT_PCM16,  { MODE_MONO, MODE_STEREO, MODE_5_1 }, 48000 },
+  { "Converter>Linear",   new_converter<FORMAT_LINEAR>,   FORMAT_PCM24,  { MODE_STEREO, MODE_5_1 }, 48000 },
+  { "AC3Enc",       new_ac3enc,       FORMAT_LINEAR, { MODE_STEREO, MODE_5_1 }, 48000 },
+};
+
+static bool run_test(const Test &test, int mode, const Options &opt, Result &result)
+{
+  Speakers spk(test.format, mode, test.sample_rate);
+  uint64_t nsamples = uint64_t(opt.seconds * spk.sample_rate);
+  NoiseGen gen;
+  if (spk.is_linear())
+    gen.init(spk, seed, nsamples, opt.chunk_size);
+  else
+  {
+    size_t frame_size = spk.sample_size() * spk.nch();
+    gen.init(spk, seed, nsamples * frame_size, opt.chunk_size * frame_size);
+  }
+
+  Filter *filter = test.create();
+  bool ok = run(test.name, filter, &gen, result);
+  delete filter;
+  return ok;
+}
+
+// Encode noise with AC3Enc into the frame list
+static bool encode_ac3(int mode, const Options &opt, FrameList &frames)
+{
+  Speakers spk(FORMAT_LINEAR, mode, 48000);
+  NoiseGen gen(spk, seed, uint64_t(opt.seconds * spk.sample_rate), opt.chunk_size);
+  AC3Enc enc;
+  enc.set_bitrate(448000);
+  if (!enc.open(spk))
+    return false;
+
+  Chunk in, out;
+  frames.init(enc.get_output());
+  while (gen.get_chunk(in))
+    while (enc.process(in, out))
+      frames.add_frame(out.rawdata, out.size);
+  while (enc.flush(out))
+    frames.add_frame(out.rawdata, out.size);
+  return frames.nframes() > 0;
+}
+
+// Load all frames of the file
+static bool load_file(const char *filename, FrameList &frames)
+{
+  UniFrameParser frame_parser;
+  FileParser f;
+  if (!f.open_probe(filename, &frame_parser))
+    return false;
+
+  Chunk chunk;
+  frames.init(f.get_output());
+  while (f.get_chunk(chunk))
+    if (chunk.size)
+      frames.add_frame(chunk.rawdata, chunk.size);
+  return frames.nframes() > 0;
+}
+
+// Decoders for compressed files
+static const struct { int format; const char *name; create_t create; } decoders[] =
+{
+  { FORMAT_AC3, "AC3Parser", new_ac3parser },
+  { FORMAT_DTS, "DTSParser", new_dtsparser },
+  { FORMAT_MPA, "MPAParser", new_mpaparser },
+};
+
+// Forward and inverse transforms of noise
+static bool run_fft(unsigned len, const Options &opt, Result &result)
+{
+  char name[32];
+  sprintf(name, "FFT/%u", len);
+  result.name = name;
+  result.in_spk = spk_unknown;
+  result.out_spk = spk_unknown;
+  result.samples = 0;
+  result.time = 0;
+  result.allocs = 0;
+  result.alloc_bytes = 0;
+  result.open_allocs = 0;
+  result.pool_allocs = 0;
+  result.pool_bytes = 0;
+  result.open_pool_allocs = 0;
+
+  start_alloc_count();
+  FFT fft(len);
+  stop_alloc_count();
+  result.open_allocs = alloc_count;
+  result.open_pool_allocs = pool_alloc_count;
+
+  Samples in(len), buf(len);
+  RNG(seed).fill_samples(in, len);
+
+  uint64_t iterations = uint64_t(opt.seconds * 1e6 / len) + 1;
+  CPUMeter cpu;
+  cpu.start();
+  start_alloc_count();
+  for (uint64_t i = 0; i < iterations; i++)
+  {
+    copy_samples(buf, in, len);
+    fft.rdft(buf);
+    fft.inv_rdft(buf);
+  }
+  stop_alloc_count();
+  cpu.stop();
+
+  result.samples = iterations * len;
+  result.time = cpu.get_system_time();
+  result.allocs = alloc_count;
+  result.alloc_bytes = alloc_bytes;
+  result.pool_allocs = pool_alloc_count;
+  result.pool_bytes = pool_alloc_bytes;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Report
+
+static string cpu_features_text()
+{
+  static const struct { int feature; const char *name; } names[] =
+  {
+    { cpu_sse2, "sse2" }, { cpu_ssse3, "ssse3" }, { cpu_sse41, "sse4.1" }, { cpu_pclmul, "pclmul" }
+  };
+
+  string result;
+  int features = cpu_features();
+  for (int i = 0; i < array_size(names); i++)
+    if (features & names[i].feature)
+    {
+      if (!result.empty()) result += " ";
+      result += names[i].name;
+    }
+  return result;
+}
+
+static string json_string(const string &s)
+{
+  string result = "\"";
+  for (size_t i = 0; i < s.size(); i++)
+  {
+    if (s[i] == '"' || s[i] == '\\')
+      result += '\\';
+    if ((unsigned char)s[i] >= 0x20)
+      result += s[i];
+  }
+  return result + "\"";
+}
+
+static void report(FILE *f, const char *format, const string &tag, const Options &opt, const std::vector<Result> &results)
+{
+  char date[64];
+  time_t now = time(0);
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+  const char *sample = sizeof(sample_t) == sizeof(float)? "float": "double";
+  string features = cpu_features_text();
+
+  if (strcmp(format, "json") == 0)
+  {
+    fprintf(f, "{\n");
+    fprintf(f, "  \"tag\": %s,\n", json_string(tag).c_str());
+    fprintf(f, "  \"date\": \"%s\",\n", date);
+    fprintf(f, "  \"sample\": \"%s\",\n", sample);
+    fprintf(f, "  \"cpu_features\": \"%s\",\n", features.c_str());
+    fprintf(f, "  \"seconds\": %g,\n", opt.seconds);
+    fprintf(f, "  \"chunk_size\": %u,\n", (unsigned)opt.chunk_size);
+    fprintf(f, "  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+      const Result &r = results[i];
+      fprintf(f, "    { \"name\": %s, \"input\": %s, \"output\": %s, "
+        "\"samples\": %.0f, \"sec\": %.6f, \"samples_per_sec\": %.0f, \"ns_per_sample\": %.3f, \"realtime\": %.2f, "
+        "\"allocs\": %.0f, \"alloc_bytes\": %.0f, \"open_allocs\": %.0f, "
+        "\"pool_allocs\": %.0f, \"pool_bytes\": %.0f, \"open_pool_allocs\": %.0f }%s\n",
+        json_string(r.name).c_str(), json_string(r.in_spk.print()).c_str(), json_string(r.out_spk.print()).c_str(),
+        double(r.samples), double(r.time), r.samples_per_sec(), r.ns_per_sample(), r.realtime(),
+        double(r.allocs), double(r.alloc_bytes), double(r.open_allocs),
+        double(r.pool_allocs), double(r.pool_bytes), double(r.open_pool_allocs),
+        i + 1 < results.size()? ",": "");
+    }
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+  }
+  else if (strcmp(format, "csv") == 0)
+  {
+    fprintf(f, "tag,date,sample,cpu_features,name,input,output,samples,sec,samples_per_sec,ns_per_sample,realtime,allocs,alloc_bytes,open_allocs,pool_allocs,pool_bytes,open_pool_allocs\n");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+      const Result &r = results[i];
+      fprintf(f, "%s,%s,%s,%s,%s,%s,%s,%.0f,%.6f,%.0f,%.3f,%.2f,%.0f,%.0f,%.0f,%.0f,%.0f,%.0f\n",
+        tag.c_str(), date, sample, features.c_str(),
+        r.name.c_str(), r.in_spk.print().c_str(), r.out_spk.print().c_str(),
+        double(r.samples), double(r.time), r.samples_per_sec(), r.ns_per_sample(), r.realtime(),
+        double(r.allocs), double(r.alloc_bytes), double(r.open_allocs),
+        double(r.pool_allocs), double(r.pool_bytes), double(r.open_pool_allocs));
+    }
+  }
+  else
+  {
+    fprintf(f, "Tag:    %s\n", tag.c_str());
+    fprintf(f, "Date:   %s\n", date);
+    fprintf(f, "Sample: %s\n", sample);
+    fprintf(f, "CPU:    %s\n\n", features.c_str());
+    fprintf(f, "%-20s %-28s %-28s %12s %10s %8s %8s %10s %8s %10s\n",
+      "Name", "Input", "Output", "Samples/s", "ns/sample", "x RT", "Allocs", "Bytes", "Pool", "Pool bytes");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+      const Result &r = results[i];
+      fprintf(f, "%-20s %-28s %-28s %12.0f %10.2f %8.1f %8.0f %10.0f %8.0f %10.0f\n",
+        r.name.c_str(), r.in_spk.print().c_str(), r.out_spk.print().c_str(),
+        r.samples_per_sec(), r.ns_per_sample(), r.realtime(),
+        double(r.allocs), double(r.alloc_bytes),
+        double(r.pool_allocs), double(r.pool_bytes));
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void usage()
+{
+  printf(
+"Filter speed benchmark\n"
+"Usage:\n"
+"  bench [-t seconds] [-c chunk_size] [-f text|csv|json] [-o file]\n"
+"        [--tag text] [--file file]... [--no-simd] [name...]\n");
+}
+
+int main(int argc, char **argv)
+{
+  Options opt;
+  opt.seconds = 10;
+  opt.chunk_size = 4096;
+  const char *format = "text";
+  const char *out_file = 0;
+  string tag;
+  std::vector<const char *> files;
+
+  for (int i = 1; i < argc; i++)
+  {
+    bool has_arg = i + 1 < argc;
+    if (strcmp(argv[i], "-t") == 0 && has_arg)
+      opt.seconds = atof(argv[++i]);
+    else if (strcmp(argv[i], "-c") == 0 && has_arg)
+      opt.chunk_size = (size_t)atoi(argv[++i]);
+    else if (strcmp(argv[i], "-f") == 0 && has_arg)
+      format = argv[++i];
+    else if (strcmp(argv[i], "-o") == 0 && has_arg)
+      out_file = argv[++i];
+    else if (strcmp(argv[i], "--tag") == 0 && has_arg)
+      tag = argv[++i];
+    else if (strcmp(argv[i], "--file") == 0 && has_arg)
+      files.push_back(argv[++i]);
+    else if (strcmp(argv[i], "--no-simd") == 0)
+      set_cpu_features_mask(0);
+    else if (argv[i][0] == '-')
+    {
+      usage();
+      return 1;
+    }
+    else
+      opt.names.push_back(argv[i]);
+  }
+
+  if (opt.seconds <= 0 || opt.chunk_size == 0 ||
+      (strcmp(format, "text") && strcmp(format, "csv") && strcmp(format, "json")))
+  {
+    usage();
+    return 1;
+  }
+
+  std::vector<Result> results;
+  Result result;
+
+  for (int i = 0; i < array_size(tests); i++)
+  {
+    const Test &test = tests[i];
+    if (!opt.match(test.name))
+      continue;
+
+    for (int j = 0; j < array_size(test.modes) && test.modes[j]; j++)
+      if (run_test(test, test.modes[j], opt, result))
+        results.push_back(result);
+      else
+        fprintf(stderr, "%s: cannot process %s\n", test.name,
+          Speakers(test.format, test.modes[j], test.sample_rate).print().c_str());
+  }
+
+  for (unsigned len = 64; len <= 65536; len *= 2)
+  {
+    char name[32];
+    sprintf(name, "FFT/%u", len);
+    if (opt.match(name) && run_fft(len, opt, result))
+      results.push_back(result);
+  }
+
+  if (opt.match("AC3Parser"))
+  {
+    static const int modes[] = { MODE_STEREO, MODE_5_1 };
+    for (int i = 0; i < array_size(modes); i++)
+    {
+      FrameList frames;
+      AC3Parser parser;
+      if (encode_ac3(modes[i], opt, frames) && run("AC3Parser", &parser, &frames, result))
+        results.push_back(result);
+      else
+        fprintf(stderr, "AC3Parser: test failed\n");
+    }
+  }
+
+  for (size_t i = 0; i < files.size(); i++)
+  {
+    FrameList frames;
+    if (!load_file(files[i], frames))
+    {
+      fprintf(stderr, "%s: cannot load the file\n", files[i]);
+      continue;
+    }
+
+    int d = 0;
+    while (d < array_size(decoders) && decoders[d].format != frames.get_output().format)
+      d++;
+    if (d >= array_size(decoders))
+    {
+      fprintf(stderr, "%s: format %s is not supported\n", files[i], frames.get_output().format_text());
+      continue;
+    }
+
+    if (opt.match(decoders[d].name))
+    {
+      Filter *filter = decoders[d].create();
+      if (run(decoders[d].name, filter, &frames, result))
+        results.push_back(result);
+      else
+        fprintf(stderr, "%s: cannot decode the file\n", files[i]);
+      delete filter;
+    }
+  }
+
+  FILE *f = stdout;
+  if (out_file)
+  {
+    f = fopen(out_file, "w");
+    if (!f)
+    {
+      fprintf(stderr, "Cannot open %s\n", out_file);
+      return 1;
+    }
+  }
+
+  report(f, format, tag, opt, results);
+  if (f != stdout)
+    fclose(f);
+  return 0;
+}
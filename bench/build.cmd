@@ -0,0 +1 @@
+@call ..\cmd\build_vc.cmd %*
\ No newline at end of file
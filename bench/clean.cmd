@@ -0,0 +1 @@
+@call ..\cmd\clean_vc.cmd %*
\ No newline at end of file
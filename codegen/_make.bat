@@ -1,5 +1,3 @@
-perl migen_io.pl > mixer_io.cpp
-perl migen_ip.pl > mixer_ip.cpp
 perl pcm2linear.pl > pcm2linear.cpp
 perl linear2pcm.pl > linear2pcm.cpp
 perl prime.pl > prime.cpp
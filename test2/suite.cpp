@@ -321,3 +321,34 @@ double calc_rms_diff(Source *s1, Filter *f1, Source *s2, Filter *f2)
   SourceFilter sf2(s2, f2);
   return calc_rms_diff(&sf1, &sf2);
 }
+
+size_t filter_samples(Filter *f, const SampleBuf &in, SampleBuf &out, size_t n, size_t chunk_size)
+{
+  assert(f != 0);
+
+  int nch = f->get_input().nch();
+  size_t out_size = 0;
+  SampleBuf buf(nch, chunk_size);
+  Chunk chunk_in, chunk_out;
+
+  for (size_t pos = 0; pos < n; pos += chunk_size)
+  {
+    size_t len = MIN(chunk_size, n - pos);
+    copy_samples(buf, 0, in, pos, nch, len);
+    chunk_in.set_linear(buf, len);
+    while (f->process(chunk_in, chunk_out))
+    {
+      if (out_size + chunk_out.size <= out.nsamples())
+        copy_samples(out, out_size, chunk_out.samples, 0, nch, chunk_out.size);
+      out_size += chunk_out.size;
+    }
+  }
+
+  while (f->flush(chunk_out))
+  {
+    if (out_size + chunk_out.size <= out.nsamples())
+      copy_samples(out, out_size, chunk_out.samples, 0, nch, chunk_out.size);
+    out_size += chunk_out.size;
+  }
+  return out_size;
+}
@@ -1,6 +1,7 @@
 #ifndef SUITE_H
 #define SUITE_H
 
+#include "buffer.h"
 #include "filter.h"
 #include "source.h"
 
@@ -33,6 +34,17 @@ sample_t calc_diff(Source *s1, Filter *f1, Source *s2, Filter *f2);
 double calc_rms_diff(Source *s1, Source *s2);
 double calc_rms_diff(Source *s1, Filter *f1, Source *s2, Filter *f2);
 
+///////////////////////////////////////////////////////////////////////////////
+// Filter helpers
+///////////////////////////////////////////////////////////////////////////////
+
+// Filter n samples of the input by chunks of chunk_size and collect the
+// output. Input is copied because trivial filters work in-place. Returns the
+// total output size; samples that do not fit into the output buffer are
+// counted but not stored. Filter must be open.
+
+size_t filter_samples(Filter *f, const SampleBuf &in, SampleBuf &out, size_t n, size_t chunk_size);
+
 ///////////////////////////////////////////////////////////////////////////////
 // Boost::Test specific
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,252 @@
+/*
+  FFT test
+  Compare with the direct DFT, check that transform tables are shared and
+  that transforms of the same length may run concurrently.
+*/
+
+#include <math.h>
+#include <boost/test/unit_test.hpp>
+#include "auto_buf.h"
+#include "buffer.h"
+#include "dsp/fft.h"
+#include "dsp/fftsg.h"
+#include "rng.h"
+#include "thread.h"
+#include "cpu.h"
+
+static const int seed = 47385621;
+
+#ifdef FLOAT_SAMPLE
+static const double max_err = 1e-3;
+#else
+static const double max_err = 1e-9;
+#endif
+
+// Direct DFT in Ooura's packing: re[0], re[n/2], re[1], -im[1], ...
+static void dft(const sample_t *in, double *out, unsigned n)
+{
+  for (unsigned k = 0; k <= n / 2; k++)
+  {
+    double re = 0, im = 0;
+    for (unsigned i = 0; i < n; i++)
+    {
+      double a = 2 * M_PI * double(k) * double(i) / double(n);
+      re += in[i] * cos(a);
+      im -= in[i] * sin(a);
+    }
+    if (k == 0)
+      out[0] = re;
+    else if (k == n / 2)
+      out[1] = re;
+    else
+    {
+      out[2*k] = re;
+      out[2*k+1] = -im;
+    }
+  }
+}
+
+// Transforms random data and compares the result with the reference
+class FFTThread : public Thread
+{
+public:
+  unsigned len;
+  int thread_seed;
+  const double *ref;
+  volatile bool ok;
+
+  FFTThread(): len(0), thread_seed(0), ref(0), ok(false)
+  {}
+
+protected:
+  virtual unsigned long process()
+  {
+    FFT fft(len);
+    AutoBuf<sample_t> buf(len);
+    bool result = true;
+    for (int i = 0; i < 100; i++)
+    {
+      RNG(thread_seed).fill_samples(buf, len);
+      fft.rdft(buf);
+      for (unsigned j = 0; j < len; j++)
+        if (fabs(buf[j] - ref[j]) > max_err)
+          result = false;
+    }
+    ok = result;
+    return 0;
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(fft)
+
+BOOST_AUTO_TEST_CASE(transform)
+{
+  static const unsigned lengths[] = { 8, 16, 64, 128, 256, 512, 1024, 2048 };
+  for (int i = 0; i < array_size(lengths); i++)
+  {
+    unsigned n = lengths[i];
+    AutoBuf<sample_t> in(n), buf(n);
+    AutoBuf<double> ref(n);
+    RNG(seed).fill_samples(in, n);
+    dft(in, ref, n);
+
+    FFT fft(n);
+    BOOST_CHECK(fft.is_ok());
+    BOOST_CHECK_EQUAL(fft.get_length(), n);
+
+    copy_samples(buf, in, n);
+    fft.rdft(buf);
+    double diff = 0;
+    for (unsigned j = 0; j < n; j++)
+      diff = MAX(diff, fabs(buf[j] - ref[j]));
+    BOOST_CHECK_MESSAGE(diff < max_err * n, "length = " << n);
+
+    // Inverse transform is scaled by n/2
+    fft.inv_rdft(buf);
+    diff = 0;
+    for (unsigned j = 0; j < n; j++)
+      diff = MAX(diff, fabs(buf[j] * 2 / n - in[j]));
+    BOOST_CHECK_MESSAGE(diff < max_err, "length = " << n);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(backends)
+{
+  // SIMD backend must give the same result as Ooura's code
+  for (unsigned n = 64; n <= 65536; n *= 2)
+  {
+    AutoBuf<sample_t> in(n), buf1(n), buf2(n);
+    RNG(seed).fill_samples(in, n);
+
+    set_cpu_features_mask(0);
+    FFT fft1(n);
+    set_cpu_features_mask(cpu_all);
+    FFT fft2(n);
+
+    copy_samples(buf1, in, n);
+    copy_samples(buf2, in, n);
+    fft1.rdft(buf1);
+    fft2.rdft(buf2);
+    double diff = 0;
+    for (unsigned i = 0; i < n; i++)
+      diff = MAX(diff, fabs(buf1[i] - buf2[i]));
+    BOOST_CHECK_MESSAGE(diff < max_err * sqrt(double(n)), "rdft length = " << n << " diff = " << diff);
+
+    copy_samples(buf1, in, n);
+    copy_samples(buf2, in, n);
+    fft1.inv_rdft(buf1);
+    fft2.inv_rdft(buf2);
+    diff = 0;
+    for (unsigned i = 0; i < n; i++)
+      diff = MAX(diff, fabs(buf1[i] - buf2[i]));
+    BOOST_CHECK_MESSAGE(diff < max_err * sqrt(double(n)), "inv_rdft length = " << n << " diff = " << diff);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(multichannel)
+{
+  // Multichannel transform must give the same result as separate transforms
+  // of each channel, when the batch is smaller or larger than nch too.
+  static const unsigned lengths[] = { 16, 64, 128, 4096 };
+  static const int batches[] = { 1, 3, NCHANNELS };
+
+  for (int i = 0; i < array_size(lengths); i++)
+    for (int j = 0; j < array_size(batches); j++)
+    {
+      const unsigned n = lengths[i];
+      SampleBuf in(NCHANNELS, n), buf1(NCHANNELS, n), buf2(NCHANNELS, n);
+      RNG rng(seed);
+      for (int ch = 0; ch < NCHANNELS; ch++)
+        rng.fill_samples(in[ch], n);
+
+      FFT fft1(n);
+      FFT fft2(n, batches[j]);
+      for (int nch = 1; nch <= NCHANNELS; nch++)
+      {
+        copy_samples(buf1, in, NCHANNELS, n);
+        copy_samples(buf2, in, NCHANNELS, n);
+        for (int ch = 0; ch < nch; ch++)
+          fft1.rdft(buf1[ch]);
+        fft2.rdft(buf2, nch);
+        for (int ch = 0; ch < NCHANNELS; ch++)
+          BOOST_CHECK_MESSAGE(memcmp(buf1[ch], buf2[ch], n * sizeof(sample_t)) == 0,
+            "rdft length = " << n << " batch = " << batches[j] << " nch = " << nch << " ch = " << ch);
+
+        for (int ch = 0; ch < nch; ch++)
+          fft1.inv_rdft(buf1[ch]);
+        fft2.inv_rdft(buf2, nch);
+        for (int ch = 0; ch < NCHANNELS; ch++)
+          BOOST_CHECK_MESSAGE(memcmp(buf1[ch], buf2[ch], n * sizeof(sample_t)) == 0,
+            "inv_rdft length = " << n << " batch = " << batches[j] << " nch = " << nch << " ch = " << ch);
+      }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(shared_tables)
+{
+  FFT fft1(4096);
+  size_t size = FFT::cache_size();
+
+  // Same length does not create new tables
+  FFT fft2(4096);
+  FFT fft3;
+  fft3.set_length(4096);
+  BOOST_CHECK_EQUAL(FFT::cache_size(), size);
+
+  // Tables are kept after all transforms are released
+  fft1.set_length(0);
+  fft2.set_length(0);
+  fft3.set_length(0);
+  BOOST_CHECK(!fft1.is_ok());
+  FFT fft4(4096);
+  BOOST_CHECK_EQUAL(FFT::cache_size(), size);
+
+  // New length (too long for other tests, filters and resamplers)
+  const unsigned new_len = 1 << 20;
+  FFT fft5(new_len);
+  BOOST_CHECK_EQUAL(FFT::cache_size(), size + 1);
+
+  // Transforms with shared tables give the same result
+  AutoBuf<sample_t> buf1(new_len), buf2(new_len);
+  RNG(seed).fill_samples(buf1, new_len);
+  copy_samples(buf2, buf1, new_len);
+  FFT fft6(new_len);
+  fft5.rdft(buf1);
+  fft6.rdft(buf2);
+  BOOST_CHECK(memcmp(buf1.begin(), buf2.begin(), new_len * sizeof(sample_t)) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent)
+{
+  // Length not used before, so tables are created concurrently too
+  static const unsigned len = 32768;
+  static const int nthreads = 4;
+
+  // Reference with own tables
+  AutoBuf<sample_t> ref(len);
+  AutoBuf<int> ip((int)(2 + sqrt(double(len * 2))));
+  AutoBuf<sample_t> w(len / 2 + 1);
+  AutoBuf<double> ref_double(len);
+  ip[0] = 0;
+  RNG(seed).fill_samples(ref, len);
+  ::rdft(len, 1, ref, ip, w);
+  for (unsigned i = 0; i < len; i++)
+    ref_double[i] = ref[i];
+
+  FFTThread threads[nthreads];
+  for (int i = 0; i < nthreads; i++)
+  {
+    threads[i].len = len;
+    threads[i].thread_seed = seed;
+    threads[i].ref = ref_double;
+    BOOST_REQUIRE(threads[i].create(false));
+  }
+
+  for (int i = 0; i < nthreads; i++)
+  {
+    threads[i].terminate(60000);
+    BOOST_CHECK(threads[i].ok);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
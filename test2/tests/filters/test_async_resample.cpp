@@ -0,0 +1,137 @@
+/*
+  AsyncResample test
+  Resample a tone with fixed and changing ratios and compare with the tone of
+  the expected frequency. Check the drift measurement of Dejitter.
+*/
+
+#include <math.h>
+#include <boost/test/unit_test.hpp>
+#include "filters/async_resample.h"
+#include "filters/dejitter.h"
+#include "../../suite.h"
+
+static const int sample_rate = 48000;
+static const size_t size = 48000;
+static const size_t chunk_size = 1000;
+static const double freq = 1000;
+
+static void make_tone(sample_t *s, size_t n, double freq, int sample_rate)
+{
+  for (size_t i = 0; i < n; i++)
+    s[i] = sample_t(0.5 * sin(2 * M_PI * freq * i / sample_rate));
+}
+
+// Compare the output with the tone of frequency freq / ratio, skipping
+// transients at stream ends
+static double tone_diff(const sample_t *s, size_t n, double freq, int sample_rate)
+{
+  const size_t margin = 1000;
+  double diff = 0;
+  for (size_t i = margin; i + margin < n; i++)
+    diff = MAX(diff, fabs(s[i] - 0.5 * sin(2 * M_PI * freq * i / sample_rate)));
+  return diff;
+}
+
+BOOST_AUTO_TEST_SUITE(async_resample)
+
+BOOST_AUTO_TEST_CASE(constructor)
+{
+  AsyncResample f;
+  BOOST_CHECK_EQUAL(f.get_sample_rate(), 0);
+  BOOST_CHECK_EQUAL(f.get_ratio(), 1.0);
+  BOOST_CHECK(f.get_drift_source() == 0);
+
+  f.set_ratio(2.0);
+  BOOST_CHECK_EQUAL(f.get_ratio(), 1.0 + AsyncResample::max_ratio_deviation);
+  f.set_ratio(0.5);
+  BOOST_CHECK_EQUAL(f.get_ratio(), 1.0 - AsyncResample::max_ratio_deviation);
+  BOOST_CHECK(!f.set(48000, 0, 0.9));
+  BOOST_CHECK(!f.set(48000, 100, 1.0));
+}
+
+BOOST_AUTO_TEST_CASE(fixed_ratio)
+{
+  static const struct { int out_rate; double ratio; } tests[] =
+  {
+    { 0, 1.0 }, { 0, 1.001 }, { 0, 0.995 }, { 44100, 1.0 }, { 96000, 1.0005 }
+  };
+
+  const Speakers spk(FORMAT_LINEAR, MODE_STEREO, sample_rate);
+  SampleBuf in(2, size);
+  make_tone(in[0], size, freq, sample_rate);
+  make_tone(in[1], size, freq, sample_rate);
+
+  for (int i = 0; i < array_size(tests); i++)
+  {
+    AsyncResample f(tests[i].out_rate, 100, 0.95);
+    f.set_ratio(tests[i].ratio);
+    BOOST_REQUIRE(f.open(spk));
+
+    int out_rate = f.get_output().sample_rate;
+    double k = double(out_rate) / sample_rate * tests[i].ratio;
+    SampleBuf out(2, size_t(size * k) + 100);
+
+    // Process the stream twice to check the state after flushing
+    for (int pass = 0; pass < 2; pass++)
+    {
+      size_t out_size = filter_samples(&f, in, out, size, chunk_size);
+      BOOST_CHECK_LE(fabs(out_size - size * k), 2);
+      for (int ch = 0; ch < 2; ch++)
+        BOOST_CHECK_MESSAGE(tone_diff(out[ch], out_size, freq / tests[i].ratio, out_rate) < 1e-4,
+          "out rate = " << out_rate << " ratio = " << tests[i].ratio << " pass = " << pass);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ratio_change)
+{
+  const Speakers spk(FORMAT_LINEAR, MODE_MONO, sample_rate);
+  SampleBuf in(1, size), out(1, size * 2);
+  make_tone(in[0], size, freq, sample_rate);
+
+  AsyncResample f;
+  f.set_ratio_time(0.1);
+  BOOST_REQUIRE(f.open(spk));
+
+  // Abrupt target change is followed smoothly
+  f.set_ratio(1.01);
+  size_t out_size = filter_samples(&f, in, out, size, chunk_size);
+  BOOST_CHECK_GT(out_size, size);
+  BOOST_CHECK_LT(out_size, size * 1.01);
+
+  // No clicks: the tone slope is limited (stream ends ring because the tone
+  // starts and stops abruptly)
+  double max_step = 0.5 * 2 * M_PI * freq / sample_rate * 1.01;
+  for (size_t i = 1000; i < out_size - 1000; i++)
+    BOOST_REQUIRE_LE(fabs(out[0][i] - out[0][i-1]), max_step);
+}
+
+BOOST_AUTO_TEST_CASE(dejitter_drift)
+{
+  // Source clock is 0.1% slower than its nominal sample rate
+  const double drift = 0.001;
+  const Speakers spk(FORMAT_LINEAR, MODE_MONO, sample_rate);
+  SampleBuf buf(1, chunk_size);
+  zero_samples(buf, 1, chunk_size);
+
+  Dejitter dejitter;
+  AsyncResample f;
+  f.set_drift_source(&dejitter);
+  BOOST_REQUIRE(dejitter.open(spk));
+  BOOST_REQUIRE(f.open(spk));
+
+  Chunk chunk, out, out2;
+  for (int i = 0; i < 500; i++)
+  {
+    vtime_t time = vtime_t(i * chunk_size) / sample_rate * (1 + drift);
+    chunk.set_linear(buf, chunk_size, true, time);
+    while (dejitter.process(chunk, out))
+      while (f.process(out, out2))
+        ;
+  }
+
+  BOOST_CHECK_CLOSE(dejitter.get_drift(), drift, 20);
+  BOOST_CHECK_CLOSE(f.get_ratio(), 1 + drift, 0.02);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -3,6 +3,7 @@
 */
 
 #include <math.h>
+#include <limits>
 #include <boost/test/unit_test.hpp>
 #include "fir/param_fir.h"
 #include "filters/bass_redir.h"
@@ -11,6 +12,7 @@
 #include "filters/mixer.h"
 #include "filters/slice.h"
 #include "source/generator.h"
+#include "../../noise_buf.h"
 #include "../../suite.h"
 
 static const int seed = 349857983;
@@ -193,4 +195,54 @@ BOOST_AUTO_TEST_CASE(equal_power)
   BOOST_CHECK_CLOSE(rms, test_rms, 0.5);
 }
 
+BOOST_AUTO_TEST_CASE(silence_tail)
+{
+  // Filter tails decay into denormals after a loud burst, and denormals are
+  // very slow to process. The filter state must be flushed, so the tail never
+  // falls into the denormal range and the output becomes exactly zero.
+  // The filter is called directly, without the graph's flush-to-zero mode.
+  const Speakers spk(FORMAT_LINEAR, MODE_7_1, sample_rate);
+  const int nch = spk.nch();
+  const size_t size = sample_rate;
+  const sample_t min_normal = std::numeric_limits<sample_t>::min();
+
+  SampleBufNoise burst(nch, size, seed);
+  SampleBuf silence(nch, size);
+  Chunk chunk, out;
+
+  BassRedir f;
+  f.set_enabled(true);
+  f.set_freq(freq);
+  BOOST_REQUIRE(f.open(spk));
+
+  chunk.set_linear(burst, size);
+  BOOST_REQUIRE(f.process(chunk, out));
+
+  // 10 seconds of silence: without the flush the tails of the low-frequency
+  // filters reach the denormal range in a few seconds
+  bool is_zero = false;
+  for (int i = 0; i < 10; i++)
+  {
+    silence.zero();
+    chunk.set_linear(silence, size);
+    BOOST_REQUIRE(f.process(chunk, out));
+    BOOST_REQUIRE_EQUAL(out.size, size);
+
+    is_zero = true;
+    for (int ch = 0; ch < nch; ch++)
+      for (size_t j = 0; j < out.size; j++)
+      {
+        sample_t s = fabs(out.samples[ch][j]);
+        if (s != 0 && s < min_normal)
+        {
+          BOOST_ERROR("Denormal output at second " << i << " ch = " << ch << " j = " << j);
+          return;
+        }
+        if (s != 0)
+          is_zero = false;
+      }
+  }
+  BOOST_CHECK(is_zero);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
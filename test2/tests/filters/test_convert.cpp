@@ -0,0 +1,125 @@
+/*
+  PCM <-> Linear conversion functions test
+  Compare SIMD conversion functions with generic ones.
+*/
+
+#include <string.h>
+#include <boost/test/unit_test.hpp>
+#include "filters/convert_func.h"
+#include "buffer.h"
+#include "cpu.h"
+#include "rng.h"
+
+static const int seed = 475892345;
+static const size_t size = 1001;
+
+static const int formats[] = {
+  FORMAT_PCM16, FORMAT_PCM24, FORMAT_PCM32,
+  FORMAT_PCM16_BE, FORMAT_PCM24_BE, FORMAT_PCM32_BE,
+  FORMAT_PCMFLOAT, FORMAT_PCMDOUBLE
+};
+
+// Max absolute value such that floor(value) fits the format
+static double format_range(int format)
+{
+  switch (format)
+  {
+    case FORMAT_PCM16: case FORMAT_PCM16_BE: return 32768.0;
+    case FORMAT_PCM24: case FORMAT_PCM24_BE: return 8388608.0;
+    case FORMAT_PCM32: case FORMAT_PCM32_BE: return 2147483520.0;
+    default: return 1.0;
+  }
+}
+
+// Random PCM data (valid floating-point numbers for float formats)
+static void fill_pcm(RNG &rng, int format, uint8_t *rawdata, size_t n)
+{
+  if (format == FORMAT_PCMFLOAT)
+    for (size_t i = 0; i < n; i++)
+      ((float *)rawdata)[i] = float(rng.get_double());
+  else if (format == FORMAT_PCMDOUBLE)
+    for (size_t i = 0; i < n; i++)
+      ((double *)rawdata)[i] = rng.get_double();
+  else
+    rng.fill_raw(rawdata, n * sample_size(format));
+}
+
+BOOST_AUTO_TEST_SUITE(convert)
+
+BOOST_AUTO_TEST_CASE(pcm2linear)
+{
+  RNG rng(seed);
+  for (int nch = 1; nch <= NCHANNELS; nch++)
+    for (int i = 0; i < array_size(formats); i++)
+    {
+      int format = formats[i];
+      size_t raw_size = size * nch * sample_size(format);
+      Rawdata rawdata(raw_size);
+      SampleBuf ref(nch, size), test(nch, size);
+      fill_pcm(rng, format, rawdata, size * nch);
+
+      set_cpu_features_mask(0);
+      convert_t generic = find_pcm2linear(format, nch);
+      set_cpu_features_mask(cpu_all);
+      convert_t simd = find_pcm2linear(format, nch);
+      BOOST_REQUIRE(generic && simd);
+
+      generic(rawdata, ref, size);
+      simd(rawdata, test, size);
+
+      for (int ch = 0; ch < nch; ch++)
+        BOOST_CHECK_MESSAGE(memcmp(ref[ch], test[ch], size * sizeof(sample_t)) == 0,
+          "format = " << format << " nch = " << nch << " ch = " << ch);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(linear2pcm)
+{
+  RNG rng(seed);
+  for (int nch = 1; nch <= NCHANNELS; nch++)
+    for (int i = 0; i < array_size(formats); i++)
+    {
+      int format = formats[i];
+      double range = format_range(format);
+      size_t raw_size = size * nch * sample_size(format);
+      Rawdata ref(raw_size), test(raw_size);
+      SampleBuf samples(nch, size);
+      for (int ch = 0; ch < nch; ch++)
+        for (size_t s = 0; s < size; s++)
+          samples[ch][s] = sample_t(rng.get_double() * range);
+
+      set_cpu_features_mask(0);
+      convert_t generic = find_linear2pcm(format, nch);
+      set_cpu_features_mask(cpu_all);
+      convert_t simd = find_linear2pcm(format, nch);
+      BOOST_REQUIRE(generic && simd);
+
+      generic(ref, samples, size);
+      simd(test, samples, size);
+
+      BOOST_CHECK_MESSAGE(memcmp(ref, test, raw_size) == 0,
+        "format = " << format << " nch = " << nch);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(roundtrip)
+{
+  RNG rng(seed);
+  for (int nch = 1; nch <= NCHANNELS; nch++)
+    for (int i = 0; i < array_size(formats); i++)
+    {
+      int format = formats[i];
+      size_t raw_size = size * nch * sample_size(format);
+      Rawdata rawdata(raw_size), result(raw_size);
+      SampleBuf samples(nch, size);
+      fill_pcm(rng, format, rawdata, size * nch);
+
+      find_pcm2linear(format, nch)(rawdata, samples, size);
+      find_linear2pcm(format, nch)(result, samples, size);
+
+      BOOST_CHECK_MESSAGE(memcmp(rawdata, result, raw_size) == 0,
+        "format = " << format << " nch = " << nch);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,199 @@
+/*
+  Convolver and ConvolverMch test
+  Compare partitioned convolution with the direct convolution for different
+  block sizes, filter lengths and centers.
+*/
+
+#include <math.h>
+#include <boost/test/unit_test.hpp>
+#include "filters/convolver.h"
+#include "filters/convolver_mch.h"
+#include "rng.h"
+#include "../../suite.h"
+
+static const int seed = 928374651;
+static const int sample_rate = 48000;
+static const size_t size = 20000;
+static const size_t chunk_size = 1001;
+
+// Random response of the given length and center
+class RandomFIR : public FIRGen
+{
+protected:
+  int length;
+  int center;
+  int seed;
+
+public:
+  RandomFIR(int length_, int center_, int seed_):
+  length(length_), center(center_), seed(seed_)
+  {}
+
+  virtual int version() const
+  { return 0; }
+
+  virtual const FIRInstance *make(int sample_rate) const
+  {
+    RNG rng(seed);
+    DynamicFIRInstance *fir = new DynamicFIRInstance(sample_rate, length, center);
+    for (int i = 0; i < length; i++)
+      fir->buf[i] = rng.get_double() / sqrt(double(length));
+    return fir;
+  }
+};
+
+// Direct convolution aligned at the filter center
+static void convolve(const FIRInstance *fir, const sample_t *in, sample_t *out, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+  {
+    double sum = 0;
+    for (int j = 0; j < fir->length; j++)
+    {
+      ptrdiff_t k = ptrdiff_t(i) + fir->center - j;
+      if (k >= 0 && k < ptrdiff_t(n))
+        sum += fir->data[j] * in[k];
+    }
+    out[i] = sample_t(sum);
+  }
+}
+
+static double max_diff(const sample_t *s1, const sample_t *s2, size_t n)
+{
+  double diff = 0;
+  for (size_t i = 0; i < n; i++)
+    diff = MAX(diff, fabs(s1[i] - s2[i]));
+  return diff;
+}
+
+#ifdef FLOAT_SAMPLE
+static const double max_err = 1e-4;
+#else
+static const double max_err = 1e-10;
+#endif
+
+BOOST_AUTO_TEST_SUITE(convolver)
+
+BOOST_AUTO_TEST_CASE(partitioned)
+{
+  static const struct { int length, center; } firs[] =
+  {
+    { 1, 0 }, { 7, 3 }, { 100, 0 }, { 257, 128 }, { 1000, 999 }, { 3000, 700 }, { 5000, 2500 }
+  };
+  static const int block_sizes[] = { 0, 16, 64, 256, 1000, 4096 };
+
+  const Speakers spk(FORMAT_LINEAR, MODE_STEREO, sample_rate);
+  RNG rng(seed);
+  SampleBuf in(2, size), ref(2, size), out(2, size);
+  for (int ch = 0; ch < 2; ch++)
+    rng.fill_samples(in[ch], size);
+
+  for (int i = 0; i < array_size(firs); i++)
+  {
+    RandomFIR gen(firs[i].length, firs[i].center, seed + i);
+    const FIRInstance *fir = gen.make(sample_rate);
+    for (int ch = 0; ch < 2; ch++)
+      convolve(fir, in[ch], ref[ch], size);
+    delete fir;
+
+    for (int j = 0; j < array_size(block_sizes); j++)
+    {
+      Convolver conv(&gen);
+      conv.set_block_size(block_sizes[j]);
+      BOOST_REQUIRE(conv.open(spk));
+
+      // Process the stream twice to check the state after flushing
+      for (int pass = 0; pass < 2; pass++)
+      {
+        out.zero();
+        size_t out_size = filter_samples(&conv, in, out, size, chunk_size);
+        BOOST_CHECK_EQUAL(out_size, size);
+        for (int ch = 0; ch < 2; ch++)
+          BOOST_CHECK_MESSAGE(max_diff(ref[ch], out[ch], size) < max_err,
+            "length = " << firs[i].length << " center = " << firs[i].center <<
+            " block size = " << block_sizes[j] << " pass = " << pass);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(block_size_change)
+{
+  const Speakers spk(FORMAT_LINEAR, MODE_MONO, sample_rate);
+  RandomFIR gen(3000, 1500, seed);
+  Convolver conv(&gen);
+  BOOST_CHECK_EQUAL(conv.get_block_size(), 0);
+
+  RNG rng(seed);
+  SampleBuf in(1, size), ref(1, size), out(1, size);
+  rng.fill_samples(in[0], size);
+
+  const FIRInstance *fir = gen.make(sample_rate);
+  convolve(fir, in[0], ref[0], size);
+  delete fir;
+
+  BOOST_REQUIRE(conv.open(spk));
+  conv.set_block_size(256);
+  BOOST_CHECK_EQUAL(conv.get_block_size(), 256);
+  BOOST_CHECK_EQUAL(filter_samples(&conv, in, out, size, chunk_size), size);
+  BOOST_CHECK_LT(max_diff(ref[0], out[0], size), max_err);
+}
+
+BOOST_AUTO_TEST_CASE(mch_partitioned)
+{
+  // Different lengths and centers, and trivial channels
+  const Speakers spk(FORMAT_LINEAR, MODE_5_1, sample_rate);
+  const int nch = spk.nch();
+  RandomFIR gen_l(2000, 100, seed);
+  RandomFIR gen_c(500, 400, seed + 1);
+  RandomFIR gen_r(3000, 1500, seed + 2);
+  FIRGain gen_sl(0.5);
+  FIRZero gen_sr;
+  const FIRGen *gens[] = { &gen_l, &gen_c, &gen_r, &gen_sl, &gen_sr, 0 };
+
+  RNG rng(seed);
+  SampleBuf in(nch, size), ref(nch, size), out(nch, size);
+  for (int ch = 0; ch < nch; ch++)
+    rng.fill_samples(in[ch], size);
+
+  order_t order;
+  spk.get_order(order);
+  for (int ch = 0; ch < nch; ch++)
+  {
+    const FIRGen *gen = gens[ch];
+    const FIRInstance *fir = gen? gen->make(sample_rate): 0;
+    if (fir && fir->type() == firt_custom)
+      convolve(fir, in[ch], ref[ch], size);
+    else
+    {
+      copy_samples(ref[ch], in[ch], size);
+      if (fir && fir->type() == firt_gain)
+        gain_samples(fir->data[0], ref[ch], size);
+      if (fir && fir->type() == firt_zero)
+        zero_samples(ref[ch], size);
+    }
+    delete fir;
+  }
+
+  static const int block_sizes[] = { 0, 64, 512, 2048 };
+  for (int i = 0; i < array_size(block_sizes); i++)
+  {
+    ConvolverMch conv;
+    for (int ch = 0; ch < nch; ch++)
+      conv.set_fir(order[ch], gens[ch]);
+    conv.set_block_size(block_sizes[i]);
+    BOOST_REQUIRE(conv.open(spk));
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+      out.zero();
+      size_t out_size = filter_samples(&conv, in, out, size, chunk_size);
+      BOOST_CHECK_EQUAL(out_size, size);
+      for (int ch = 0; ch < nch; ch++)
+        BOOST_CHECK_MESSAGE(max_diff(ref[ch], out[ch], size) < max_err,
+          "ch = " << ch << " block size = " << block_sizes[i] << " pass = " << pass);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,168 @@
+/*
+  FilterGraph test
+*/
+
+#include <boost/test/unit_test.hpp>
+#include "filters/convert.h"
+#include "filters/filter_graph.h"
+#include "filters/gain.h"
+#include "filters/mixer.h"
+#include "source/generator.h"
+#include "buffer.h"
+#include "../../suite.h"
+
+static const Speakers spk1(FORMAT_LINEAR, MODE_STEREO, 48000);
+static const Speakers spk2(FORMAT_LINEAR, MODE_5_1, 48000);
+static const size_t buf_size = 1000;
+static const int seed = 209384752;
+static const size_t noise_size = 65536;
+
+// Filter that allocates a buffer at init()
+class BufFilter : public SamplesFilter
+{
+public:
+  SampleBuf buf;
+
+  virtual bool init()
+  {
+    buf.allocate(spk.nch(), buf_size, arena);
+    return true;
+  }
+
+  virtual bool process(Chunk &in, Chunk &out)
+  {
+    out = in;
+    in.clear();
+    return !out.is_dummy();
+  }
+};
+
+// Filter that accepts interleaved data only
+class FramesFilter : public SimpleFilter
+{
+public:
+  virtual bool can_open(Speakers spk) const
+  { return spk.is_interleaved() && spk.mask != 0 && spk.sample_rate != 0; }
+
+  virtual bool process(Chunk &in, Chunk &out)
+  {
+    out = in;
+    in.clear();
+    return !out.is_dummy();
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(filter_graph)
+
+BOOST_AUTO_TEST_CASE(arena)
+{
+  BufFilter f1, f2;
+  FilterChain chain(&f1, &f2);
+
+  // Filters of the chain take buffers from the arena
+  BOOST_CHECK(chain.open(spk1));
+  BOOST_CHECK(f1.buf.samples()[0] != 0);
+  BOOST_CHECK(f1.buf.samples()[0] != f2.buf.samples()[0]);
+  sample_t *ptr1 = f1.buf.samples()[0];
+
+  // Chain rebuild reuses the memory
+  BOOST_CHECK(chain.open(spk2));
+  BOOST_CHECK(f1.buf.samples()[0] == ptr1);
+  sample_t *ptr2 = f2.buf.samples()[0];
+
+  BOOST_CHECK(chain.open(spk2));
+  BOOST_CHECK(f1.buf.samples()[0] == ptr1);
+  BOOST_CHECK(f2.buf.samples()[0] == ptr2);
+
+  // Filter opened outside of the graph does not use the arena
+  chain.close();
+  BOOST_CHECK(f1.open(spk2));
+  BOOST_CHECK(f1.buf.samples()[0] != ptr1);
+  BOOST_CHECK(f1.buf.samples()[0] != ptr2);
+}
+
+BOOST_AUTO_TEST_CASE(destructor)
+{
+  // Chain closes the filters it does not own before the arena is freed
+  BufFilter f1, f2;
+  {
+    FilterChain chain(&f1, &f2);
+    BOOST_REQUIRE(chain.open(spk1));
+    BOOST_REQUIRE(f1.is_open() && f2.is_open());
+  }
+  BOOST_CHECK(!f1.is_open());
+  BOOST_CHECK(!f2.is_open());
+}
+
+BOOST_AUTO_TEST_CASE(layout_conversion)
+{
+  // Chain converts the layout only where it is required
+  BufFilter planar1, planar2, planar3;
+  FramesFilter frames1, frames2;
+
+  FilterChain chain1(&frames1, &planar1);
+  BOOST_CHECK(chain1.open(spk2));
+  BOOST_CHECK(frames1.is_open());
+  BOOST_CHECK_EQUAL(chain1.get_output(), spk2);
+
+  FilterChain chain2(&planar2, &frames2);
+  BOOST_CHECK(chain2.open(spk2));
+  BOOST_CHECK(frames2.is_open());
+  BOOST_CHECK(chain2.get_output().is_interleaved());
+
+  // Conversions do not change the data
+  FilterChain chain(&chain1, &chain2, &planar3);
+  NoiseGen src(spk2, seed, noise_size);
+  NoiseGen ref(spk2, seed, noise_size);
+  compare(&src, &chain, &ref, 0);
+}
+
+BOOST_AUTO_TEST_CASE(precision)
+{
+  // Chain mixes at float precision and converts the result back to linear
+  // for the filter that does not accept interleaved data
+  Converter to_float(2048);
+  to_float.set_format(FORMAT_INTERLEAVED_FLOAT);
+  Mixer mixer(2048);
+  mixer.set_output(spk1);
+  BufFilter planar;
+
+  FilterChain chain(&to_float, &mixer, &planar);
+  BOOST_CHECK(chain.open(spk2));
+  BOOST_CHECK_EQUAL(mixer.get_output().format, FORMAT_INTERLEAVED_FLOAT);
+  BOOST_CHECK(planar.is_open());
+  BOOST_CHECK_EQUAL(chain.get_output(), spk1);
+
+  NoiseGen src(spk2, seed, noise_size);
+  Chunk in, out;
+  size_t out_size = 0;
+  while (src.get_chunk(in))
+    while (chain.process(in, out))
+      out_size += out.size;
+  while (chain.flush(out))
+    out_size += out.size;
+  BOOST_CHECK_EQUAL(out_size, noise_size);
+}
+
+BOOST_AUTO_TEST_CASE(shared_inplace)
+{
+  // Chain does not hold the data passed between filters, so inplace filters
+  // change the shared buffer that is not held by anyone else
+  Gain gain1(2.0), gain2(0.5);
+  FilterChain chain(&gain1, &gain2);
+  BOOST_REQUIRE(chain.open(spk1));
+
+  SampleBuf data(spk1.nch(), buf_size);
+  zero_samples(data, spk1.nch(), buf_size);
+  Chunk in(data, buf_size);
+  in.share(spk1.nch());
+  sample_t *ptr = in.samples[0];
+
+  Chunk out;
+  BOOST_REQUIRE(chain.process(in, out));
+  BOOST_CHECK(out.samples[0] == ptr);
+  BOOST_CHECK_EQUAL(out.buf.refs(), 1);
+  BOOST_CHECK_EQUAL(out.size, buf_size);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
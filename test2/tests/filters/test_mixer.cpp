@@ -2,8 +2,14 @@
   Mixer test
 */
 
+#include <math.h>
+#include <string.h>
+#include <vector>
 #include <boost/test/unit_test.hpp>
 #include "filters/mixer.h"
+#include "cpu.h"
+#include "mem_pool.h"
+#include "rng.h"
 #include "filters/gain.h"
 #include "filters/filter_graph.h"
 #include "source/generator.h"
@@ -400,8 +406,185 @@ BOOST_AUTO_TEST_CASE(matrix)
 {
   // Test mixing matrix works right
   // Set custom matrix and check the effect.
-  // Test each mixing mode, inplace/buffered modes.
-  BOOST_WARN_MESSAGE(false, "Not implemented");
+  // Test each mixing mode, inplace/buffered modes, generic and SIMD kernels.
+  static const int modes[] = { MODE_MONO, MODE_STEREO, MODE_3_0, MODE_QUADRO,
+    MODE_3_2, MODE_5_1, MODE_6_1, MODE_7_1 };
+  static const int cpu_masks[] = { 0, cpu_all };
+  static const size_t size = 1001; // not a multiple of the SIMD vector
+
+  RNG rng(seed);
+  SampleBuf input(NCHANNELS, size);
+  SampleBuf test(NCHANNELS, size);
+
+  for (int i = 0; i < array_size(cpu_masks); i++)
+    for (int in_mode = 0; in_mode < array_size(modes); in_mode++)
+      for (int out_mode = 0; out_mode < array_size(modes); out_mode++)
+      {
+        set_cpu_features_mask(cpu_masks[i]);
+        Speakers in_spk(FORMAT_LINEAR, modes[in_mode], 48000);
+        Speakers out_spk(FORMAT_LINEAR, modes[out_mode], 48000);
+        order_t in_order, out_order;
+        in_spk.get_order(in_order);
+        out_spk.get_order(out_order);
+
+        // Sparse random matrix with some pass-through channels
+        matrix_t m;
+        m.zero();
+        for (int ch1 = 0; ch1 < CH_NAMES; ch1++)
+          for (int ch2 = 0; ch2 < CH_NAMES; ch2++)
+            if (rng.get_bool())
+              m[ch1][ch2] = rng.get_sample();
+        for (int ch = 0; ch < CH_NAMES; ch += 2)
+        {
+          for (int ch2 = 0; ch2 < CH_NAMES; ch2++)
+            m[ch2][ch] = 0;
+          m[ch][ch] = 1.0;
+        }
+
+        Mixer mixer(size);
+        mixer.set_auto_matrix(false);
+        mixer.set_matrix(m);
+        mixer.set_output(out_spk);
+        BOOST_REQUIRE(mixer.open(in_spk));
+
+        for (int ch = 0; ch < in_spk.nch(); ch++)
+          rng.fill_samples(input[ch], size);
+        copy_samples(test, input, in_spk.nch(), size);
+
+        Chunk in(test, size), out;
+        BOOST_REQUIRE(mixer.process(in, out));
+        BOOST_REQUIRE_EQUAL(out.size, size);
+
+        sample_t diff = 0;
+        for (int out_ch = 0; out_ch < out_spk.nch(); out_ch++)
+          for (size_t s = 0; s < size; s++)
+          {
+            sample_t ref = 0;
+            for (int in_ch = 0; in_ch < in_spk.nch(); in_ch++)
+              ref += input[in_ch][s] * m[in_order[in_ch]][out_order[out_ch]];
+            diff = MAX(diff, fabs(out.samples[out_ch][s] - ref));
+          }
+
+        BOOST_CHECK_MESSAGE(diff < 1e-5, "Mixing " << in_spk.print() <<
+          " > " << out_spk.print() << " fails: diff = " << diff);
+      }
+
+  set_cpu_features_mask(cpu_all);
+}
+
+// Mix interleaved data of the given precision with random matrices. Output
+// layout and precision must be the same as the input ones.
+template <class T>
+static void mix_interleaved(int format)
+{
+  static const int modes[] = { MODE_MONO, MODE_STEREO, MODE_3_0, MODE_QUADRO,
+    MODE_3_2, MODE_5_1, MODE_6_1, MODE_7_1 };
+  static const int cpu_masks[] = { 0, cpu_all };
+  static const size_t size = 1001;
+
+  RNG rng(seed);
+  std::vector<T> input(NCHANNELS * size);
+  std::vector<T> test(NCHANNELS * size);
+
+  for (int i = 0; i < array_size(cpu_masks); i++)
+    for (int in_mode = 0; in_mode < array_size(modes); in_mode++)
+      for (int out_mode = 0; out_mode < array_size(modes); out_mode++)
+      {
+        set_cpu_features_mask(cpu_masks[i]);
+        Speakers in_spk(format, modes[in_mode], 48000);
+        Speakers out_spk(FORMAT_LINEAR, modes[out_mode], 48000);
+        const int in_nch = in_spk.nch();
+        const int out_nch = out_spk.nch();
+        order_t in_order, out_order;
+        in_spk.get_order(in_order);
+        out_spk.get_order(out_order);
+
+        matrix_t m;
+        m.zero();
+        for (int ch1 = 0; ch1 < CH_NAMES; ch1++)
+          for (int ch2 = 0; ch2 < CH_NAMES; ch2++)
+            if (rng.get_bool())
+              m[ch1][ch2] = rng.get_sample();
+
+        Mixer mixer(size);
+        mixer.set_auto_matrix(false);
+        mixer.set_matrix(m);
+        mixer.set_output(out_spk);
+        BOOST_REQUIRE(mixer.open(in_spk));
+        BOOST_CHECK_EQUAL(mixer.get_output().format, format);
+
+        for (size_t s = 0; s < size * in_nch; s++)
+          input[s] = T(rng.get_sample());
+        test = input;
+
+        Chunk in((uint8_t *)&test[0], size * in_nch * sizeof(T)), out;
+        BOOST_REQUIRE(mixer.process(in, out));
+        BOOST_REQUIRE_EQUAL(out.size, size * out_nch * sizeof(T));
+
+        const T *frames = (const T *)out.rawdata;
+        double diff = 0;
+        for (size_t s = 0; s < size; s++)
+          for (int out_ch = 0; out_ch < out_nch; out_ch++)
+          {
+            double ref = 0;
+            for (int in_ch = 0; in_ch < in_nch; in_ch++)
+              ref += input[s * in_nch + in_ch] * T(m[in_order[in_ch]][out_order[out_ch]]);
+            diff = MAX(diff, fabs(frames[s * out_nch + out_ch] - ref));
+          }
+
+        BOOST_CHECK_MESSAGE(diff < 1e-5, "Mixing " << in_spk.print() <<
+          " > " << out_spk.print() << " fails: diff = " << diff);
+      }
+
+  set_cpu_features_mask(cpu_all);
+}
+
+BOOST_AUTO_TEST_CASE(interleaved)
+{
+  // Both precisions are available regardless of sample_t
+  mix_interleaved<float>(FORMAT_INTERLEAVED_FLOAT);
+  mix_interleaved<double>(FORMAT_INTERLEAVED_DOUBLE);
+}
+
+BOOST_AUTO_TEST_CASE(interleaved_shared)
+{
+  // Inplace mixing of the shared buffer: output must keep the buffer alive
+  // when the input is released
+  static const size_t size = 1000;
+  const Speakers in_spk(FORMAT_INTERLEAVED_FLOAT, MODE_5_1, 48000);
+  const Speakers out_spk(FORMAT_LINEAR, MODE_STEREO, 48000);
+  const size_t in_bytes = size * in_spk.nch() * sizeof(float);
+  const size_t out_bytes = size * out_spk.nch() * sizeof(float);
+
+  RNG rng(seed);
+  std::vector<float> input(size * in_spk.nch());
+  for (size_t i = 0; i < input.size(); i++)
+    input[i] = float(rng.get_sample());
+
+  Mixer mixer(size);
+  mixer.set_output(out_spk);
+  BOOST_REQUIRE(mixer.open(in_spk));
+  BOOST_REQUIRE(!mixer.is_buffered());
+
+  // Reference output of not shared data
+  std::vector<float> ref(input);
+  Chunk ref_in((uint8_t *)&ref[0], in_bytes), ref_out;
+  BOOST_REQUIRE(mixer.process(ref_in, ref_out));
+  BOOST_REQUIRE_EQUAL(ref_out.size, out_bytes);
+
+  Chunk in((uint8_t *)&input[0], in_bytes), out;
+  in.share(0);
+  BOOST_REQUIRE(mixer.process(in, out));
+  BOOST_CHECK(in.buf.is_null());
+  BOOST_CHECK_EQUAL(out.buf.refs(), 1);
+  BOOST_CHECK(out.buf.contains(out.rawdata));
+  BOOST_REQUIRE_EQUAL(out.size, out_bytes);
+
+  // Freed block would be taken by the next allocation
+  uint8_t *block = (uint8_t *)pool_alloc(in_bytes + pool_align);
+  memset(block, 0xff, in_bytes + pool_align);
+  BOOST_CHECK(memcmp(out.rawdata, ref_out.rawdata, out_bytes) == 0);
+  pool_free(block);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
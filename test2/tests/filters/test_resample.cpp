@@ -4,6 +4,7 @@
 
 #include <boost/test/unit_test.hpp>
 #include "fir/param_fir.h"
+#include "filters/convert.h"
 #include "filters/convolver.h"
 #include "filters/filter_graph.h"
 #include "filters/resample.h"
@@ -183,6 +184,152 @@ BOOST_AUTO_TEST_CASE(passthrough)
   compare(&noise, &f, &ref);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Filter plans are built once per set of parameters and shared between
+// instances. Instances sharing the plan produce identical output.
+
+BOOST_AUTO_TEST_CASE(shared_plans)
+{
+  // Parameters not used by other tests
+  const double a = 97;
+  const double q = 0.985;
+  Speakers spk(FORMAT_LINEAR, MODE_STEREO, 44100);
+
+  size_t cache_size = Resample::cache_size();
+
+  Resample f1(48000, a, q);
+  Resample f2(48000, a, q);
+  BOOST_REQUIRE(f1.open(spk));
+  BOOST_CHECK_EQUAL(Resample::cache_size(), cache_size + 1);
+  BOOST_REQUIRE(f2.open(spk));
+  BOOST_CHECK_EQUAL(Resample::cache_size(), cache_size + 1);
+
+  // Reopen with the other channel count uses the same plan
+  BOOST_REQUIRE(f2.open(Speakers(FORMAT_LINEAR, MODE_5_1, 44100)));
+  BOOST_CHECK_EQUAL(Resample::cache_size(), cache_size + 1);
+  BOOST_REQUIRE(f2.open(spk));
+
+  NoiseGen noise1(spk, seed, block_size);
+  NoiseGen noise2(spk, seed, block_size);
+  compare(&noise1, &f1, &noise2, &f2);
+
+  // Other parameters make a new plan
+  f2.set_quality(0.98);
+  BOOST_REQUIRE(f2.open(spk));
+  BOOST_CHECK_EQUAL(Resample::cache_size(), cache_size + 2);
+}
+
+BOOST_AUTO_TEST_CASE(release_plans)
+{
+  // Plan is freed when the last filter using it is closed
+  Speakers spk(FORMAT_LINEAR, MODE_STEREO, 44100);
+  BOOST_CHECK_EQUAL(Resample::cache_size(), 0);
+  {
+    Resample f1(48000);
+    Resample f2(48000);
+    Resample f3(32000);
+    BOOST_REQUIRE(f1.open(spk));
+    BOOST_REQUIRE(f2.open(spk));
+    BOOST_REQUIRE(f3.open(spk));
+    BOOST_CHECK_EQUAL(Resample::cache_size(), 2);
+
+    f1.close();
+    BOOST_CHECK_EQUAL(Resample::cache_size(), 2);
+    f2.close();
+    BOOST_CHECK_EQUAL(Resample::cache_size(), 1);
+  }
+  BOOST_CHECK_EQUAL(Resample::cache_size(), 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Integer ratio path (half-band stages) must produce exactly the number of
+// samples expected for any stream length and be ready for the next stream
+// after flushing.
+
+BOOST_AUTO_TEST_CASE(integer_ratio)
+{
+  static const int rates[][2] =
+  {
+    { 96000, 48000 }, { 192000, 48000 }, { 48000, 96000 }, { 48000, 192000 }
+  };
+  static const size_t sizes[] = { 1, 4095, 4096, 10001 };
+
+  for (int i = 0; i < array_size(rates); i++)
+  {
+    Speakers spk(FORMAT_LINEAR, MODE_STEREO, rates[i][0]);
+    Resample f(rates[i][1], 100, 0.95);
+    BOOST_REQUIRE(f.open(spk));
+    BOOST_CHECK(f.info().find("Half-band") != string::npos);
+
+    for (int j = 0; j < array_size(sizes); j++)
+    {
+      NoiseGen noise(spk, seed, sizes[j], 1000);
+      uint64_t out_size = 0;
+      Chunk in, out;
+      while (noise.get_chunk(in))
+        while (f.process(in, out))
+          out_size += out.size;
+      while (f.flush(out))
+        out_size += out.size;
+
+      uint64_t expected = (uint64_t(sizes[j]) * rates[i][1] + rates[i][0] - 1) / rates[i][0];
+      BOOST_CHECK_MESSAGE(out_size == expected,
+        rates[i][0] << "Hz -> " << rates[i][1] << "Hz, " << sizes[j] <<
+        " samples: " << out_size << " != " << expected);
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Resample accepts linear data only. Interleaved float and double frames are
+// resampled through the conversion node inserted by the chain.
+
+BOOST_AUTO_TEST_CASE(interleaved)
+{
+  static const int rates[][2] =
+  {
+    { 96000, 48000 }, // half-band path
+    { 48000, 44100 }  // general path
+  };
+  static const int formats[] = { FORMAT_INTERLEAVED_FLOAT, FORMAT_INTERLEAVED_DOUBLE };
+
+  for (int i = 0; i < array_size(rates); i++)
+    for (int j = 0; j < array_size(formats); j++)
+    {
+      Speakers spk(FORMAT_LINEAR, MODE_5_1, rates[i][0]);
+      Converter to_frames(2048);
+      Resample tst_res(rates[i][1]);
+      Resample ref_res(rates[i][1]);
+      to_frames.set_format(formats[j]);
+
+      Speakers frames_spk = spk;
+      frames_spk.format = formats[j];
+      BOOST_CHECK(!tst_res.can_open(frames_spk));
+
+      FilterChain tst_chain(&to_frames, &tst_res);
+      BOOST_REQUIRE(tst_chain.open(spk));
+      BOOST_CHECK_EQUAL(tst_res.get_input().format, FORMAT_LINEAR);
+      BOOST_CHECK_EQUAL(tst_chain.get_output().sample_rate, rates[i][1]);
+
+      // Float frames add the rounding noise
+      NoiseGen tst_noise(spk, seed, block_size);
+      NoiseGen ref_noise(spk, seed, block_size);
+      double diff = calc_diff(&tst_noise, &tst_chain, &ref_noise, &ref_res);
+      BOOST_CHECK_MESSAGE(diff < 1e-6,
+        rates[i][0] << "Hz -> " << rates[i][1] << "Hz, " << format_text(formats[j]) << ": diff = " << diff);
+
+      // Frames of sample_t precision give exactly the same output
+      if (formats[j] == FORMAT_INTERLEAVED)
+      {
+        tst_chain.reset();
+        ref_res.reset();
+        tst_noise.reset();
+        ref_noise.reset();
+        compare(&tst_noise, &tst_chain, &ref_noise, &ref_res);
+      }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Resample reverse transform test
 // Resample is reversible when:
@@ -0,0 +1,200 @@
+/*
+  ThreadedFilter test
+*/
+
+#include <boost/test/unit_test.hpp>
+#include "filters/filter_graph.h"
+#include "filters/gain.h"
+#include "filters/resample.h"
+#include "filters/threaded_filter.h"
+#include "source/generator.h"
+#include "source/source_filter.h"
+#include "../../suite.h"
+
+static const int seed = 239847523;
+static const size_t noise_size = 65536;
+static const Speakers spk(FORMAT_LINEAR, MODE_5_1, 48000);
+
+// Filter that fails once after some number of chunks
+class FailFilter : public SamplesFilter
+{
+public:
+  int chunks;
+  int after_error; // number of chunks processed after the error
+  FailFilter(int chunks_): chunks(chunks_), after_error(0) {}
+
+  virtual bool process(Chunk &in, Chunk &out)
+  {
+    if (chunks-- == 0)
+      THROW(Error());
+    if (chunks < 0)
+      after_error++;
+    out = in;
+    in.clear();
+    return !out.is_dummy();
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(threaded_filter)
+
+BOOST_AUTO_TEST_CASE(constructor)
+{
+  Gain gain;
+  ThreadedFilter f1;
+  BOOST_CHECK(f1.get_filter() == 0);
+  BOOST_CHECK(!f1.can_open(spk));
+
+  ThreadedFilter f2(&gain, 8);
+  BOOST_CHECK(f2.get_filter() == &gain);
+  BOOST_CHECK_EQUAL(f2.get_queue_size(), 8);
+  BOOST_CHECK(f2.can_open(spk));
+}
+
+BOOST_AUTO_TEST_CASE(open_close)
+{
+  Gain gain;
+  ThreadedFilter f(&gain);
+
+  BOOST_CHECK(f.open(spk));
+  BOOST_CHECK(f.is_open());
+  BOOST_CHECK(gain.is_open());
+  BOOST_CHECK_EQUAL(f.get_input(), spk);
+  BOOST_CHECK_EQUAL(f.get_output(), spk);
+
+  f.close();
+  BOOST_CHECK(!f.is_open());
+  BOOST_CHECK(!gain.is_open());
+}
+
+BOOST_AUTO_TEST_CASE(process)
+{
+  Gain gain(0.5), ref_gain(0.5);
+  ThreadedFilter f(&gain);
+
+  NoiseGen src(spk, seed, noise_size);
+  NoiseGen ref(spk, seed, noise_size);
+  compare(&src, &f, &ref, &ref_gain);
+}
+
+BOOST_AUTO_TEST_CASE(pipeline)
+{
+  // Buffering filter in the middle of a two-stage pipeline.
+  // Output must match the same chain run on one thread.
+  Gain gain1(0.5), gain2(2.0), ref_gain1(0.5), ref_gain2(2.0);
+  Resample resample(44100), ref_resample(44100);
+
+  FilterChain stage1(&gain1, &resample);
+  ThreadedFilter t1(&stage1);
+  ThreadedFilter t2(&gain2);
+  FilterChain chain(&t1, &t2);
+  FilterChain ref_chain(&ref_gain1, &ref_resample, &ref_gain2);
+
+  NoiseGen src(spk, seed, noise_size);
+  NoiseGen ref(spk, seed, noise_size);
+  compare(&src, &chain, &ref, &ref_chain);
+}
+
+BOOST_AUTO_TEST_CASE(timestamps)
+{
+  // Timestamps must pass through unchanged for the immediate filter
+  Gain gain;
+  ThreadedFilter f(&gain);
+  f.open(spk);
+
+  NoiseGen src(spk, seed, noise_size, 1024);
+  Chunk in, out;
+  vtime_t time = 0;
+  size_t in_chunks = 0, out_chunks = 0;
+  while (src.get_chunk(in))
+  {
+    in.set_sync(true, time);
+    time += 1;
+    in_chunks++;
+    while (f.process(in, out))
+    {
+      BOOST_CHECK(out.sync);
+      BOOST_CHECK_EQUAL(out.time, vtime_t(out_chunks));
+      out_chunks++;
+    }
+  }
+  while (f.flush(out))
+  {
+    BOOST_CHECK(out.sync);
+    BOOST_CHECK_EQUAL(out.time, vtime_t(out_chunks));
+    out_chunks++;
+  }
+  BOOST_CHECK_EQUAL(in_chunks, out_chunks);
+}
+
+BOOST_AUTO_TEST_CASE(reset)
+{
+  Gain gain;
+  ThreadedFilter f(&gain);
+  f.open(spk);
+
+  // Fill the queues and reset
+  Chunk in, out;
+  NoiseGen src(spk, seed, noise_size, 1024);
+  for (int i = 0; i < 3 && src.get_chunk(in); i++)
+    f.process(in, out);
+  f.reset();
+  BOOST_CHECK(!f.new_stream());
+
+  // Nothing is left after reset
+  BOOST_CHECK(!f.flush(out));
+
+  // Process the stream after reset
+  Gain ref_gain;
+  NoiseGen src2(spk, seed, noise_size);
+  NoiseGen ref(spk, seed, noise_size);
+  compare(&src2, &f, &ref, &ref_gain);
+}
+
+BOOST_AUTO_TEST_CASE(error)
+{
+  FailFilter fail(2);
+  ThreadedFilter f(&fail);
+  f.open(spk);
+
+  NoiseGen src(spk, seed, noise_size, 1024);
+  SourceFilter sf(&src, &f);
+  Chunk chunk;
+  BOOST_CHECK_THROW({ while (sf.get_chunk(chunk)); }, Filter::Error);
+}
+
+BOOST_AUTO_TEST_CASE(drop_after_error)
+{
+  // Data queued after the error is not processed until reset
+  FailFilter fail(2);
+  ThreadedFilter f(&fail, 8);
+  BOOST_REQUIRE(f.open(spk));
+
+  NoiseGen src(spk, seed, noise_size, 1024);
+  Chunk in, out;
+  bool error = false;
+  try
+  {
+    while (src.get_chunk(in))
+      while (f.process(in, out));
+  }
+  catch (Filter::Error &)
+  {
+    error = true;
+  }
+  BOOST_CHECK(error);
+
+  f.reset();
+  BOOST_CHECK_EQUAL(fail.after_error, 0);
+
+  // Filter works after reset
+  NoiseGen src2(spk, seed, 4096, 1024);
+  size_t out_size = 0;
+  while (src2.get_chunk(in))
+    while (f.process(in, out))
+      out_size += out.size;
+  while (f.flush(out))
+    out_size += out.size;
+  BOOST_CHECK_EQUAL(out_size, 4096);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,90 @@
+/*
+  AC3 IMDCT test
+  Compare the batched transform with the single-channel one.
+*/
+
+#include <math.h>
+#include <string.h>
+#include <boost/test/unit_test.hpp>
+#include "parsers/ac3/ac3_imdct.h"
+#include "buffer.h"
+#include "cpu.h"
+#include "rng.h"
+
+static const int seed = 239784527;
+static const int nblocks = 10;
+
+BOOST_AUTO_TEST_SUITE(ac3_imdct)
+
+BOOST_AUTO_TEST_CASE(batch)
+{
+  RNG rng(seed);
+  IMDCT ref_imdct, test_imdct;
+
+  for (int nch = 1; nch <= 6; nch++)
+  {
+    SampleBuf ref_data(nch, 256), ref_delay(nch, 256);
+    SampleBuf test_data(nch, 256), test_delay(nch, 256);
+    ref_delay.zero();
+    test_delay.zero();
+
+    double max_diff = 0;
+    double max_level = 0;
+    for (int block = 0; block < nblocks; block++)
+    {
+      for (int ch = 0; ch < nch; ch++)
+        for (int i = 0; i < 256; i++)
+          ref_data[ch][i] = test_data[ch][i] = rng.get_sample();
+
+      for (int ch = 0; ch < nch; ch++)
+        ref_imdct.imdct_512(ref_data[ch], ref_delay[ch]);
+      samples_t d = test_data, dl = test_delay;
+      test_imdct.imdct_512(d.samples, dl.samples, nch);
+
+      for (int ch = 0; ch < nch; ch++)
+        for (int i = 0; i < 256; i++)
+        {
+          max_level = MAX(max_level, fabs(ref_data[ch][i]));
+          max_diff = MAX(max_diff, fabs(ref_data[ch][i] - test_data[ch][i]));
+          max_diff = MAX(max_diff, fabs(ref_delay[ch][i] - test_delay[ch][i]));
+        }
+    }
+
+#ifdef FLOAT_SAMPLE
+    BOOST_CHECK_LE(max_diff, max_level * 1e-6);
+#else
+    BOOST_CHECK_EQUAL(max_diff, 0);
+#endif
+  }
+}
+
+BOOST_AUTO_TEST_CASE(generic)
+{
+  // Batched transform without SIMD is the same as the single-channel one
+  const int nch = 3;
+  RNG rng(seed);
+  IMDCT ref_imdct, test_imdct;
+  SampleBuf ref_data(nch, 256), ref_delay(nch, 256);
+  SampleBuf test_data(nch, 256), test_delay(nch, 256);
+  ref_delay.zero();
+  test_delay.zero();
+
+  for (int ch = 0; ch < nch; ch++)
+    for (int i = 0; i < 256; i++)
+      ref_data[ch][i] = test_data[ch][i] = rng.get_sample();
+
+  set_cpu_features_mask(0);
+  for (int ch = 0; ch < nch; ch++)
+    ref_imdct.imdct_512(ref_data[ch], ref_delay[ch]);
+  samples_t d = test_data, dl = test_delay;
+  test_imdct.imdct_512(d.samples, dl.samples, nch);
+  set_cpu_features_mask(cpu_all);
+
+  for (int ch = 0; ch < nch; ch++)
+  {
+    BOOST_CHECK(memcmp(ref_data[ch], test_data[ch], 256 * sizeof(sample_t)) == 0);
+    BOOST_CHECK(memcmp(ref_delay[ch], test_delay[ch], 256 * sizeof(sample_t)) == 0);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
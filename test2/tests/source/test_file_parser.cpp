@@ -2,6 +2,7 @@
   FileParser class test
 */
 
+#include <string.h>
 #include <boost/test/unit_test.hpp>
 #include "parsers/ac3/ac3_header.h"
 #include "parsers/dts/dts_header.h"
@@ -260,6 +261,73 @@ BOOST_AUTO_TEST_CASE(open_probe_passthrough)
   compare(&f, &raw);
 }
 
+// Memory-mapped file gives the same frames
+BOOST_AUTO_TEST_CASE(mmap_passthrough)
+{
+  bool result;
+  const string filename = "a.ac3.03f.ac3";
+  AC3FrameParser frame_parser;
+
+  FileParser f;
+  RAWSource raw;
+
+  f.set_mmap(true);
+  result = f.open_probe(filename, &frame_parser);
+  BOOST_REQUIRE(result);
+  BOOST_CHECK(f.is_mapped());
+
+  result = raw.open(Speakers(FORMAT_RAWDATA, 0, 0), filename.c_str());
+  BOOST_REQUIRE(result);
+
+  compare(&f, &raw);
+  BOOST_CHECK(f.eof());
+}
+
+// Positioning works the same way for memory-mapped file
+BOOST_AUTO_TEST_CASE(mmap_positioning)
+{
+  bool result;
+  Chunk ref_chunk, mmap_chunk;
+  const string filename = "a.ac3.mix.ac3";
+  AC3FrameParser ref_parser, mmap_parser;
+  FileParser::fsize_t pos[] = { 0, 1000, 100000, 500000 };
+
+  FileParser ref, mmap;
+  mmap.set_mmap(true);
+  result = ref.open(filename, &ref_parser) && ref.stats();
+  BOOST_REQUIRE(result);
+  result = mmap.open(filename, &mmap_parser) && mmap.stats();
+  BOOST_REQUIRE(result);
+  BOOST_REQUIRE(mmap.is_mapped());
+
+  BOOST_CHECK_EQUAL(mmap.get_pos(), 0);
+  BOOST_CHECK_EQUAL(mmap.get_size(), ref.get_size());
+  BOOST_CHECK_GT(mmap.get_avg_frame_size(), 0.0);
+  BOOST_CHECK_GT(mmap.get_avg_bitrate(), 0.0);
+
+  for (int i = 0; i < array_size(pos); i++)
+  {
+    ref.seek(pos[i]);
+    mmap.seek(pos[i]);
+    BOOST_CHECK_EQUAL(mmap.get_pos(), pos[i]);
+
+    result = ref.probe();
+    BOOST_CHECK_EQUAL(mmap.probe(), result);
+    BOOST_CHECK(mmap.get_output() == ref.get_output());
+
+    for (int j = 0; j < 10; j++)
+    {
+      result = ref.get_chunk(ref_chunk);
+      BOOST_REQUIRE_EQUAL(mmap.get_chunk(mmap_chunk), result);
+      if (!result) break;
+
+      BOOST_CHECK_EQUAL(mmap.get_pos(), ref.get_pos());
+      BOOST_REQUIRE_EQUAL(mmap_chunk.size, ref_chunk.size);
+      BOOST_CHECK(memcmp(mmap_chunk.rawdata, ref_chunk.rawdata, ref_chunk.size) == 0);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(format_change)
 {
   bool result;
@@ -133,4 +133,143 @@ BOOST_AUTO_TEST_CASE(zero)
   BOOST_CHECK( buf[data_size-1] == 0 );
 }
 
+BOOST_AUTO_TEST_CASE(alignment)
+{
+  AutoBuf<uint8_t> buf;
+  for (size_t size = 1; size < 100000; size = size * 3 + 1)
+  {
+    buf.free();
+    buf.allocate(size);
+    BOOST_CHECK_EQUAL((size_t)buf.begin() % pool_align, 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(pool)
+{
+  // Freed memory is kept at the pool and reused
+  pool_release();
+  BOOST_CHECK_EQUAL(pool_cache_size(), 0);
+
+  AutoBuf<uint8_t> buf(data_size);
+  uint8_t *ptr = buf.begin();
+  buf.free();
+  BOOST_CHECK_GE(pool_cache_size(), data_size);
+
+  buf.allocate(data_size2 / 2 + 1);
+  BOOST_CHECK(buf.begin() == ptr);
+  BOOST_CHECK_EQUAL(pool_cache_size(), 0);
+
+  // Large blocks are not cached
+  buf.free();
+  pool_release();
+  buf.allocate(pool_max_block + 1);
+  buf.free();
+  BOOST_CHECK_EQUAL(pool_cache_size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(stat)
+{
+  // Reused blocks are counted as allocations but not as heap allocations
+  pool_release();
+  PoolStat stat1 = pool_stat();
+
+  AutoBuf<uint8_t> buf(data_size);
+  buf.free();
+  buf.allocate(data_size);
+
+  PoolStat stat2 = pool_stat();
+  BOOST_CHECK_EQUAL(stat2.allocs - stat1.allocs, 2);
+  BOOST_CHECK_EQUAL(stat2.heap_allocs - stat1.heap_allocs, 1);
+  BOOST_CHECK_GE(stat2.bytes - stat1.bytes, 2 * data_size);
+  BOOST_CHECK_GE(stat2.heap_bytes - stat1.heap_bytes, data_size);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(arena)
+
+static const size_t block_size = 4096;
+
+BOOST_AUTO_TEST_CASE(alloc)
+{
+  Arena arena(block_size);
+  BOOST_CHECK_EQUAL(arena.size(), 0);
+  BOOST_CHECK_EQUAL(arena.used(), 0);
+
+  uint8_t *p1 = (uint8_t *)arena.alloc(1);
+  uint8_t *p2 = (uint8_t *)arena.alloc(100);
+  BOOST_CHECK_EQUAL((size_t)p1 % pool_align, 0);
+  BOOST_CHECK(p2 == p1 + pool_align);
+  BOOST_CHECK_EQUAL(arena.size(), block_size);
+
+  // Allocation larger than the block
+  uint8_t *p3 = (uint8_t *)arena.alloc(block_size * 2);
+  BOOST_CHECK_EQUAL((size_t)p3 % pool_align, 0);
+  BOOST_CHECK_EQUAL(arena.size(), block_size * 3);
+
+  arena.release();
+  BOOST_CHECK_EQUAL(arena.size(), 0);
+  BOOST_CHECK_EQUAL(arena.used(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(rewind)
+{
+  Arena arena(block_size);
+  uint8_t *p1 = (uint8_t *)arena.alloc(100);
+  Arena::Mark mark = arena.mark();
+  size_t used = arena.used();
+
+  uint8_t *p2 = (uint8_t *)arena.alloc(100);
+  uint8_t *p3 = (uint8_t *)arena.alloc(block_size * 2);
+  size_t size = arena.size();
+
+  // Memory after the mark is reused without growing the arena
+  arena.rewind(mark);
+  BOOST_CHECK_EQUAL(arena.used(), used);
+  BOOST_CHECK(arena.alloc(100) == p2);
+  BOOST_CHECK(arena.alloc(block_size * 2) == p3);
+  BOOST_CHECK_EQUAL(arena.size(), size);
+
+  arena.reset();
+  BOOST_CHECK_EQUAL(arena.used(), 0);
+  BOOST_CHECK(arena.alloc(100) == p1);
+  BOOST_CHECK_EQUAL(arena.size(), size);
+}
+
+BOOST_AUTO_TEST_CASE(auto_buf)
+{
+  Arena arena;
+  AutoBuf<uint8_t> buf;
+
+  // Pool memory that fits is kept
+  buf.allocate(data_size);
+  uint8_t *ptr = buf.begin();
+  buf.allocate(data_size, &arena);
+  BOOST_CHECK(buf.begin() == ptr);
+  BOOST_CHECK(!buf.is_arena());
+  BOOST_CHECK_EQUAL(arena.used(), 0);
+
+  // Memory from the arena
+  buf.free();
+  buf.allocate(data_size, &arena);
+  BOOST_CHECK(buf.is_arena());
+  BOOST_CHECK_EQUAL(buf.size(), data_size);
+  BOOST_CHECK_GE(arena.used(), data_size);
+
+  // Arena memory is not reused without the arena, but the content is
+  // preserved on reallocation
+  memset(buf.begin(), 1, data_size);
+  ptr = buf.begin();
+  buf.reallocate(data_size / 2);
+  BOOST_CHECK(buf.begin() != ptr);
+  BOOST_CHECK(!buf.is_arena());
+  BOOST_CHECK_EQUAL(buf[data_size / 2 - 1], 1);
+
+  buf.allocate(data_size, &arena);
+  ptr = buf.begin();
+  buf.allocate(data_size);
+  BOOST_CHECK(buf.begin() != ptr);
+  BOOST_CHECK(!buf.is_arena());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -123,7 +123,29 @@ BOOST_AUTO_TEST_CASE(read_write)
   BOOST_REQUIRE_EQUAL(memfile.size(), temp_file_size);
   BOOST_CHECK(memcmp(memfile, write_data, temp_file_size) == 0);
 
+  {
+    MMapFile mapfile(temp_file);
+    BOOST_REQUIRE(mapfile.is_open());
+    BOOST_REQUIRE_EQUAL(mapfile.size(), temp_file_size);
+    BOOST_CHECK(memcmp(mapfile, write_data, temp_file_size) == 0);
+
+    // Changes of the mapped data are private
+    memset(mapfile, 0, temp_file_size);
+  }
+
+  MemFile memfile2(temp_file);
+  BOOST_REQUIRE_EQUAL(memfile2.size(), temp_file_size);
+  BOOST_CHECK(memcmp(memfile2, write_data, temp_file_size) == 0);
+
   remove(temp_file);
 }
 
+BOOST_AUTO_TEST_CASE(mmap_fail)
+{
+  MMapFile f(bad_file);
+  BOOST_CHECK(!f.is_open());
+  BOOST_CHECK_EQUAL(f.size(), 0);
+  BOOST_CHECK((uint8_t *)f == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -156,4 +156,22 @@ BOOST_AUTO_TEST_CASE(zero)
   BOOST_CHECK(buf[nch1-1][size1-1] == 0);
 }
 
+BOOST_AUTO_TEST_CASE(channel_stride)
+{
+  const size_t page = 4096 / sizeof(sample_t);
+  const size_t sizes[] = { 1, size1, size2, page, 2 * page };
+  for (int i = 0; i < array_size(sizes); i++)
+  {
+    SampleBuf buf(nch2, sizes[i]);
+    BOOST_CHECK_GE(buf.stride(), sizes[i]);
+    // Channel starts are aligned and do not share the cache set
+    BOOST_CHECK_NE((buf.stride() * sizeof(sample_t)) % 4096, 0);
+    for (int ch = 0; ch < nch2; ch++)
+    {
+      BOOST_CHECK_EQUAL((size_t)buf[ch] % pool_align, 0);
+      BOOST_CHECK(buf[ch] == buf[0] + ch * buf.stride());
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
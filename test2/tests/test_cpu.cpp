@@ -0,0 +1,51 @@
+/*
+  CPU features and denormal mode test
+*/
+
+#include <float.h>
+#include "cpu.h"
+#include <boost/test/unit_test.hpp>
+
+// Half of the smallest normal number is a denormal. Volatile prevents the
+// compiler from folding the operation.
+static double half_min()
+{
+  volatile double x = DBL_MIN;
+  volatile double y = x * 0.5;
+  return y;
+}
+
+BOOST_AUTO_TEST_SUITE(cpu)
+
+BOOST_AUTO_TEST_CASE(denormal_guard)
+{
+  if ((cpu_features() & cpu_sse2) == 0)
+    return;
+
+  BOOST_CHECK(half_min() != 0);
+  {
+    DenormalGuard guard;
+    BOOST_CHECK_EQUAL(half_min(), 0);
+    {
+      // Nested guard does not restore the mode of the outer one
+      DenormalGuard nested;
+      BOOST_CHECK_EQUAL(half_min(), 0);
+    }
+    BOOST_CHECK_EQUAL(half_min(), 0);
+  }
+  // Mode is restored
+  BOOST_CHECK(half_min() != 0);
+}
+
+BOOST_AUTO_TEST_CASE(denormal_guard_disabled)
+{
+  // Guard does nothing when SIMD is disabled
+  set_cpu_features_mask(0);
+  {
+    DenormalGuard guard;
+    BOOST_CHECK(half_min() != 0);
+  }
+  set_cpu_features_mask(cpu_all);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -4,6 +4,7 @@
 
 #include <boost/test/unit_test.hpp>
 #include "../noise_buf.h"
+#include "cpu.h"
 #include "crc.h"
 
 static const int seed = 3476032;
@@ -83,6 +84,68 @@ void bitstream_test(int poly, int power, const char *poly_name)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Test long messages (slicing-by-8 and carry-less multiplication)
+// * test all message lengths up to max_size
+// * test different message shifts
+// * test with and without SIMD
+
+static void long_message_test(int poly, int power, const char *poly_name)
+{
+  static const int max_size = 1100;
+  static const int max_shift = 8;
+  static const int features[] = { cpu_all, 0 };
+
+  BOOST_MESSAGE("Long message test with " << poly_name << " polinomial");
+
+  CRC crc(poly, power);
+  RawNoise buf(max_size + max_shift, seed);
+  uint32_t init_crc = 0x5a5a5a5a >> (32 - power);
+
+  for (int i = 0; i < array_size(features); i++)
+  {
+    set_cpu_features_mask(features[i]);
+    for (int shift = 0; shift < max_shift; shift++)
+    {
+      uint32_t ref_crc = init_crc;
+      for (int size = 0; size < max_size; size++)
+      {
+        // Test crc using byte stream interface
+        uint32_t test_crc = crc.calc(init_crc, buf + shift, size);
+
+        if (test_crc != ref_crc)
+        {
+          set_cpu_features_mask(cpu_all);
+          BOOST_FAIL("Fail at size = " << size << " shift = " << shift << " features = " << features[i]);
+        }
+
+        // Reference crc
+        ref_crc = crc.calc(ref_crc, buf[shift + size], 8);
+      }
+    }
+  }
+  set_cpu_features_mask(cpu_all);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Speed test
+// Calculate CRC of AC3 frame-sized messages
+
+static double speed_test(const CRC &crc, const uint8_t *data, size_t size, uint32_t &result)
+{
+  static const vtime_t time_per_test = 0.2;
+  CPUMeter cpu;
+  int runs = 0;
+
+  cpu.start();
+  while (cpu.get_thread_time() < time_per_test)
+    for (int i = 0; i < 100; i++, runs++)
+      result = crc.calc(0, data, size);
+  cpu.stop();
+
+  return double(size) * runs / cpu.get_thread_time() / 1000000;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 BOOST_AUTO_TEST_SUITE(crc)
@@ -110,4 +173,25 @@ BOOST_AUTO_TEST_CASE(bitstream)
   bitstream_test(POLY_CRC32, 32, "CRC32");
 }
 
+BOOST_AUTO_TEST_CASE(long_message)
+{
+  long_message_test(POLY_CRC16, 16, "CRC16");
+  long_message_test(POLY_CRC32, 32, "CRC32");
+}
+
+BOOST_AUTO_TEST_CASE(speed)
+{
+  static const size_t frame_size = 1792;
+  RawNoise buf(frame_size, seed);
+  uint32_t generic_crc, simd_crc;
+
+  set_cpu_features_mask(0);
+  double generic_speed = speed_test(crc16, buf, frame_size, generic_crc);
+  set_cpu_features_mask(cpu_all);
+  double simd_speed = speed_test(crc16, buf, frame_size, simd_crc);
+
+  BOOST_MESSAGE("CRC16 speed: generic " << int(generic_speed) << "MB/s, SIMD " << int(simd_speed) << "MB/s");
+  BOOST_CHECK_EQUAL(generic_crc, simd_crc);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -3,6 +3,7 @@
 */
 
 #include <boost/test/unit_test.hpp>
+#include "cpu.h"
 #include "iir.h"
 #include "../noise_buf.h"
 
@@ -10,6 +11,37 @@ static const int sample_rate = 48000;
 static const int seed = 3498756;
 static const size_t noise_size = 1024;
 
+// Stable sections of different kinds to build test cascades
+static const Biquad test_sections[] =
+{
+  Biquad(1.0, -1.8, 0.85, 1.0, 0.5, 0.2),
+  Biquad(1.0, -1.2, 0.5, 0.3, -0.2, 0.1),
+  Biquad(2.0, 0.4, 0.3, 1.0, 1.0, 0.0),
+  Biquad(1.0, 0.9, 0.2, 1.0, -1.0, 0.5),
+  Biquad(1.0, -0.5, 0.0, 0.5, 0.0, 0.0)
+};
+
+// Direct form 1 reference implementation
+static void iir_reference(const IIRInstance &iir, sample_t *samples, size_t size)
+{
+  for (size_t i = 0; i < size; i++)
+    samples[i] *= iir.gain;
+
+  for (size_t k = 0; k < iir.sections.size(); k++)
+  {
+    const Biquad &b = iir.sections[k];
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+      double x = samples[i];
+      double y = (b.b[0] * x + b.b[1] * x1 + b.b[2] * x2 - b.a[1] * y1 - b.a[2] * y2) / b.a[0];
+      x2 = x1; x1 = x;
+      y2 = y1; y1 = y;
+      samples[i] = y;
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE(iir)
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -394,6 +426,162 @@ BOOST_AUTO_TEST_CASE(running_average_filter)
   BOOST_CHECK_LT(diff, SAMPLE_THRESHOLD);
 }
 
+BOOST_AUTO_TEST_CASE(cascade_filter)
+{
+  // Process by chunks of different size to check the pipeline ends
+  static const size_t chunk_sizes[] = { 1, 2, 3, 5, 100, noise_size };
+
+  for (size_t n = 1; n <= array_size(test_sections); n++)
+  {
+    IIRInstance iir(sample_rate, 0.5);
+    iir.sections.assign(test_sections, test_sections + n);
+
+    SamplesNoise reference(noise_size, seed);
+    iir_reference(iir, reference, noise_size);
+
+    for (size_t c = 0; c < array_size(chunk_sizes); c++)
+    {
+      SamplesNoise signal(noise_size, seed);
+      IIRFilter f(&iir);
+      for (size_t pos = 0; pos < noise_size; pos += chunk_sizes[c])
+        f.process(signal + pos, MIN(chunk_sizes[c], noise_size - pos));
+
+      sample_t diff = peak_diff(signal, reference, noise_size);
+      BOOST_CHECK_MESSAGE(diff < SAMPLE_THRESHOLD,
+        "sections = " << n << " chunk size = " << chunk_sizes[c] << " diff = " << diff);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(denormals)
+{
+  // Impulse response decays to exact zero
+  IIRInstance iir(sample_rate);
+  iir.sections.assign(test_sections, test_sections + array_size(test_sections));
+  IIRFilter f(&iir);
+
+  Samples signal(noise_size);
+  signal.zero();
+  signal[0] = 1.0;
+  f.process(signal, noise_size);
+  BOOST_CHECK(signal[0] != 0);
+
+  for (int i = 0; i < 100; i++)
+  {
+    signal.zero();
+    f.process(signal, noise_size);
+  }
+  Samples reference(noise_size);
+  reference.zero();
+  BOOST_CHECK_EQUAL(peak_diff(signal, reference, noise_size), 0.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+///////////////////////////////////////////////////////////////////////////////
+// IIRMultiFilter
+///////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE(iir_multi_filter)
+
+BOOST_AUTO_TEST_CASE(trivial_filters)
+{
+  const int nch = 4;
+  IIRInstance zero(sample_rate, 0.0);
+  IIRInstance identity(sample_rate);
+  IIRInstance gain(sample_rate, 2.0);
+  const IIRInstance *iir[nch] = { 0, &zero, &identity, &gain };
+  const double ch_gain[nch] = { 1.0, 0.0, 1.0, 2.0 };
+
+  SampleBufNoise signal(nch, noise_size, seed);
+  SampleBufNoise reference(nch, noise_size, seed);
+  for (int ch = 0; ch < nch; ch++)
+    gain_samples(ch_gain[ch], reference[ch], noise_size);
+
+  IIRMultiFilter f;
+  BOOST_CHECK(f.init(nch, iir));
+  f.process(signal, noise_size);
+  for (int ch = 0; ch < nch; ch++)
+    BOOST_CHECK_EQUAL(peak_diff(signal[ch], reference[ch], noise_size), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(multichannel)
+{
+  // Each channel has its own number of sections, so groups are padded
+  // and some lanes are spare. Compare with single-channel filters.
+  static const size_t chunk_sizes[] = { 1, 7, 300, noise_size };
+  const int nch = NCHANNELS;
+  IIRInstance *iir[nch];
+  IIRFilter ref_filter[nch];
+
+  for (int ch = 0; ch < nch; ch++)
+  {
+    iir[ch] = new IIRInstance(sample_rate, 1.0 + ch * 0.1);
+    size_t n = ch % (array_size(test_sections) + 1);
+    iir[ch]->sections.assign(test_sections, test_sections + n);
+    ref_filter[ch].init(iir[ch]);
+  }
+
+  for (int nch_used = 1; nch_used <= nch; nch_used++)
+    for (size_t c = 0; c < array_size(chunk_sizes); c++)
+    {
+      SampleBufNoise signal(nch, noise_size, seed);
+      SampleBufNoise reference(nch, noise_size, seed);
+
+      IIRMultiFilter f;
+      BOOST_REQUIRE(f.init(nch_used, iir));
+      for (size_t pos = 0; pos < noise_size; pos += chunk_sizes[c])
+        f.process(signal.samples() + pos, MIN(chunk_sizes[c], noise_size - pos));
+
+      for (int ch = 0; ch < nch_used; ch++)
+      {
+        ref_filter[ch].reset();
+        ref_filter[ch].process(reference[ch], noise_size);
+        sample_t diff = peak_diff(signal[ch], reference[ch], noise_size);
+        BOOST_CHECK_MESSAGE(diff < SAMPLE_THRESHOLD,
+          "nch = " << nch_used << " ch = " << ch << " chunk size = " << chunk_sizes[c]);
+      }
+    }
+
+  for (int ch = 0; ch < nch; ch++)
+    delete iir[ch];
+}
+
+BOOST_AUTO_TEST_CASE(generic_code)
+{
+  // SIMD and generic code produce the same result
+  const int nch = NCHANNELS;
+  IIRInstance iir(sample_rate);
+  iir.sections.assign(test_sections, test_sections + array_size(test_sections));
+
+  SampleBufNoise signal(nch, noise_size, seed);
+  SampleBufNoise reference(nch, noise_size, seed);
+
+  IIRMultiFilter f;
+  IIRFilter f1;
+  for (int simd = 0; simd < 2; simd++)
+  {
+    SampleBuf &buf = simd? signal: reference;
+    set_cpu_features_mask(simd? cpu_all: 0);
+    f.init(nch - 1, &iir);
+    f.process(buf, noise_size);
+    f1.init(&iir);
+    f1.process(buf[nch - 1], noise_size);
+  }
+  set_cpu_features_mask(cpu_all);
+
+  for (int ch = 0; ch < nch; ch++)
+    BOOST_CHECK_LT(peak_diff(signal[ch], reference[ch], noise_size), SAMPLE_THRESHOLD);
+}
+
+BOOST_AUTO_TEST_CASE(infinity)
+{
+  IIRInstance iir(sample_rate);
+  iir.sections.push_back(Biquad(0, 0, 0, 1.0, 0, 0));
+  IIRMultiFilter f;
+  BOOST_CHECK(!f.init(2, &iir));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
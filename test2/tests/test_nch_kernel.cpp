@@ -0,0 +1,113 @@
+/*
+  Channel count specialized kernels test
+  Kernels must give exactly the same result as generic functions for any
+  number of channels.
+*/
+
+#include <string.h>
+#include "nch_kernel.h"
+#include "buffer.h"
+#include "rng.h"
+#include <boost/test/unit_test.hpp>
+
+static const int seed = 490239;
+static const size_t size = 1027;
+
+static void fill_noise(SampleBuf &buf, int nch)
+{
+  RNG rng(seed);
+  buf.allocate(nch, size);
+  for (int ch = 0; ch < nch; ch++)
+    rng.fill_samples(buf[ch], size);
+}
+
+static bool equal(const SampleBuf &buf1, const SampleBuf &buf2, int nch)
+{
+  for (int ch = 0; ch < nch; ch++)
+    if (memcmp(buf1[ch], buf2[ch], size * sizeof(sample_t)) != 0)
+      return false;
+  return true;
+}
+
+BOOST_AUTO_TEST_SUITE(nch_kernel_test)
+
+BOOST_AUTO_TEST_CASE(dispatch)
+{
+  gain_kernel_t kernel;
+
+  kernel = nch_kernel<GainKernel, gain_kernel_t>(0);
+  BOOST_CHECK(kernel == 0);
+  kernel = nch_kernel<GainKernel, gain_kernel_t>(NCHANNELS + 1);
+  BOOST_CHECK(kernel == 0);
+  kernel = nch_kernel<GainKernel, gain_kernel_t>(1);
+  BOOST_CHECK(kernel == &GainKernel<1>::process);
+  kernel = nch_kernel<GainKernel, gain_kernel_t>(NCHANNELS);
+  BOOST_CHECK(kernel == &GainKernel<NCHANNELS>::process);
+}
+
+BOOST_AUTO_TEST_CASE(kernels)
+{
+  const sample_t gain1 = 0.3;
+  const sample_t gain2 = 1.7;
+
+  SampleBuf w;
+  fill_noise(w, 2);
+
+  for (int nch = 1; nch <= NCHANNELS; nch++)
+  {
+    SampleBuf test, ref;
+
+    // Gain
+    fill_noise(test, nch);
+    fill_noise(ref, nch);
+    (*nch_kernel<GainKernel, gain_kernel_t>(nch))(test, size, gain1);
+    gain_samples(gain1, ref, nch, size);
+    BOOST_CHECK_MESSAGE(equal(test, ref, nch), "gain, nch = " << nch);
+
+    // Window
+    fill_noise(test, nch);
+    fill_noise(ref, nch);
+    (*nch_kernel<WindowKernel, window_kernel_t>(nch))(test, size, gain1, w[0], gain2, w[1]);
+    for (int ch = 0; ch < nch; ch++)
+      for (size_t i = 0; i < size; i++)
+        ref[ch][i] = ref[ch][i] * (gain1 * w[0][i] + gain2 * w[1][i]);
+    BOOST_CHECK_MESSAGE(equal(test, ref, nch), "window, nch = " << nch);
+
+    // Clip
+    fill_noise(test, nch);
+    fill_noise(ref, nch);
+    (*nch_kernel<ClipKernel, clip_kernel_t>(nch))(test, size, 0.5);
+    for (int ch = 0; ch < nch; ch++)
+      for (size_t i = 0; i < size; i++)
+        ref[ch][i] = MAX(-0.5, MIN(0.5, ref[ch][i]));
+    BOOST_CHECK_MESSAGE(equal(test, ref, nch), "clip, nch = " << nch);
+
+    // Peak
+    sample_t max[NCHANNELS];
+    fill_noise(ref, nch);
+    (*nch_kernel<PeakKernel, peak_kernel_t>(nch))(max, ref, size);
+    for (int ch = 0; ch < nch; ch++)
+      BOOST_CHECK_EQUAL(max[ch], max_samples(0, ref[ch], size));
+
+    // Peak of interleaved frames
+    sample_t ref_max[NCHANNELS];
+    const sample_t *frames = ref[0];
+    size_t nframes = size / nch;
+    (*nch_kernel<PeakFramesKernel, peak_frames_kernel_t>(nch))(max, frames, nframes);
+    max_frames(ref_max, frames, nch, nframes);
+    for (int ch = 0; ch < nch; ch++)
+      BOOST_CHECK_EQUAL(max[ch], ref_max[ch]);
+
+    // Sum of squares
+    (*nch_kernel<SumSquaresKernel, sum_squares_kernel_t>(nch))(max, ref, size);
+    for (int ch = 0; ch < nch; ch++)
+    {
+      sample_t sum = 0;
+      for (size_t i = 0; i < size; i++)
+        sum += ref[ch][i] * ref[ch][i];
+      BOOST_CHECK_EQUAL(max[ch], sum);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+/*
+  SharedBuf class and shared chunk data test
+*/
+
+#include <string.h>
+#include "shared_buf.h"
+#include "chunk.h"
+#include "buffer.h"
+#include "rng.h"
+#include "filters/gain.h"
+#include <boost/test/unit_test.hpp>
+
+static const int seed = 5908234;
+static const size_t size = 1000;
+
+BOOST_AUTO_TEST_SUITE(shared_buf)
+
+BOOST_AUTO_TEST_CASE(constructor)
+{
+  SharedBuf buf;
+  BOOST_CHECK(buf.is_null());
+  BOOST_CHECK(buf.begin() == 0);
+  BOOST_CHECK_EQUAL(buf.size(), 0);
+  BOOST_CHECK_EQUAL(buf.refs(), 0);
+  BOOST_CHECK(!buf.is_shared());
+}
+
+BOOST_AUTO_TEST_CASE(refs)
+{
+  SharedBuf buf1(size);
+  BOOST_CHECK(buf1.begin() != 0);
+  BOOST_CHECK_EQUAL(buf1.size(), size);
+  BOOST_CHECK_EQUAL(buf1.refs(), 1);
+  BOOST_CHECK_EQUAL((size_t)buf1.begin() % pool_align, 0);
+  BOOST_CHECK(buf1.contains(buf1.begin() + size));
+  BOOST_CHECK(!buf1.contains(buf1.begin() + size + 1));
+
+  {
+    SharedBuf buf2(buf1);
+    SharedBuf buf3;
+    buf3 = buf2;
+    BOOST_CHECK(buf2.begin() == buf1.begin());
+    BOOST_CHECK(buf3.begin() == buf1.begin());
+    BOOST_CHECK_EQUAL(buf1.refs(), 3);
+    BOOST_CHECK(buf1.is_shared());
+
+    buf3 = buf3;
+    BOOST_CHECK_EQUAL(buf1.refs(), 3);
+    buf3.release();
+    BOOST_CHECK(buf3.is_null());
+    BOOST_CHECK_EQUAL(buf1.refs(), 2);
+  }
+
+  BOOST_CHECK_EQUAL(buf1.refs(), 1);
+  BOOST_CHECK(!buf1.is_shared());
+}
+
+BOOST_AUTO_TEST_CASE(chunk_share)
+{
+  RNG rng(seed);
+  SampleBuf data(2, size);
+  rng.fill_samples(data[0], size);
+  rng.fill_samples(data[1], size);
+
+  // Data is copied once into the shared buffer
+  Chunk chunk(data, size, true, 1.0);
+  chunk.share(2);
+  BOOST_CHECK(!chunk.buf.is_null());
+  BOOST_CHECK(chunk.samples[0] != data[0]);
+  BOOST_CHECK(memcmp(chunk.samples[0], data[0], size * sizeof(sample_t)) == 0);
+  BOOST_CHECK(memcmp(chunk.samples[1], data[1], size * sizeof(sample_t)) == 0);
+
+  // Copies refer to the same data
+  Chunk copy = chunk;
+  BOOST_CHECK(copy.is_shared());
+  BOOST_CHECK(copy.samples[0] == chunk.samples[0]);
+
+  // Setting new data releases the buffer
+  copy.set_linear(data, size);
+  BOOST_CHECK(copy.buf.is_null());
+  BOOST_CHECK(!chunk.is_shared());
+
+  // Rawdata
+  Chunk raw((uint8_t *)data[0], 100);
+  raw.share(0);
+  BOOST_CHECK(raw.rawdata != (uint8_t *)data[0]);
+  BOOST_CHECK(memcmp(raw.rawdata, data[0], 100) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(copy_on_write)
+{
+  RNG rng(seed);
+  SampleBuf data(2, size);
+  rng.fill_samples(data[0], size);
+  rng.fill_samples(data[1], size);
+
+  Chunk held(data, size);
+  held.share(2);
+  held.drop_samples(10);
+
+  // Inplace filter gets the copy of the chunk kept by another holder
+  Gain gain(2.0);
+  BOOST_REQUIRE(gain.open(Speakers(FORMAT_LINEAR, MODE_STEREO, 48000)));
+
+  Chunk in = held, out;
+  BOOST_REQUIRE(gain.process(in, out));
+  BOOST_CHECK(!out.is_shared());
+  BOOST_CHECK(!held.is_shared());
+  BOOST_CHECK(out.samples[0] != held.samples[0]);
+  BOOST_CHECK_EQUAL(out.size, size - 10);
+
+  // Held data is not changed, output is gained
+  for (int ch = 0; ch < 2; ch++)
+  {
+    BOOST_CHECK(memcmp(held.samples[ch], data[ch] + 10, (size - 10) * sizeof(sample_t)) == 0);
+    for (size_t i = 0; i < out.size; i++)
+      if (out.samples[ch][i] != held.samples[ch][i] * 2)
+      {
+        BOOST_ERROR("Wrong output at ch = " << ch << " i = " << i);
+        break;
+      }
+  }
+
+  // Not shared data is changed inplace
+  Chunk in2 = out, out2;
+  out.clear();
+  sample_t *ptr = in2.samples[0];
+  BOOST_REQUIRE(gain.process(in2, out2));
+  BOOST_CHECK(out2.samples[0] == ptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
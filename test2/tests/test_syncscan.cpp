@@ -4,6 +4,7 @@
 
 #include <boost/test/unit_test.hpp>
 #include "../noise_buf.h"
+#include "cpu.h"
 #include "syncscan.h"
 
 using std::string;
@@ -464,6 +465,25 @@ BOOST_AUTO_TEST_SUITE_END()
 // SyncScan test
 ///////////////////////////////////////////////////////////////////////////////
 
+// Syncpoints of real formats (AC3, DTS, MPA) and all of them together
+static SyncTrie format_trie(int i)
+{
+  SyncTrie ac3 = SyncTrie(0x0b77, 16) | SyncTrie(0x770b, 16);
+  SyncTrie dts =
+    SyncTrie(0x7ffe8001, 32) | SyncTrie(0xfe7f0180, 32) |
+    SyncTrie(0x1fffe800, 32) | SyncTrie(0xff1f00e8, 32);
+  SyncTrie mpa = SyncTrie(0xfff, 12) + SyncTrie::any + SyncTrie(0, 1);
+  switch (i)
+  {
+    case 0: return ac3;
+    case 1: return dts;
+    case 2: return mpa;
+    default: return ac3 | dts | mpa;
+  }
+}
+
+static const char *format_name[] = { "AC3", "DTS", "MPA", "AC3+DTS+MPA" };
+
 BOOST_AUTO_TEST_SUITE(sync_scan)
 
 BOOST_AUTO_TEST_CASE(constructor)
@@ -546,4 +566,82 @@ BOOST_AUTO_TEST_CASE(scan_pos)
     }
 }
 
+// SIMD scan finds the same syncpoints as the generic one
+BOOST_AUTO_TEST_CASE(simd)
+{
+  static const size_t size = 100000;
+  static const uint8_t syncpoints[][4] = {
+    { 0x0b, 0x77, 0, 0 }, { 0x77, 0x0b, 0, 0 },
+    { 0x7f, 0xfe, 0x80, 0x01 }, { 0xff, 0x1f, 0x00, 0xe8 },
+    { 0xff, 0xf0, 0, 0 }
+  };
+
+  RawNoise buf(size, seed);
+  for (int i = 0; i < 1000; i++)
+  {
+    size_t pos = buf.rng.get_range(size - 4);
+    memcpy(buf + pos, syncpoints[i % array_size(syncpoints)], 4);
+  }
+
+  for (int i = 0; i < array_size(format_name); i++)
+  {
+    SyncScan s(format_trie(i));
+    for (size_t start = 0; start < 64; start++)
+    {
+      size_t ref_pos = start, test_pos = start;
+      int syncpoints_found = 0;
+      while (true)
+      {
+        set_cpu_features_mask(0);
+        bool ref_result = s.scan_pos(buf, size, ref_pos);
+        set_cpu_features_mask(cpu_all);
+        bool test_result = s.scan_pos(buf, size, test_pos);
+
+        BOOST_REQUIRE_EQUAL(test_result, ref_result);
+        BOOST_REQUIRE_EQUAL(test_pos, ref_pos);
+        if (!ref_result) break;
+
+        syncpoints_found++;
+        ref_pos++;
+        test_pos++;
+      }
+      BOOST_CHECK(syncpoints_found > 0);
+    }
+  }
+}
+
+// Scan speed over noise
+BOOST_AUTO_TEST_CASE(speed)
+{
+  static const size_t size = 1024 * 1024;
+  static const vtime_t time_per_test = 0.2;
+  RawNoise buf(size, seed);
+
+  for (int i = 0; i < array_size(format_name); i++)
+  {
+    SyncScan s(format_trie(i));
+    double speed[2];
+    for (int simd = 0; simd < 2; simd++)
+    {
+      set_cpu_features_mask(simd? cpu_all: 0);
+
+      CPUMeter cpu;
+      int runs = 0;
+      cpu.start();
+      while (cpu.get_thread_time() < time_per_test)
+      {
+        size_t pos = 0;
+        while (s.scan_pos(buf, size, pos))
+          pos++;
+        runs++;
+      }
+      cpu.stop();
+      speed[simd] = double(size) * runs / cpu.get_thread_time() / 1000000;
+    }
+    set_cpu_features_mask(cpu_all);
+
+    BOOST_MESSAGE(format_name[i] << " scan speed: generic " << int(speed[0]) << "MB/s, SIMD " << int(speed[1]) << "MB/s");
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
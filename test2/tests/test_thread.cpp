@@ -0,0 +1,224 @@
+/*
+  Thread, CritSec, Event, AtomicInt and CPUMeter classes test
+*/
+
+#include <boost/test/unit_test.hpp>
+#include "cpu.h"
+#include "thread.h"
+
+static const int nthreads = 4;
+static const int niterations = 100000;
+
+// Counts iterations, protecting the counter with the critical section
+class CounterThread : public Thread
+{
+public:
+  CritSec *lock;
+  volatile int *counter;
+  AtomicInt *atomic;
+
+  CounterThread(): lock(0), counter(0), atomic(0)
+  {}
+
+protected:
+  virtual unsigned long process()
+  {
+    for (int i = 0; i < niterations; i++)
+    {
+      AutoLock auto_lock(lock);
+      (*counter)++;
+      atomic->increment();
+    }
+    return 0;
+  }
+};
+
+// Waits for events until terminated
+class WaitThread : public Thread
+{
+public:
+  Event event;
+  AtomicInt wakeups;
+
+protected:
+  virtual unsigned long process()
+  {
+    while (!f_terminate)
+      if (event.wait(10))
+        wakeups.increment();
+    return 0;
+  }
+};
+
+// Spins for the given time
+class BusyThread : public Thread
+{
+public:
+  CPUMeter cpu;
+  vtime_t busy_time;
+
+  BusyThread(vtime_t busy_time_): busy_time(busy_time_)
+  {}
+
+protected:
+  virtual unsigned long process()
+  {
+    cpu.start();
+    while (cpu.get_system_time() < busy_time)
+      ;
+    cpu.stop();
+    return 0;
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(thread)
+
+BOOST_AUTO_TEST_CASE(create_terminate)
+{
+  WaitThread t;
+  BOOST_CHECK(!t.thread_exists());
+  BOOST_CHECK(t.suspended());
+
+  BOOST_CHECK(t.create(false));
+  BOOST_CHECK(t.thread_exists());
+  BOOST_CHECK(!t.suspended());
+  BOOST_CHECK(!t.terminating());
+
+  t.terminate(1000);
+  BOOST_CHECK(!t.thread_exists());
+
+  // Create again
+  BOOST_CHECK(t.create(false));
+  BOOST_CHECK(t.thread_exists());
+  t.terminate(1000);
+  BOOST_CHECK(!t.thread_exists());
+}
+
+BOOST_AUTO_TEST_CASE(suspended)
+{
+  WaitThread t;
+  BOOST_CHECK(t.create(true));
+  BOOST_CHECK(t.suspended());
+
+  // Suspended thread does not process events
+  t.event.set();
+  Event timer;
+  timer.wait(50);
+  BOOST_CHECK_EQUAL(t.wakeups.get(), 0);
+
+  t.resume();
+  BOOST_CHECK(!t.suspended());
+  for (int i = 0; i < 100 && t.wakeups.get() == 0; i++)
+    timer.wait(10);
+  BOOST_CHECK_EQUAL(t.wakeups.get(), 1);
+  t.terminate(1000);
+}
+
+BOOST_AUTO_TEST_CASE(event)
+{
+  Event event;
+
+  // Timeout
+  BOOST_CHECK(!event.wait(0));
+  BOOST_CHECK(!event.wait(10));
+
+  // Event stays signaled until wait
+  event.set();
+  BOOST_CHECK(event.wait(0));
+
+  // Auto-reset
+  BOOST_CHECK(!event.wait(0));
+}
+
+BOOST_AUTO_TEST_CASE(atomic)
+{
+  AtomicInt a;
+  BOOST_CHECK_EQUAL(a.get(), 0);
+  a.set(10);
+  BOOST_CHECK_EQUAL(a.get(), 10);
+  BOOST_CHECK_EQUAL(a.increment(), 11);
+  BOOST_CHECK_EQUAL(a.decrement(), 10);
+  BOOST_CHECK(!a.compare_and_set(11, 20));
+  BOOST_CHECK_EQUAL(a.get(), 10);
+  BOOST_CHECK(a.compare_and_set(10, 20));
+  BOOST_CHECK_EQUAL(a.get(), 20);
+}
+
+BOOST_AUTO_TEST_CASE(lock)
+{
+  CritSec lock;
+  volatile int counter = 0;
+  AtomicInt atomic;
+
+  CounterThread threads[nthreads];
+  for (int i = 0; i < nthreads; i++)
+  {
+    threads[i].lock = &lock;
+    threads[i].counter = &counter;
+    threads[i].atomic = &atomic;
+  }
+
+  for (int i = 0; i < nthreads; i++)
+    BOOST_REQUIRE(threads[i].create(false));
+
+  for (int i = 0; i < nthreads; i++)
+    threads[i].terminate(10000);
+
+  BOOST_CHECK_EQUAL(counter, nthreads * niterations);
+  BOOST_CHECK_EQUAL(atomic.get(), nthreads * niterations);
+
+  // Recursive lock
+  lock.lock();
+  lock.lock();
+  lock.unlock();
+  lock.unlock();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+///////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE(cpu_meter)
+
+BOOST_AUTO_TEST_CASE(constructor)
+{
+  CPUMeter cpu;
+  BOOST_CHECK(cpu.get_number_of_cpus() >= 1);
+  BOOST_CHECK_EQUAL(cpu.get_thread_time(), 0);
+  BOOST_CHECK_EQUAL(cpu.get_system_time(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(measure)
+{
+  // Busy thread uses about 100% of one core
+  const vtime_t busy_time = 0.2;
+  BusyThread t(busy_time);
+  BOOST_REQUIRE(t.create(false));
+  t.terminate(10000);
+
+  vtime_t thread_time = t.cpu.get_thread_time();
+  vtime_t system_time = t.cpu.get_system_time();
+  BOOST_CHECK_GE(system_time, busy_time);
+  BOOST_CHECK_GT(thread_time, 0);
+  BOOST_CHECK_LE(thread_time, system_time * 1.1);
+  BOOST_CHECK_GT(t.cpu.mean_usage(), 0);
+
+  t.cpu.reset();
+  BOOST_CHECK_EQUAL(t.cpu.get_thread_time(), 0);
+  BOOST_CHECK_EQUAL(t.cpu.get_system_time(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(idle)
+{
+  // Sleeping thread uses almost no CPU time
+  CPUMeter cpu;
+  Event timer;
+  cpu.start();
+  timer.wait(100);
+  cpu.stop();
+
+  BOOST_CHECK_GE(cpu.get_system_time(), 0.09);
+  BOOST_CHECK_LT(cpu.get_thread_time(), cpu.get_system_time() / 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
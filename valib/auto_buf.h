@@ -8,7 +8,9 @@
 #define VALIB_AUTO_BUF_H
 
 #include <string.h>
+#include <new>
 #include "defs.h"
+#include "mem_pool.h"
 
 /**************************************************************************//**
   \class AutoBuf
@@ -18,6 +20,11 @@
   the buffer without excessive memory allocations. Buffer grows only when
   nessesary and does not actually shrink.
 
+  Memory is taken from the buffer pool (see pool_alloc()), so the buffer is
+  aligned at pool_align bytes and the memory of freed buffers is reused.
+  Allocated size is rounded up to the pool block size. Only POD types are
+  supported: constructors and destructors of elements are not called.
+
   Does not allow assignment and ownership transfers.
   Strictly exception-safe.
 
@@ -34,11 +41,17 @@
   \fn AutoBuf::~AutoBuf()
     Frees the memory allocated.
 
-  \fn T *AutoBuf::allocate(size_t size)
-    \param size The size of the buffer to allocate
+  \fn T *AutoBuf::allocate(size_t size, Arena *arena = 0)
+    \param size  The size of the buffer to allocate
+    \param arena Arena to take the memory from (null to use the pool)
 
     Allocate at least 'size' elements of type T. Previous content of the buffer
     may be lost.
+
+    Memory taken from the arena belongs to the arena and is valid until the
+    arena is rewound (see Arena). The buffer does not reuse it after this:
+    the next allocate() without an arena or reallocate() takes new memory
+    from the pool.
     Can throw std::bad_alloc.
 
   \fn T *AutoBuf::reallocate(size_t size)
@@ -74,6 +87,9 @@
   \fn bool AutoBuf::is_allocated() const
     Returns true when buffer is allocated.
 
+  \fn bool AutoBuf::is_arena() const
+    Returns true when the memory belongs to an arena.
+
   \fn T *AutoBuf::begin() const
     Pointer to the beginning of the buffer
 
@@ -91,16 +107,25 @@ private:
   T *f_buf;
   size_t f_size;
   size_t f_allocated;
+  bool f_arena;         // memory belongs to an arena
 
   // Non-copyable
   AutoBuf(const AutoBuf &);
   AutoBuf &operator =(const AutoBuf &);
 
+  // Give the memory back to the pool; arena memory is just dropped
+  inline void release() throw()
+  {
+    if (!f_arena)
+      pool_free(f_buf);
+    f_arena = false;
+  }
+
 public:
-  AutoBuf(): f_buf(0), f_size(0), f_allocated(0)
+  AutoBuf(): f_buf(0), f_size(0), f_allocated(0), f_arena(false)
   {}
 
-  AutoBuf(size_t size): f_buf(0), f_size(0), f_allocated(0)
+  AutoBuf(size_t size): f_buf(0), f_size(0), f_allocated(0), f_arena(false)
   {
     allocate(size);
   }
@@ -110,15 +135,31 @@ public:
     free();
   }
 
-  inline T *allocate(size_t size)
+  inline T *allocate(size_t size, Arena *arena = 0)
   {
-    if (f_allocated < size)
+    if (arena && (f_arena || f_allocated < size))
     {
-      T *new_buf = new T[size];
+      if (size > size_t(-1) / sizeof(T))
+        throw std::bad_alloc();
+
+      T *new_buf = (T *)arena->alloc(size * sizeof(T));
       // no exceptions after this point
-      safe_delete(f_buf);
+      release();
       f_buf = new_buf;
       f_allocated = size;
+      f_arena = true;
+    }
+    else if (f_arena || f_allocated < size)
+    {
+      if (size > size_t(-1) / sizeof(T))
+        throw std::bad_alloc();
+
+      size_t bytes;
+      T *new_buf = (T *)pool_alloc(size * sizeof(T), &bytes);
+      // no exceptions after this point
+      release();
+      f_buf = new_buf;
+      f_allocated = bytes / sizeof(T);
     }
     f_size = size;
     return f_buf;
@@ -126,14 +167,19 @@ public:
 
   inline T *reallocate(size_t size)
   {
-    if (f_allocated < size)
+    if (f_arena || f_allocated < size)
     {
-      T *new_buf = new T[size];
-      memcpy(new_buf, f_buf, f_size * sizeof(T));
+      if (size > size_t(-1) / sizeof(T))
+        throw std::bad_alloc();
+
+      size_t bytes;
+      T *new_buf = (T *)pool_alloc(size * sizeof(T), &bytes);
+      if (f_buf)
+        memcpy(new_buf, f_buf, MIN(f_size, size) * sizeof(T));
       // no exceptions after this point
-      safe_delete(f_buf);
+      release();
       f_buf = new_buf;
-      f_allocated = size;
+      f_allocated = bytes / sizeof(T);
     }
     f_size = size;
     return f_buf;
@@ -141,7 +187,8 @@ public:
 
   inline void free() throw()
   {
-    safe_delete(f_buf);
+    release();
+    f_buf = 0;
     f_size = 0;
     f_allocated = 0;
   }
@@ -155,6 +202,7 @@ public:
   inline size_t size()       const { return f_size; }
   inline size_t allocated()  const { return f_allocated; }
   inline bool is_allocated() const { return f_buf != 0; }
+  inline bool is_arena()     const { return f_arena; }
 
   inline T *begin()    const { return f_buf; }
   inline T *end()      const { return f_buf + f_size; }
@@ -1,6 +1,15 @@
 #include <limits>
 #include "auto_file.h"
 
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#endif
+
 #if defined(_MSC_VER) && (_MSC_VER >= 1400)
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -114,3 +123,84 @@ MemFile::~MemFile()
 {
   safe_delete(data);
 }
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _WIN32
+
+bool
+MMapFile::open(const char *filename)
+{
+  close();
+
+  HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, 0,
+    OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER filesize;
+  if (GetFileSizeEx(file, &filesize) && filesize.QuadPart > 0 && !AutoFile::is_large(filesize.QuadPart))
+  {
+    HANDLE mapping = CreateFileMapping(file, 0, PAGE_WRITECOPY, 0, 0, 0);
+    if (mapping)
+    {
+      // The view keeps the mapping alive
+      data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+      if (data)
+        file_size = AutoFile::size_cast(filesize.QuadPart);
+      CloseHandle(mapping);
+    }
+  }
+
+  CloseHandle(file);
+  return is_open();
+}
+
+void
+MMapFile::close()
+{
+  if (data)
+    UnmapViewOfFile(data);
+  data = 0;
+  file_size = 0;
+}
+
+#else
+
+bool
+MMapFile::open(const char *filename)
+{
+  close();
+
+  int fd = ::open(filename, O_RDONLY);
+  if (fd == -1)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0 && !AutoFile::is_large(st.st_size))
+  {
+    size_t map_size = AutoFile::size_cast(st.st_size);
+    void *map = mmap(0, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED)
+    {
+      madvise(map, map_size, MADV_SEQUENTIAL);
+      data = map;
+      file_size = map_size;
+    }
+  }
+
+  // The mapping remains valid after the file is closed
+  ::close(fd);
+  return is_open();
+}
+
+void
+MMapFile::close()
+{
+  if (data)
+    munmap(data, file_size);
+  data = 0;
+  file_size = 0;
+}
+
+#endif
@@ -233,4 +233,77 @@ public:
   inline operator uint8_t *() const { return (uint8_t *)data; }
 };
 
+/**************************************************************************//**
+  \class MMapFile
+  \brief Map the whole file into memory.
+
+  File is mapped read-only with copy-on-write access: the mapped data may be
+  modified inplace, but changes are private and never written to the file.
+  The system is advised that the file is accessed sequentially.
+
+  The file must fit the address space, i.e. large files cannot be mapped on
+  32bit systems. Empty files cannot be mapped too.
+
+  \fn MMapFile::MMapFile()
+    Create the object without mapping a file.
+
+  \fn MMapFile::MMapFile(const char *filename)
+    \param filename File name to map.
+
+    Create the object and map the file. In case of failure, is_open() reports
+    false.
+
+  \fn MMapFile::~MMapFile()
+    Unmap the file.
+
+  \fn bool MMapFile::open(const char *filename)
+    \param filename File name to map.
+    \return Returns true on success and false otherwise.
+
+    Map the file.
+
+  \fn void MMapFile::close()
+    Unmap the file.
+
+  \fn bool MMapFile::is_open() const
+    \return Returns true when the file is mapped and false otherwise.
+
+  \fn size_t MMapFile::size() const
+    \return The size of the file mapped.
+    Returns 0 when file was not mapped.
+
+  \fn MMapFile::operator uint8_t *() const
+    \return Pointer to the start of the mapping.
+    Returns 0 when file was not mapped.
+
+******************************************************************************/
+
+class MMapFile
+{
+protected:
+  void *data;
+  size_t file_size;
+
+  // Non-copyable
+  MMapFile(const MMapFile &);
+  MMapFile &operator =(const MMapFile &);
+
+public:
+  MMapFile(): data(0), file_size(0)
+  {}
+
+  MMapFile(const char *filename): data(0), file_size(0)
+  { open(filename); }
+
+  ~MMapFile()
+  { close(); }
+
+  bool open(const char *filename);
+  void close();
+
+  inline bool   is_open() const { return data != 0; }
+  inline size_t size() const { return file_size; }
+  inline operator uint8_t *() const { return (uint8_t *)data; }
+};
+
 #endif
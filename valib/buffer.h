@@ -32,6 +32,11 @@ typedef AutoBuf<sample_t> Samples;
   This class is exception safe. But not strictly safe, because reallocate()
   does not preserve the content on exception.
 
+  Channels are placed at one memory block. Each channel starts at pool_align
+  boundary, so SIMD code may use aligned loads at channel starts. When the
+  channel size is a multiple of 4K, one more cache line is added to the
+  channel, so channel starts do not map to the same cache set.
+
   \fn SampleBuf::SampleBuf()
     Default constructor. Does not allocate the buffer.
 
@@ -46,9 +51,10 @@ typedef AutoBuf<sample_t> Samples;
 
     Can throw std::bad_alloc.
 
-  \fn void SampleBuf::allocate(unsigned nch, size_t nsamples)
+  \fn void SampleBuf::allocate(unsigned nch, size_t nsamples, Arena *arena = 0)
     \param nch      Number of channels to allocate
     \param nsamples Number of samples per channel
+    \param arena    Arena to take the memory from (see AutoBuf::allocate())
 
     Allocate the buffer for 'nch' channels, 'nsamples' samples each. Preserves
     the data at the buffer if possible. When buffer grows, new space is
@@ -79,6 +85,13 @@ typedef AutoBuf<sample_t> Samples;
   \fn size_t SampleBuf::nsamples() const
     \return Returns the number of samples allocated for each channel.
 
+  \fn size_t SampleBuf::stride() const
+    \return Returns the distance between channel starts (in samples).
+
+  \fn static size_t SampleBuf::channel_stride(size_t nsamples)
+    \return Returns the distance between channel starts for the channel
+    size given.
+
   \fn samples_t SampleBuf::samples() const
     \return Returns sample_t structure that points inside the buffer.
 
@@ -102,71 +115,95 @@ class SampleBuf
 protected:
   unsigned  f_nch;      ///< Number of channels
   size_t    f_nsamples; ///< Number of samples per channel
+  size_t    f_stride;   ///< Distance between channel starts
   samples_t f_samples;  ///< Channel buffers pointers
 
   Samples   f_buf;      ///< Data buffer
 
 public:
-  SampleBuf(): f_nch(0), f_nsamples(0)
+  SampleBuf(): f_nch(0), f_nsamples(0), f_stride(0)
   {}
 
-  SampleBuf(unsigned nch, size_t nsamples): f_nch(0), f_nsamples(0)
+  SampleBuf(unsigned nch, size_t nsamples): f_nch(0), f_nsamples(0), f_stride(0)
   {
     allocate(nch, nsamples);
   }
 
-  inline void allocate(unsigned nch, size_t nsamples)
+  static size_t channel_stride(size_t nsamples)
+  {
+    const size_t align = pool_align / sizeof(sample_t);
+    const size_t page = 4096 / sizeof(sample_t);
+    if (nsamples > size_t(-1) - 2 * align)
+      throw std::bad_alloc();
+
+    size_t stride = (nsamples + align - 1) & ~(align - 1);
+    if (stride % page == 0)
+      stride += align;
+    return stride;
+  }
+
+  inline void allocate(unsigned nch, size_t nsamples, Arena *arena = 0)
   {
+    size_t stride = channel_stride(nsamples);
+    if (nch && stride > size_t(-1) / nch)
+      throw std::bad_alloc();
+
     // f_buf is exception-safe, so just try to allocate
-    f_buf.allocate(nch * nsamples);
+    f_buf.allocate(nch * stride, arena);
 
     f_nch = nch;
     f_nsamples = nsamples;
+    f_stride = stride;
     f_samples.zero();
     for (unsigned ch = 0; ch < nch; ch++)
-      f_samples[ch] = f_buf.begin() + ch * nsamples;
+      f_samples[ch] = f_buf.begin() + ch * stride;
   }
 
   inline void reallocate(unsigned nch, size_t nsamples)
   {
     unsigned ch;
     unsigned min_nch = MIN(f_nch, nch);
+    size_t stride = channel_stride(nsamples);
+    size_t keep = MIN(f_nsamples, nsamples);
+    if (nch && stride > size_t(-1) / nch)
+      throw std::bad_alloc();
 
     // Compact data before reallocation
-    if (min_nch > 1 && nsamples < f_nsamples)
+    if (stride < f_stride)
       for (ch = 1; ch < min_nch; ch++)
-        move_samples(f_buf, ch * nsamples, f_buf, ch * f_nsamples, nsamples);
+        move_samples(f_buf, ch * stride, f_buf, ch * f_stride, keep);
 
     // Reallocate
-    f_buf.reallocate(nch * nsamples);
+    f_buf.reallocate(nch * stride);
 
     // Expand data after reallocation
-    // Zero the tail
-    if (min_nch > 1 && nsamples > f_nsamples)
-    {
+    if (stride > f_stride && min_nch > 1)
       for (ch = min_nch - 1; ch > 0; ch--)
-      {
-        move_samples(f_buf, ch * nsamples, f_buf, ch * f_nsamples, f_nsamples);
-        zero_samples(f_buf, ch * nsamples + f_nsamples, nsamples - f_nsamples);
-      }
-      zero_samples(f_buf, f_nsamples, nsamples - f_nsamples);
-    }
+        move_samples(f_buf, ch * stride, f_buf, ch * f_stride, keep);
+
+    // Zero the tail
+    if (nsamples > f_nsamples)
+      for (ch = 0; ch < min_nch; ch++)
+        zero_samples(f_buf, ch * stride + f_nsamples, nsamples - f_nsamples);
 
     // Zero new channels
     if (nch > f_nch)
-      zero_samples(f_buf, f_nch * nsamples, (nch - f_nch) * nsamples);
+      zero_samples(f_buf, f_nch * stride, (nch - f_nch) * stride);
 
     // Update state
     f_nch = nch;
     f_nsamples = nsamples;
+    f_stride = stride;
+    f_samples.zero();
     for (ch = 0; ch < nch; ch++)
-      f_samples[ch] = f_buf.begin() + ch * nsamples;
+      f_samples[ch] = f_buf.begin() + ch * stride;
   }
 
   inline void free()
   {
     f_nch = 0;
     f_nsamples = 0;
+    f_stride = 0;
     f_samples.zero();
     f_buf.free();
   }
@@ -178,6 +215,7 @@ public:
 
   inline unsigned  nch()      const { return f_nch;      }
   inline size_t    nsamples() const { return f_nsamples; }
+  inline size_t    stride()   const { return f_stride;   }
   inline samples_t samples()  const { return f_samples;  }
   inline bool is_allocated()  const { return f_buf.is_allocated(); }
 
@@ -0,0 +1,46 @@
+#include <string.h>
+#include "chunk.h"
+
+void
+Chunk::share(int nch)
+{
+  if (!buf.is_null() || size == 0)
+    return;
+
+  if (rawdata)
+  {
+    buf.allocate(size);
+    memcpy(buf.begin(), rawdata, size);
+    rawdata = buf.begin();
+  }
+  else
+  {
+    buf.allocate(nch * size * sizeof(sample_t));
+    sample_t *ptr = (sample_t *)buf.begin();
+    for (int ch = 0; ch < nch; ch++, ptr += size)
+    {
+      memcpy(ptr, samples[ch], size * sizeof(sample_t));
+      samples[ch] = ptr;
+    }
+  }
+}
+
+void
+Chunk::make_writable()
+{
+  if (!buf.is_shared())
+    return;
+
+  // The whole buffer is copied, so all data pointers of the chunk remain
+  // valid after the move (a chunk may refer to a part of the buffer only)
+  SharedBuf copy(buf.size());
+  memcpy(copy.begin(), buf.begin(), buf.size());
+
+  if (buf.contains(rawdata))
+    rawdata = copy.begin() + (rawdata - buf.begin());
+  for (int ch = 0; ch < NCHANNELS; ch++)
+    if (buf.contains(samples[ch]))
+      samples[ch] = (sample_t *)(copy.begin() + ((uint8_t *)samples[ch] - buf.begin()));
+
+  buf = copy;
+}
@@ -7,6 +7,7 @@
 #define VALIB_CHUNK_H
 
 #include "spk.h"
+#include "shared_buf.h"
 #include <string>
 
 /**************************************************************************//**
@@ -44,6 +45,20 @@
     head of a next frame, time should be applied to the first sample of the new
     frame.
 
+  \var SharedBuf Chunk::buf;
+    Optional reference to the buffer that holds the data of the chunk.
+
+    Chunk data is normally valid only until the next call to the producer
+    (see \ref filter_by_buffering "buffering model"). When the data is placed
+    into a reference-counted buffer, a copy of the chunk keeps the data alive,
+    so the stream may be passed to several consumers (and kept by them)
+    without copying. The reference is copied with the chunk, kept by
+    drop_rawdata() and drop_samples() and released by clear(), set_linear()
+    and set_rawdata().
+
+    Shared data must not be changed. Inplace filters call make_writable()
+    before changing the data (copy-on-write).
+
   \fn Chunk::Chunk()
     Constructs a dummy chunk with no data and no timestamp.
 
@@ -111,6 +126,23 @@
 
     Drops some data from the beginning of the chunk.
     Move raw sample pointers ahead by drop_size samples.
+
+  \fn bool Chunk::is_shared() const
+    Returns true when the data of the chunk is referenced by other holders.
+
+  \fn void Chunk::share(int nch)
+    \param nch Number of channels (for linear format data)
+
+    Places the data into a reference-counted buffer, so copies of the chunk
+    may keep it. Does nothing if the data is in a buffer already. Otherwise
+    the data is copied once: rawdata (size bytes) or nch channels of size
+    samples. Can throw std::bad_alloc.
+
+  \fn void Chunk::make_writable()
+    Makes the data of the chunk safe to change. When the buffer is shared,
+    it is copied, and data pointers are moved into the copy. Other holders
+    keep the original data. Does nothing for chunks without a buffer.
+    Can throw std::bad_alloc.
 ******************************************************************************/
 
 class Chunk
@@ -126,6 +158,8 @@ public:
   bool      sync;
   vtime_t   time;
 
+  SharedBuf buf;
+
   /////////////////////////////////////////////////////////
   // Utilities
 
@@ -166,6 +200,7 @@ public:
 
   inline void clear()
   {
+    buf.release();
     rawdata = 0;
     samples.zero();
     size = 0;
@@ -176,6 +211,7 @@ public:
   inline void set_linear(samples_t samples_, size_t size_,
     bool sync_ = false, vtime_t time_ = 0)
   {
+    buf.release();
     rawdata = 0;
     samples = samples_;
     size = size_;
@@ -186,6 +222,7 @@ public:
   inline void set_rawdata(uint8_t *rawdata_, size_t size_,
     bool sync_ = false, vtime_t time_ = 0)
   {
+    buf.release();
     samples.zero();
     rawdata = rawdata_;
     size = size_;
@@ -231,6 +268,14 @@ public:
     sync = false;
   };
 
+  inline bool is_shared() const
+  {
+    return buf.is_shared();
+  }
+
+  void share(int nch);
+  void make_writable();
+
   inline bool operator ==(const Chunk &other) const
   {
     return
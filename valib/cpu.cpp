@@ -0,0 +1,328 @@
+#include "cpu.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#ifdef VALIB_SSE2
+#include <xmmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define VALIB_CPUID
+static void cpuid(int func, int regs[4]) { __cpuid(regs, func); }
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <cpuid.h>
+#define VALIB_CPUID
+static void cpuid(int func, int regs[4])
+{
+  unsigned a = 0, b = 0, c = 0, d = 0;
+  __get_cpuid(func, &a, &b, &c, &d);
+  regs[0] = a; regs[1] = b; regs[2] = c; regs[3] = d;
+}
+#endif
+
+static const int64_t clock_freq = 10000000; // 100ns units
+
+///////////////////////////////////////////////////////////////////////////////
+// Platform-dependent clocks
+
+#ifdef _WIN32
+
+CPUMeter::CPUMeter()
+{
+  SYSTEM_INFO sysinfo;
+  memset(&sysinfo, 0, sizeof(sysinfo));
+  GetSystemInfo(&sysinfo);
+  ncpus = sysinfo.dwNumberOfProcessors;
+  if (ncpus == 0) ncpus = 1;
+
+  thread = 0;
+  running = false;
+  reset();
+}
+
+CPUMeter::~CPUMeter()
+{
+  if (thread)
+    CloseHandle(thread);
+}
+
+bool
+CPUMeter::get_thread_clock(int64_t &time) const
+{
+  __int64 creation_time;
+  __int64 exit_time;
+  __int64 kernel_time;
+  __int64 user_time;
+
+  if (!thread || !GetThreadTimes(thread,
+         (FILETIME*)&creation_time,
+         (FILETIME*)&exit_time,
+         (FILETIME*)&kernel_time,
+         (FILETIME*)&user_time))
+    return false;
+
+  time = kernel_time + user_time;
+  return true;
+}
+
+int64_t
+CPUMeter::get_system_clock() const
+{
+  LARGE_INTEGER counter, freq;
+  if (!QueryPerformanceFrequency(&freq) || !QueryPerformanceCounter(&counter))
+  {
+    __int64 ft;
+    SYSTEMTIME st;
+    GetSystemTime(&st);
+    SystemTimeToFileTime(&st, (FILETIME *)&ft);
+    return ft;
+  }
+
+  // Avoid overflow of counter * clock_freq
+  return (counter.QuadPart / freq.QuadPart) * clock_freq +
+         (counter.QuadPart % freq.QuadPart) * clock_freq / freq.QuadPart;
+}
+
+void
+CPUMeter::start()
+{
+  if (running)
+    stop();
+
+  DuplicateHandle(GetCurrentProcess(), GetCurrentThread(), GetCurrentProcess(), &thread, 0, true, DUPLICATE_SAME_ACCESS);
+  running = true;
+
+  system_time_start = get_system_clock();
+  if (!get_thread_clock(thread_time_begin))
+    thread_time_begin = 0;
+}
+
+void
+CPUMeter::stop()
+{
+  if (!running)
+    return;
+
+  update_thread_time();
+  system_time_total += get_system_clock() - system_time_start;
+
+  CloseHandle(thread);
+  thread = 0;
+  running = false;
+  thread_time_begin = 0;
+}
+
+#else
+
+CPUMeter::CPUMeter()
+{
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  ncpus = n > 0? int(n): 1;
+
+  running = false;
+  reset();
+}
+
+CPUMeter::~CPUMeter()
+{}
+
+bool
+CPUMeter::get_thread_clock(int64_t &time) const
+{
+  timespec ts;
+  if (!running || clock_gettime(thread, &ts) != 0)
+    return false;
+
+  time = int64_t(ts.tv_sec) * clock_freq + ts.tv_nsec / 100;
+  return true;
+}
+
+int64_t
+CPUMeter::get_system_clock() const
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return int64_t(ts.tv_sec) * clock_freq + ts.tv_nsec / 100;
+}
+
+void
+CPUMeter::start()
+{
+  if (running)
+    stop();
+
+  running = pthread_getcpuclockid(pthread_self(), &thread) == 0;
+
+  system_time_start = get_system_clock();
+  if (!get_thread_clock(thread_time_begin))
+    thread_time_begin = 0;
+}
+
+void
+CPUMeter::stop()
+{
+  if (!running)
+    return;
+
+  update_thread_time();
+  system_time_total += get_system_clock() - system_time_start;
+
+  running = false;
+  thread_time_begin = 0;
+}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Common part
+
+void
+CPUMeter::update_thread_time()
+{
+  int64_t time;
+  if (!running)
+    return;
+
+  if (get_thread_clock(time))
+  {
+    thread_time       += time - thread_time_begin;
+    thread_time_total += time - thread_time_begin;
+    thread_time_begin  = time;
+  }
+  else
+  {
+    thread_time = 0;
+    thread_time_begin = 0;
+  }
+}
+
+void
+CPUMeter::reset()
+{
+  system_time_begin = get_system_clock();
+  system_time_start = system_time_begin;
+
+  thread_time = 0;
+  thread_time_begin = 0;
+  thread_time_total = 0;
+  system_time_total = 0;
+  if (running && !get_thread_clock(thread_time_begin))
+    thread_time_begin = 0;
+}
+
+double
+CPUMeter::usage()
+{
+  int64_t system_time_end = get_system_clock();
+  double result;
+
+  update_thread_time();
+  if (system_time_end != system_time_begin)
+    result = double(thread_time) / double(system_time_end - system_time_begin) / ncpus;
+  else
+    result = 0;
+
+  thread_time = 0;
+  system_time_begin = system_time_end;
+  return result;
+}
+
+vtime_t
+CPUMeter::get_thread_time()
+{
+  update_thread_time();
+  return vtime_t(thread_time_total) / clock_freq;
+}
+
+vtime_t
+CPUMeter::get_system_time()
+{
+  if (running)
+    return vtime_t(system_time_total + get_system_clock() - system_time_start) / clock_freq;
+  else
+    return vtime_t(system_time_total) / clock_freq;
+}
+
+int
+CPUMeter::get_number_of_cpus()
+{
+  return ncpus;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// CPU features detection
+
+static int detect_cpu_features()
+{
+  int features = 0;
+#ifdef VALIB_CPUID
+  int regs[4];
+  cpuid(0, regs);
+  if (regs[0] < 1)
+    return 0;
+
+  cpuid(1, regs);
+  if (regs[3] & (1 << 26)) features |= cpu_sse2;
+  if (regs[2] & (1 << 9))  features |= cpu_ssse3;
+  if (regs[2] & (1 << 19)) features |= cpu_sse41;
+  if (regs[2] & (1 << 1))  features |= cpu_pclmul;
+  // All processors with SSE3 support DAZ
+  if (regs[2] & (1 << 0))  features |= cpu_daz;
+#endif
+  return features;
+}
+
+// Detection result is the same for all threads,
+// so the race on the first call is harmless.
+static int features_detected = -1;
+static int features_mask = cpu_all;
+
+int cpu_features()
+{
+  if (features_detected == -1)
+    features_detected = detect_cpu_features();
+  return features_detected & features_mask;
+}
+
+void set_cpu_features_mask(int mask)
+{
+  features_mask = mask;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DenormalGuard
+
+static const unsigned int mxcsr_ftz = 0x8000;
+static const unsigned int mxcsr_daz = 0x0040;
+
+DenormalGuard::DenormalGuard(): saved_mode(0), changed(false)
+{
+#ifdef VALIB_SSE2
+  int features = cpu_features();
+  if (features & cpu_sse2)
+  {
+    unsigned int mode = mxcsr_ftz;
+    if (features & cpu_daz)
+      mode |= mxcsr_daz;
+
+    saved_mode = _mm_getcsr();
+    if ((saved_mode & mode) != mode)
+    {
+      _mm_setcsr(saved_mode | mode);
+      changed = true;
+    }
+  }
+#endif
+}
+
+DenormalGuard::~DenormalGuard()
+{
+#ifdef VALIB_SSE2
+  if (changed)
+    _mm_setcsr(saved_mode);
+#endif
+}
@@ -0,0 +1,193 @@
+/**************************************************************************//**
+  \file cpu.h
+  \brief CPUMeter: CPU usage measurement; CPU features detection
+******************************************************************************/
+
+#ifndef VALIB_CPU_H
+#define VALIB_CPU_H
+
+#include "defs.h"
+#include "vtime.h"
+
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <time.h>
+#endif
+
+/**************************************************************************//**
+  \class CPUMeter
+  \brief Measures time used by a thread and calculates its CPU usage.
+
+  The thread measured marks the code to measure with start() and stop() calls.
+  Monitor thread (it may be other thread than the thread measured) may ask for
+  the statistics at any time, including the time in between of start() and
+  stop() calls.
+
+  Thread time is the CPU time (kernel + user) used by the thread measured.
+  System time is the wall-clock time. Both are measured with high-resolution
+  clocks: Win32 uses GetThreadTimes() and QueryPerformanceCounter(), other
+  platforms use POSIX per-thread CPU clock and the monotonic clock.
+
+  \fn void CPUMeter::start()
+    Start the measurement. Must be called by the thread measured.
+
+  \fn void CPUMeter::stop()
+    Stop the measurement. Must be called by the thread measured.
+
+  \fn void CPUMeter::reset()
+    Reset counters.
+
+  \fn double CPUMeter::usage()
+    Mean CPU usage since the last usage() call. Only thread time spent in
+    between of start() and stop() calls is counted. This call resets time
+    counters.
+
+  \fn vtime_t CPUMeter::get_thread_time()
+    Thread time spent in between of start() and stop() calls since the last
+    reset() call (in seconds).
+
+  \fn vtime_t CPUMeter::get_system_time()
+    System time spent in between of start() and stop() calls since the last
+    reset() call (in seconds).
+
+  \fn int CPUMeter::get_number_of_cpus()
+    Number of processors.
+
+  \fn double CPUMeter::mean_usage()
+    Mean CPU usage since the last reset() call. Only thread time spent in
+    between of start() and stop() calls is counted. This call does not reset
+    time counters.
+
+******************************************************************************/
+
+class CPUMeter
+{
+private:
+#ifdef _WIN32
+  HANDLE    thread;           // monitored thread handle copy (can be used by other threads)
+#else
+  clockid_t thread;           // monitored thread's CPU clock (can be used by other threads)
+#endif
+  bool      running;          // we're in between of start() and stop() calls
+  int       ncpus;            // number of processors
+
+  // All times are in 100ns units
+  int64_t  thread_time;       // thread time spent in between of usage() calls
+  int64_t  system_time_begin; // system time of previous usage() call
+  int64_t  thread_time_begin; // thread time we start measure
+  int64_t  thread_time_total; // total thread time spent
+
+  int64_t  system_time_start; // time we start measure
+  int64_t  system_time_total; // total system time spent in between of start() and stop() calls
+
+  bool     get_thread_clock(int64_t &time) const;
+  int64_t  get_system_clock() const;
+  void     update_thread_time();
+
+public:
+  CPUMeter();
+  ~CPUMeter();
+
+  // methods to be called by thread measured
+  void    start();
+  void    stop();
+
+  // methods to be called by monitor thread
+  void    reset();
+  double  usage();
+
+  vtime_t get_thread_time();
+  vtime_t get_system_time();
+  int     get_number_of_cpus();
+
+  double  mean_usage()
+  {
+    vtime_t system_time = get_system_time();
+    return system_time > 0? get_thread_time() / system_time: 0;
+  };
+};
+
+/**************************************************************************//**
+  \defgroup cpu_features CPU features detection
+
+  SIMD code is compiled in when the compiler supports the instruction set
+  (VALIB_SSE2 is defined), and it is called only when the processor supports
+  it. Code selects the implementation at runtime with cpu_features().
+
+  \fn int cpu_features()
+    Returns the mask of instruction set extensions supported by the processor
+    (cpu_sse2, cpu_ssse3, ...). Detection is done once at the first call.
+    Features disabled with set_cpu_features_mask() are not reported.
+
+  \fn void set_cpu_features_mask(int mask)
+    \param mask Mask of features allowed to use.
+
+    Limit features reported by cpu_features(). Allows to test and benchmark
+    the generic code on a processor with SIMD extensions. Call
+    set_cpu_features_mask(cpu_all) to allow all features.
+
+  PCLMULQDQ (and SSSE3 used with it) code is compiled when VALIB_PCLMUL is
+  defined. Such functions must be marked with VALIB_TARGET_PCLMUL.
+
+******************************************************************************/
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#  define VALIB_SSE2
+#endif
+
+// Instruction sets beyond SSE2 are compiled only for functions marked with
+// the VALIB_TARGET_xxx attribute (GCC requires it to use the intrinsics).
+#if defined(_MSC_VER) && _MSC_VER >= 1500 && (defined(_M_IX86) || defined(_M_X64))
+#  define VALIB_PCLMUL
+#  define VALIB_TARGET_PCLMUL
+#elif defined(__GNUC__) && defined(__SSE2__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#  define VALIB_PCLMUL
+#  define VALIB_TARGET_PCLMUL __attribute__((target("pclmul,ssse3")))
+#endif
+
+enum cpu_feature_t
+{
+  cpu_sse2   = 1 << 0,
+  cpu_ssse3  = 1 << 1,
+  cpu_sse41  = 1 << 2,
+  cpu_pclmul = 1 << 3,
+  cpu_daz    = 1 << 4,  // denormals-are-zero mode of SSE unit
+  cpu_all    = -1
+};
+
+int  cpu_features();
+void set_cpu_features_mask(int mask);
+
+/**************************************************************************//**
+  \class DenormalGuard
+  \brief Flushes denormal numbers to zero in the scope of the guard.
+
+  Operations with denormal numbers are 10-100 times slower on x86. Decaying
+  signals (filter tails, feedback paths) fall into the denormal range during
+  silence, and the processing time jumps after every quiet passage.
+
+  Guard sets flush-to-zero (FTZ) and denormals-are-zero (DAZ, when
+  supported) modes of the SSE unit for the current thread and restores the
+  previous mode at destruction, so guards can be nested. Filter graphs set
+  the guard during the processing, and ThreadedFilter sets it for the
+  working thread, so filters called through the graph need not care.
+
+  x87 arithmetic (32-bit builds with double samples) is not affected, so
+  recursive kernels must flush their state by themselves (see IIRFilter).
+  Guard does nothing when SSE2 is not available or disabled with
+  set_cpu_features_mask().
+******************************************************************************/
+
+class DenormalGuard
+{
+public:
+  DenormalGuard();
+  ~DenormalGuard();
+
+protected:
+  unsigned int saved_mode;
+  bool changed;
+};
+
+#endif
@@ -1,7 +1,10 @@
 /*
-  Table CRC algorithm speed mainly depends on table access speed.
-  If we increase table size (and decrease table accesses) it increases cache
-  misses so 8bit table may be considered as optimal choise.
+  Table CRC algorithm speed mainly depends on table access speed and on the
+  dependency chain between table lookups. Byte-by-byte algorithm must finish
+  one lookup before the next one may start. Slicing-by-8 algorithm does 8
+  independent lookups into 8 different tables for each 8 bytes of the
+  message, and combines the results. 8 tables take 8Kb that fits L1 cache of
+  any modern processor.
 
   Some words about 32bit access
   =============================
@@ -15,14 +18,74 @@
 
   Also 32bit access is about 30% faster on P4 and about 50% faster on P3 
   compared to simple byte-access CRC algorithm.
+
+  Carry-less multiplication
+  =========================
+  CRC is the remainder of the message polynomial division. Internally CRC is
+  left-aligned 32bit value, so CRC of any power is calculated with the
+  polynomial of power 32: Q(x) = x^32 + poly. Message polynomial may be
+  split into parts and CRC of each part may be found independently:
+
+  M(x) = A(x)*x^n + B(x)
+  M(x) mod Q(x) = (A(x) * (x^n mod Q(x)) + B(x)) mod Q(x)
+
+  So we can "fold" the head of a message into the next 128bit block with 2
+  carry-less multiplications by precalculated constants x^n mod Q(x). Folding
+  is done by 4 independent 128bit blocks to hide the multiplication latency.
+  Finally, 128bit remainder is reduced to 32bit with Barrett reduction.
+
+  This method works only for messages not shorter than 16 bytes, and it does
+  not worth for short messages, so the table method is used for them.
 */
 
 
 #include "crc.h"
+#include "cpu.h"
+
+#ifdef VALIB_PCLMUL
+#  include <emmintrin.h>
+#  include <tmmintrin.h>
+#  include <wmmintrin.h>
+#endif
 
 const CRC crc16(POLY_CRC16, 16);
 const CRC crc32(POLY_CRC32, 32);
 
+// Use carry-less multiplication for messages of this size and larger
+static const size_t clmul_min_size = 64;
+
+///////////////////////////////////////////////////////////////////////////////
+// Polynomial arithmetic for clmul constants
+// Q(x) = x^32 + q
+
+// x^n mod Q(x)
+static uint64_t xn_mod(unsigned n, uint32_t q)
+{
+  uint64_t r = 1;
+  while (n--)
+  {
+    r <<= 1;
+    if (r & 0x100000000)
+      r ^= 0x100000000 | q;
+  }
+  return r;
+}
+
+// x^64 div Q(x)
+static uint64_t x64_div(uint32_t q)
+{
+  // First step is known: x^64 - x^32*Q(x) = x^32*q
+  uint64_t result = 0x100000000;
+  uint64_t r = uint64_t(q) << 32;
+  for (int i = 63; i >= 32; i--)
+    if (r & (uint64_t(1) << i))
+    {
+      result |= uint64_t(1) << (i - 32);
+      r ^= (0x100000000 | uint64_t(q)) << (i - 32);
+    }
+  return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Init
 
@@ -32,27 +95,120 @@ CRC::CRC(uint32_t poly_, unsigned power_)
   poly = poly_ << (32 - power_);
   power = power_;
   for (unsigned byte = 0; byte < 256; byte++)
-    tbl[byte] = add_bits(0, byte, 8);
+    tbl[0][byte] = add_bits(0, byte, 8);
+
+  for (int n = 1; n < 8; n++)
+    for (unsigned byte = 0; byte < 256; byte++)
+      tbl[n][byte] = add_8(tbl[n-1][byte], 0);
+
+  clmul_k[0] = xn_mod(512 + 64, poly); // fold by 4 blocks
+  clmul_k[1] = xn_mod(512, poly);
+  clmul_k[2] = xn_mod(128 + 64, poly); // fold by 1 block
+  clmul_k[3] = xn_mod(128, poly);
+  clmul_k[4] = xn_mod(96, poly);       // 128bit -> 64bit reduction
+  clmul_k[5] = xn_mod(64, poly);
+  clmul_k[6] = x64_div(poly);          // Barrett reduction
+  clmul_k[7] = 0x100000000 | uint64_t(poly);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Carry-less multiplication
+// Returns CRC of size/16 16-byte blocks. size >= 16.
+
+#ifdef VALIB_PCLMUL
+
+VALIB_TARGET_PCLMUL
+static inline __m128i set_k(uint64_t hi, uint64_t lo)
+{
+  return _mm_set_epi32(int(hi >> 32), int(hi), int(lo >> 32), int(lo));
+}
+
+VALIB_TARGET_PCLMUL
+static uint32_t crc_clmul(uint32_t crc, const uint8_t *data, size_t size, const uint64_t *k)
+{
+  // Byte order reverse: the first byte of the message is the most
+  // significant byte of the 128bit value.
+  const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  #define LOAD(p) _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(p)), bswap)
+  #define FOLD(x, k) _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x11), _mm_clmulepi64_si128(x, k, 0x00))
+
+  const __m128i k4 = set_k(k[0], k[1]);
+  const __m128i k1 = set_k(k[2], k[3]);
+  const uint8_t *end = data + (size & ~15);
+
+  __m128i x = _mm_xor_si128(LOAD(data), _mm_set_epi32(int(crc), 0, 0, 0));
+  data += 16;
+
+  if (end - data >= 48)
+  {
+    __m128i x1 = LOAD(data);
+    __m128i x2 = LOAD(data + 16);
+    __m128i x3 = LOAD(data + 32);
+    data += 48;
+
+    while (end - data >= 64)
+    {
+      x  = _mm_xor_si128(FOLD(x,  k4), LOAD(data));
+      x1 = _mm_xor_si128(FOLD(x1, k4), LOAD(data + 16));
+      x2 = _mm_xor_si128(FOLD(x2, k4), LOAD(data + 32));
+      x3 = _mm_xor_si128(FOLD(x3, k4), LOAD(data + 48));
+      data += 64;
+    }
+
+    x = _mm_xor_si128(FOLD(x, k1), x1);
+    x = _mm_xor_si128(FOLD(x, k1), x2);
+    x = _mm_xor_si128(FOLD(x, k1), x3);
+  }
+
+  while (data < end)
+  {
+    x = _mm_xor_si128(FOLD(x, k1), LOAD(data));
+    data += 16;
+  }
+
+  #undef LOAD
+  #undef FOLD
+
+  // CRC = x * x^32 mod Q
+  // 128bit * x^32 -> 96bit
+  const __m128i kr = set_k(k[4], k[5]);
+  x = _mm_xor_si128(_mm_clmulepi64_si128(x, kr, 0x11), _mm_slli_si128(_mm_move_epi64(x), 4));
+  // 96bit -> 64bit
+  x = _mm_xor_si128(_mm_clmulepi64_si128(_mm_srli_si128(x, 8), kr, 0x00), _mm_move_epi64(x));
+  // Barrett reduction 64bit -> 32bit
+  const __m128i kb = set_k(k[6], k[7]);
+  __m128i t = _mm_clmulepi64_si128(_mm_srli_epi64(x, 32), kb, 0x10);
+  t = _mm_clmulepi64_si128(_mm_srli_epi64(t, 32), kb, 0x00);
+  return uint32_t(_mm_cvtsi128_si32(_mm_xor_si128(x, t)));
 }
 
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // CRC primitives
 
 uint32_t
 CRC::add_8(uint32_t crc, uint32_t data) const
 {
-  return (crc << 8) ^ tbl[(crc >> 24) ^ (data & 0xff)];
+  return (crc << 8) ^ tbl[0][(crc >> 24) ^ (data & 0xff)];
 }
 
 uint32_t
 CRC::add_32(uint32_t crc, uint32_t data) const
 {
   crc ^= data;
-  crc = (crc << 8) ^ tbl[crc >> 24];
-  crc = (crc << 8) ^ tbl[crc >> 24];
-  crc = (crc << 8) ^ tbl[crc >> 24];
-  crc = (crc << 8) ^ tbl[crc >> 24];
-  return crc;
+  return tbl[3][crc >> 24] ^ tbl[2][(crc >> 16) & 0xff] ^
+         tbl[1][(crc >> 8) & 0xff] ^ tbl[0][crc & 0xff];
+}
+
+uint32_t
+CRC::add_64(uint32_t crc, uint32_t data1, uint32_t data2) const
+{
+  crc ^= data1;
+  return tbl[7][crc >> 24]   ^ tbl[6][(crc >> 16) & 0xff] ^
+         tbl[5][(crc >> 8) & 0xff]   ^ tbl[4][crc & 0xff] ^
+         tbl[3][data2 >> 24] ^ tbl[2][(data2 >> 16) & 0xff] ^
+         tbl[1][(data2 >> 8) & 0xff] ^ tbl[0][data2 & 0xff];
 }
 
 uint32_t 
@@ -73,6 +229,19 @@ CRC::add_bits(uint32_t crc, uint32_t data, size_t bits) const
 uint32_t 
 CRC::add_bytes(uint32_t crc, const uint8_t *data, size_t size) const
 {
+#ifdef VALIB_PCLMUL
+  /////////////////////////////////////////////////////
+  // Process 16-byte blocks with carry-less multiplication
+
+  const int clmul_features = cpu_pclmul | cpu_ssse3;
+  if (size >= clmul_min_size && (cpu_features() & clmul_features) == clmul_features)
+  {
+    crc = crc_clmul(crc, data, size, clmul_k);
+    data += size & ~15;
+    size &= 15;
+  }
+#endif
+
   const uint8_t *end = data + size;
 
   /////////////////////////////////////////////////////
@@ -84,10 +253,16 @@ CRC::add_bytes(uint32_t crc, const uint8_t *data, size_t size) const
     crc = add_8(crc, *data++);
 
   /////////////////////////////////////////////////////
-  // Process main block (32bit)
+  // Process main block (64bit and 32bit)
 
   uint32_t *data32 = (uint32_t *)data;
   uint32_t *end32  = (uint32_t *)(end - align32(end));
+  while (end32 - data32 >= 2)
+  {
+    crc = add_64(crc, be2uint32(data32[0]), be2uint32(data32[1]));
+    data32 += 2;
+  }
+
   while (data32 < end32)
   {
     crc = add_32(crc, be2uint32(*data32));
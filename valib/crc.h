@@ -26,6 +26,10 @@
 
     Find crc for the given message.
 
+    Long messages are processed with carry-less multiplication when the
+    processor supports it (PCLMULQDQ), and 8 bytes at a time with
+    slicing-by-8 tables otherwise.
+
   \fn uint32_t CRC::calc(uint32_t crc, const uint8_t *data, size_t start_bit, size_t bits) const
     \param crc       Initial CRC value
     \param data      Pointer to the message to find CRC for
@@ -58,7 +62,13 @@ class CRC
 protected:
   uint32_t poly;
   unsigned power;
-  uint32_t tbl[256];
+
+  // tbl[n][byte] is CRC of the byte followed by n zero bytes
+  // (slicing-by-8 tables)
+  uint32_t tbl[8][256];
+
+  // Folding and reduction constants for carry-less multiplication
+  uint64_t clmul_k[8];
 
   /////////////////////////////////////////////////////////////////////////////
   // CRC primitives
@@ -67,6 +77,7 @@ protected:
 
   __forceinline uint32_t add_8    (uint32_t crc, uint32_t data) const;
   __forceinline uint32_t add_32   (uint32_t crc, uint32_t data) const;
+  __forceinline uint32_t add_64   (uint32_t crc, uint32_t data1, uint32_t data2) const;
   __forceinline uint32_t add_bits (uint32_t crc, uint32_t data, size_t bits) const;
   uint32_t add_bytes(uint32_t crc, const uint8_t *data, size_t size) const;
 
@@ -1,25 +1,635 @@
 #include <math.h>
 #include "fft.h"
 #include "fftsg.h"
+#include "../auto_buf.h"
+#include "../thread.h"
+#include "../cpu.h"
 
-FFT::FFT(): len(0)
+#ifdef VALIB_SSE2
+#include <emmintrin.h>
+#endif
+
+// Shortest transform done with the SIMD backend
+static const unsigned simd_min_length = 64;
+
+// Channels are transformed together while the working set (data and work
+// buffers) fits into this size. Otherwise, stage by stage processing of
+// several channels evicts the data from the cache between stages.
+static const size_t batch_cache_size = 48 * 1024;
+
+// Work buffers up to this size are taken from the stack. It covers all
+// batched transforms (see batch_cache_size).
+static const size_t stack_work_size = 32 * 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+// Transform tables cache
+// Precision is defined by sample_t at compile time, so the length is the key.
+
+struct FFTPlan
+{
+  unsigned len;
+  AutoBuf<int> ip;
+  AutoBuf<sample_t> w;
+  AutoBuf<sample_t> tw;  // SIMD backend: radix-4 stages twiddles
+  AutoBuf<sample_t> rtw; // SIMD backend: real transform twiddles
+  FFTPlan *next;
+};
+
+#ifdef VALIB_SSE2
+static void init_simd_tables(FFTPlan *plan);
+#endif
+
+class FFTPlanCache
+{
+protected:
+  CritSec lock;
+  FFTPlan *plans;
+  size_t count;
+
+public:
+  FFTPlanCache(): plans(0), count(0)
+  {}
+
+  ~FFTPlanCache()
+  {
+    while (plans)
+    {
+      FFTPlan *next = plans->next;
+      delete plans;
+      plans = next;
+    }
+  }
+
+  const FFTPlan *get(unsigned len)
+  {
+    AutoLock autolock(&lock);
+
+    for (FFTPlan *plan = plans; plan; plan = plan->next)
+      if (plan->len == len)
+        return plan;
+
+    FFTPlan *plan = new FFTPlan;
+    try
+    {
+      plan->len = len;
+      plan->ip.allocate((int)(2 + sqrt(double(len * 2))));
+      plan->w.allocate(len/2+1);
+      plan->ip[0] = 0;
+
+      // Ooura's rdft() builds its tables on the first call. Do it here, so
+      // later calls only read the tables and may run concurrently.
+      AutoBuf<sample_t> buf(len);
+      buf.zero();
+      ::rdft(len, 1, buf, plan->ip, plan->w);
+
+#ifdef VALIB_SSE2
+      if (len >= simd_min_length)
+        init_simd_tables(plan);
+#endif
+    }
+    catch (...)
+    {
+      delete plan;
+      throw;
+    }
+
+    plan->next = plans;
+    plans = plan;
+    count++;
+    return plan;
+  }
+
+  size_t size()
+  {
+    AutoLock autolock(&lock);
+    return count;
+  }
+};
+
+static FFTPlanCache plan_cache;
+
+///////////////////////////////////////////////////////////////////////////////
+// SIMD backend
+//
+// Real transform of length n is done with the complex transform of length
+// N = n/2 of z[m] = x[2m] + i*x[2m+1] followed by the split into the spectrum
+// of the real signal. Output is packed the same way as Ooura's rdft() does.
+//
+// Complex transform is the Stockham autosort radix-4 FFT (with the final
+// radix-2 stage when log2(N) is odd) on the split real/imaginary arrays, so
+// no bit reversal is required. Stage of length nc has stride s = N/nc. The
+// first stage (s = 1) is vectorized over butterflies, others over the stride.
+// The first stage reads and the last stage writes interleaved data directly
+// when possible.
+//
+// Inverse complex transform is the forward one with real and imaginary parts
+// swapped.
+//
+// Several channels are transformed stage by stage, so twiddles are loaded
+// once per stage for all channels. Each channel uses its own part of the
+// work buffer (4*N samples).
+
+#ifdef VALIB_SSE2
+
+#ifdef FLOAT_SAMPLE
+
+typedef __m128 vec_t;
+static const int vec_size = 4;
+
+static inline vec_t vload(const sample_t *p)        { return _mm_loadu_ps(p); }
+static inline void  vstore(sample_t *p, vec_t v)    { _mm_storeu_ps(p, v); }
+static inline vec_t vset1(sample_t v)               { return _mm_set1_ps(v); }
+static inline vec_t vadd(vec_t a, vec_t b)          { return _mm_add_ps(a, b); }
+static inline vec_t vsub(vec_t a, vec_t b)          { return _mm_sub_ps(a, b); }
+static inline vec_t vmul(vec_t a, vec_t b)          { return _mm_mul_ps(a, b); }
+
+static inline vec_t vreverse(vec_t v)
+{ return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3)); }
+
+// re[i] = p[2i], im[i] = p[2i+1]
+static inline void vload2(const sample_t *p, vec_t &re, vec_t &im)
+{
+  vec_t a = _mm_loadu_ps(p), b = _mm_loadu_ps(p + 4);
+  re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+  im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+// p[2i] = re[i], p[2i+1] = im[i]
+static inline void vstore2(sample_t *p, vec_t re, vec_t im)
+{
+  _mm_storeu_ps(p,     _mm_unpacklo_ps(re, im));
+  _mm_storeu_ps(p + 4, _mm_unpackhi_ps(re, im));
+}
+
+// Store y[4i+k] = ok[i]
+static inline void vstore4t(sample_t *y, vec_t o0, vec_t o1, vec_t o2, vec_t o3)
+{
+  _MM_TRANSPOSE4_PS(o0, o1, o2, o3);
+  _mm_storeu_ps(y, o0);
+  _mm_storeu_ps(y + 4, o1);
+  _mm_storeu_ps(y + 8, o2);
+  _mm_storeu_ps(y + 12, o3);
+}
+
+#else
+
+typedef __m128d vec_t;
+static const int vec_size = 2;
+
+static inline vec_t vload(const sample_t *p)        { return _mm_loadu_pd(p); }
+static inline void  vstore(sample_t *p, vec_t v)    { _mm_storeu_pd(p, v); }
+static inline vec_t vset1(sample_t v)               { return _mm_set1_pd(v); }
+static inline vec_t vadd(vec_t a, vec_t b)          { return _mm_add_pd(a, b); }
+static inline vec_t vsub(vec_t a, vec_t b)          { return _mm_sub_pd(a, b); }
+static inline vec_t vmul(vec_t a, vec_t b)          { return _mm_mul_pd(a, b); }
+
+static inline vec_t vreverse(vec_t v)
+{ return _mm_shuffle_pd(v, v, 1); }
+
+// re[i] = p[2i], im[i] = p[2i+1]
+static inline void vload2(const sample_t *p, vec_t &re, vec_t &im)
+{
+  vec_t a = _mm_loadu_pd(p), b = _mm_loadu_pd(p + 2);
+  re = _mm_unpacklo_pd(a, b);
+  im = _mm_unpackhi_pd(a, b);
+}
+
+// p[2i] = re[i], p[2i+1] = im[i]
+static inline void vstore2(sample_t *p, vec_t re, vec_t im)
+{
+  _mm_storeu_pd(p,     _mm_unpacklo_pd(re, im));
+  _mm_storeu_pd(p + 2, _mm_unpackhi_pd(re, im));
+}
+
+// Store y[4i+k] = ok[i]
+static inline void vstore4t(sample_t *y, vec_t o0, vec_t o1, vec_t o2, vec_t o3)
+{
+  _mm_storeu_pd(y,     _mm_unpacklo_pd(o0, o1));
+  _mm_storeu_pd(y + 2, _mm_unpacklo_pd(o2, o3));
+  _mm_storeu_pd(y + 4, _mm_unpackhi_pd(o0, o1));
+  _mm_storeu_pd(y + 6, _mm_unpackhi_pd(o2, o3));
+}
+
+#endif
+
+static void init_simd_tables(FFTPlan *plan)
+{
+  const unsigned n = plan->len;
+  const unsigned nn = n / 2;
+  unsigned nc, p, size = 0;
+
+  for (nc = nn; nc >= 4; nc /= 4)
+    size += nc / 4 * 6;
+  plan->tw.allocate(size);
+  plan->rtw.allocate(nn * 2);
+
+  // Stage of length nc: w1, w2, w3 real parts, then imaginary parts
+  sample_t *tw = plan->tw;
+  for (nc = nn; nc >= 4; nc /= 4)
+  {
+    const unsigned m = nc / 4;
+    for (p = 0; p < m; p++)
+      for (int k = 1; k <= 3; k++)
+      {
+        double a = -2 * M_PI * double(k * p) / double(nc);
+        tw[(k-1) * m + p] = sample_t(cos(a));
+        tw[(k+2) * m + p] = sample_t(sin(a));
+      }
+    tw += 6 * m;
+  }
+
+  // W^k = exp(-2*pi*i*k/n)
+  for (p = 0; p < nn; p++)
+  {
+    double a = -2 * M_PI * double(p) / double(n);
+    plan->rtw[p] = sample_t(cos(a));
+    plan->rtw[nn + p] = sample_t(sin(a));
+  }
+}
+
+// Complex data accessors for the first and the last stages of the transform:
+// split arrays in the work buffer, interleaved arrays, and interleaved arrays
+// with real and imaginary parts swapped.
+
+struct SplitData
+{
+  sample_t *r, *i;
+  size_t stride;
+  SplitData(sample_t *r_, sample_t *i_, size_t stride_): r(r_), i(i_), stride(stride_) {}
+  void bind(sample_t *r_, sample_t *i_) { r = r_; i = i_; }
+  void load(int ch, unsigned k, vec_t &re, vec_t &im) const
+  { re = vload(r + ch * stride + k); im = vload(i + ch * stride + k); }
+};
+
+struct InterleavedData
+{
+  sample_t *const *a;
+  InterleavedData(sample_t *const *a_): a(a_) {}
+  void load(int ch, unsigned k, vec_t &re, vec_t &im) const { vload2(a[ch] + 2 * k, re, im); }
+};
+
+struct SwappedData
+{
+  sample_t *const *a;
+  SwappedData(sample_t *const *a_): a(a_) {}
+  void bind(sample_t *, sample_t *) {}
+  void store(int ch, unsigned k, vec_t re, vec_t im) const { vstore2(a[ch] + 2 * k, im, re); }
+};
+
+struct SplitOut: public SplitData
+{
+  SplitOut(size_t stride_): SplitData(0, 0, stride_) {}
+  void store(int ch, unsigned k, vec_t re, vec_t im) const
+  { vstore(r + ch * stride + k, re); vstore(i + ch * stride + k, im); }
+};
+
+// Radix-4 butterfly with twiddles
+#define BUTTERFLY4_DECL \
+  vec_t apcr = vadd(ar, cr), apci = vadd(ai, ci); \
+  vec_t amcr = vsub(ar, cr), amci = vsub(ai, ci); \
+  vec_t bpdr = vadd(br, dr), bpdi = vadd(bi, di); \
+  vec_t bmdr = vsub(br, dr), bmdi = vsub(bi, di); \
+  vec_t o0r = vadd(apcr, bpdr), o0i = vadd(apci, bpdi); \
+  vec_t t1r = vadd(amcr, bmdi), t1i = vsub(amci, bmdr); \
+  vec_t t2r = vsub(apcr, bpdr), t2i = vsub(apci, bpdi); \
+  vec_t t3r = vsub(amcr, bmdi), t3i = vadd(amci, bmdr); \
+  vec_t o1r = vsub(vmul(t1r, w1r_v), vmul(t1i, w1i_v)); \
+  vec_t o1i = vadd(vmul(t1r, w1i_v), vmul(t1i, w1r_v)); \
+  vec_t o2r = vsub(vmul(t2r, w2r_v), vmul(t2i, w2i_v)); \
+  vec_t o2i = vadd(vmul(t2r, w2i_v), vmul(t2i, w2r_v)); \
+  vec_t o3r = vsub(vmul(t3r, w3r_v), vmul(t3i, w3i_v)); \
+  vec_t o3i = vadd(vmul(t3r, w3i_v), vmul(t3i, w3r_v));
+
+// First radix-4 stage (s = 1), vectorized over butterflies, outputs are
+// transposed.
+template <class In>
+static inline void stage4_first(const sample_t *tw, unsigned m, int nch, const In &in,
+  sample_t *yr, sample_t *yi, size_t stride)
+{
+  for (unsigned p = 0; p < m; p += vec_size)
+  {
+    const vec_t w1r_v = vload(tw + p),         w1i_v = vload(tw + 3 * m + p);
+    const vec_t w2r_v = vload(tw + m + p),     w2i_v = vload(tw + 4 * m + p);
+    const vec_t w3r_v = vload(tw + 2 * m + p), w3i_v = vload(tw + 5 * m + p);
+
+    for (int ch = 0; ch < nch; ch++)
+    {
+      vec_t ar, ai, br, bi, cr, ci, dr, di;
+      in.load(ch, p,         ar, ai);
+      in.load(ch, p + m,     br, bi);
+      in.load(ch, p + 2 * m, cr, ci);
+      in.load(ch, p + 3 * m, dr, di);
+      BUTTERFLY4_DECL
+
+      vstore4t(yr + ch * stride + 4 * p, o0r, o1r, o2r, o3r);
+      vstore4t(yi + ch * stride + 4 * p, o0i, o1i, o2i, o3i);
+    }
+  }
+}
+
+// Radix-4 stage with stride s >= vec_size, vectorized over the stride
+static inline void stage4(const sample_t *tw, unsigned m, unsigned s, int nch,
+  const sample_t *xr, const sample_t *xi, sample_t *yr, sample_t *yi, size_t stride)
+{
+  const unsigned sm = s * m;
+  for (unsigned p = 0; p < m; p++)
+  {
+    const vec_t w1r_v = vset1(tw[p]),         w1i_v = vset1(tw[3 * m + p]);
+    const vec_t w2r_v = vset1(tw[m + p]),     w2i_v = vset1(tw[4 * m + p]);
+    const vec_t w3r_v = vset1(tw[2 * m + p]), w3i_v = vset1(tw[5 * m + p]);
+
+    for (int ch = 0; ch < nch; ch++)
+    {
+      const sample_t *xr_p = xr + ch * stride + s * p;
+      const sample_t *xi_p = xi + ch * stride + s * p;
+      sample_t *yr_p = yr + ch * stride + s * 4 * p;
+      sample_t *yi_p = yi + ch * stride + s * 4 * p;
+
+      for (unsigned q = 0; q < s; q += vec_size)
+      {
+        vec_t ar = vload(xr_p + q),          ai = vload(xi_p + q);
+        vec_t br = vload(xr_p + q + sm),     bi = vload(xi_p + q + sm);
+        vec_t cr = vload(xr_p + q + 2 * sm), ci = vload(xi_p + q + 2 * sm);
+        vec_t dr = vload(xr_p + q + 3 * sm), di = vload(xi_p + q + 3 * sm);
+        BUTTERFLY4_DECL
+
+        vstore(yr_p + q,         o0r); vstore(yi_p + q,         o0i);
+        vstore(yr_p + q + s,     o1r); vstore(yi_p + q + s,     o1i);
+        vstore(yr_p + q + 2 * s, o2r); vstore(yi_p + q + 2 * s, o2i);
+        vstore(yr_p + q + 3 * s, o3r); vstore(yi_p + q + 3 * s, o3i);
+      }
+    }
+  }
+}
+
+// Last radix-4 stage (m = 1), twiddles are 1
+template <class Out>
+static inline void stage4_last(unsigned s, int nch,
+  const sample_t *xr, const sample_t *xi, size_t stride, const Out &out)
+{
+  for (int ch = 0; ch < nch; ch++)
+  {
+    const sample_t *xr_ch = xr + ch * stride;
+    const sample_t *xi_ch = xi + ch * stride;
+    for (unsigned q = 0; q < s; q += vec_size)
+    {
+      vec_t ar = vload(xr_ch + q),         ai = vload(xi_ch + q);
+      vec_t br = vload(xr_ch + q + s),     bi = vload(xi_ch + q + s);
+      vec_t cr = vload(xr_ch + q + 2 * s), ci = vload(xi_ch + q + 2 * s);
+      vec_t dr = vload(xr_ch + q + 3 * s), di = vload(xi_ch + q + 3 * s);
+
+      vec_t apcr = vadd(ar, cr), apci = vadd(ai, ci);
+      vec_t amcr = vsub(ar, cr), amci = vsub(ai, ci);
+      vec_t bpdr = vadd(br, dr), bpdi = vadd(bi, di);
+      vec_t bmdr = vsub(br, dr), bmdi = vsub(bi, di);
+
+      out.store(ch, q,         vadd(apcr, bpdr), vadd(apci, bpdi));
+      out.store(ch, q + s,     vadd(amcr, bmdi), vsub(amci, bmdr));
+      out.store(ch, q + 2 * s, vsub(apcr, bpdr), vsub(apci, bpdi));
+      out.store(ch, q + 3 * s, vsub(amcr, bmdi), vadd(amci, bmdr));
+    }
+  }
+}
+
+// Last radix-2 stage
+template <class Out>
+static inline void stage2_last(unsigned s, int nch,
+  const sample_t *xr, const sample_t *xi, size_t stride, const Out &out)
+{
+  for (int ch = 0; ch < nch; ch++)
+  {
+    const sample_t *xr_ch = xr + ch * stride;
+    const sample_t *xi_ch = xi + ch * stride;
+    for (unsigned q = 0; q < s; q += vec_size)
+    {
+      vec_t ar = vload(xr_ch + q),     ai = vload(xi_ch + q);
+      vec_t br = vload(xr_ch + q + s), bi = vload(xi_ch + q + s);
+      out.store(ch, q,     vadd(ar, br), vadd(ai, bi));
+      out.store(ch, q + s, vsub(ar, br), vsub(ai, bi));
+    }
+  }
+}
+
+// Forward complex transform of length nn >= 32 of nch channels. Input must
+// not overlap with the first half of channel's work buffer. Split output is
+// bound to the part of the work buffer with the result.
+template <class In, class Out>
+static void cfft_simd(const FFTPlan *plan, unsigned nn, int nch, const In &in, Out &out, sample_t *work)
+{
+  const size_t stride = 4 * nn;
+  sample_t *xr = work,          *xi = work + nn;
+  sample_t *yr = work + 2 * nn, *yi = work + 3 * nn;
+  const sample_t *tw = plan->tw;
+  unsigned nc = nn / 4, s = 4;
+
+  stage4_first(tw, nn / 4, nch, in, xr, xi, stride);
+  tw += nn / 4 * 6;
+
+  for (; nc > 4; nc /= 4, s *= 4)
+  {
+    stage4(tw, nc / 4, s, nch, xr, xi, yr, yi, stride);
+    tw += nc / 4 * 6;
+
+    sample_t *t;
+    t = xr; xr = yr; yr = t;
+    t = xi; xi = yi; yi = t;
+  }
+
+  out.bind(yr, yi);
+  if (nc == 4)
+    stage4_last(s, nch, xr, xi, stride, out);
+  else
+    stage2_last(s, nch, xr, xi, stride, out);
+}
+
+static void rdft_simd(const FFTPlan *plan, sample_t *const *a, int nch, sample_t *work)
+{
+  const unsigned nn = plan->len / 2;
+  const size_t stride = 4 * nn;
+  const sample_t *wr = plan->rtw;
+  const sample_t *wi = plan->rtw + nn;
+  unsigned k;
+  int ch;
+
+  SplitOut z(stride);
+  cfft_simd(plan, nn, nch, InterleavedData(a), z, work);
+
+  // X[k] = Fe[k] + W^k * Fo[k]
+  // Fe[k] = (Z[k] + conj(Z[N-k])) / 2
+  // Fo[k] = (Z[k] - conj(Z[N-k])) / 2i
+  for (ch = 0; ch < nch; ch++)
+  {
+    const sample_t *xr = z.r + ch * stride;
+    const sample_t *xi = z.i + ch * stride;
+    sample_t *a_ch = a[ch];
+
+    a_ch[0] = xr[0] + xi[0];
+    a_ch[1] = xr[0] - xi[0];
+    for (k = 1; k < vec_size; k++)
+    {
+      sample_t fer = (xr[k] + xr[nn-k]) * 0.5;
+      sample_t fei = (xi[k] - xi[nn-k]) * 0.5;
+      sample_t for_ = (xi[k] + xi[nn-k]) * 0.5;
+      sample_t foi = (xr[nn-k] - xr[k]) * 0.5;
+      a_ch[2*k]   =   fer + wr[k] * for_ - wi[k] * foi;
+      a_ch[2*k+1] = -(fei + wr[k] * foi + wi[k] * for_);
+    }
+  }
+
+  const vec_t half = vset1(0.5);
+  const vec_t mhalf = vset1(-0.5);
+  for (k = vec_size; k < nn; k += vec_size)
+  {
+    const vec_t wr_v = vload(wr + k), wi_v = vload(wi + k);
+    for (ch = 0; ch < nch; ch++)
+    {
+      const sample_t *xr = z.r + ch * stride;
+      const sample_t *xi = z.i + ch * stride;
+
+      vec_t zr = vload(xr + k), zi = vload(xi + k);
+      vec_t zr_n = vreverse(vload(xr + nn - k - vec_size + 1));
+      vec_t zi_n = vreverse(vload(xi + nn - k - vec_size + 1));
+
+      vec_t fer = vmul(vadd(zr, zr_n), half);
+      vec_t fei = vmul(vsub(zi, zi_n), mhalf);
+      vec_t for_ = vmul(vadd(zi, zi_n), half);
+      vec_t foi = vmul(vsub(zr_n, zr), half);
+      vec_t re = vadd(fer, vsub(vmul(wr_v, for_), vmul(wi_v, foi)));
+      vec_t im = vsub(fei, vadd(vmul(wr_v, foi), vmul(wi_v, for_)));
+      vstore2(a[ch] + 2 * k, re, im);
+    }
+  }
+}
+
+static void inv_rdft_simd(const FFTPlan *plan, sample_t *const *a, int nch, sample_t *work)
+{
+  const unsigned nn = plan->len / 2;
+  const size_t stride = 4 * nn;
+  const sample_t *wr = plan->rtw;
+  const sample_t *wi = plan->rtw + nn;
+  sample_t *zr = work + 2 * nn, *zi = work + 3 * nn;
+  unsigned k;
+  int ch;
+
+  // Z[k] = Fe[k] + i * Fo[k]
+  // Fe[k] = (X[k] + conj(X[N-k])) / 2
+  // Fo[k] = (X[k] - conj(X[N-k])) * conj(W^k) / 2
+  // X[k] = a[2k] - i * a[2k+1]
+  for (ch = 0; ch < nch; ch++)
+  {
+    const sample_t *a_ch = a[ch];
+    sample_t *xr = zr + ch * stride;
+    sample_t *xi = zi + ch * stride;
+
+    xr[0] = (a_ch[0] + a_ch[1]) * 0.5;
+    xi[0] = (a_ch[0] - a_ch[1]) * 0.5;
+    for (k = 1; k < vec_size; k++)
+    {
+      sample_t fer = (a_ch[2*k] + a_ch[2*(nn-k)]) * 0.5;
+      sample_t fei = (a_ch[2*(nn-k)+1] - a_ch[2*k+1]) * 0.5;
+      sample_t dr  = (a_ch[2*k] - a_ch[2*(nn-k)]) * 0.5;
+      sample_t di  = -(a_ch[2*k+1] + a_ch[2*(nn-k)+1]) * 0.5;
+      sample_t for_ = dr * wr[k] + di * wi[k];
+      sample_t foi = di * wr[k] - dr * wi[k];
+      xr[k] = fer - foi;
+      xi[k] = fei + for_;
+    }
+  }
+
+  const vec_t half = vset1(0.5);
+  const vec_t mhalf = vset1(-0.5);
+  for (k = vec_size; k < nn; k += vec_size)
+  {
+    const vec_t wr_v = vload(wr + k), wi_v = vload(wi + k);
+    for (ch = 0; ch < nch; ch++)
+    {
+      vec_t ar, ai, ar_n, ai_n;
+      vload2(a[ch] + 2 * k, ar, ai);
+      vload2(a[ch] + 2 * (nn - k - vec_size + 1), ar_n, ai_n);
+      ar_n = vreverse(ar_n);
+      ai_n = vreverse(ai_n);
+
+      vec_t fer = vmul(vadd(ar, ar_n), half);
+      vec_t fei = vmul(vsub(ai_n, ai), half);
+      vec_t dr  = vmul(vsub(ar, ar_n), half);
+      vec_t di  = vmul(vadd(ai, ai_n), mhalf);
+      vec_t for_ = vadd(vmul(dr, wr_v), vmul(di, wi_v));
+      vec_t foi = vsub(vmul(di, wr_v), vmul(dr, wi_v));
+      vstore(zr + ch * stride + k, vsub(fer, foi));
+      vstore(zi + ch * stride + k, vadd(fei, for_));
+    }
+  }
+
+  // Inverse transform is the forward one with swapped real and imaginary
+  // parts of the input and the output.
+  SwappedData out(a);
+  cfft_simd(plan, nn, nch, SplitData(zi, zr, stride), out, work);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Work buffer of the SIMD backend (2 * len samples per channel of a batch).
+// Transforms keep nothing in it between calls, so FFT objects do not own
+// one: short transforms use the stack, and long ones take a block from the
+// buffer pool for the call (the pool keeps it for the next call).
+
+class WorkBuf
+{
+protected:
+  sample_t stack_buf[(stack_work_size + pool_align) / sizeof(sample_t)];
+  sample_t *pool_buf;
+  sample_t *buf;
+
+public:
+  WorkBuf(size_t size): pool_buf(0)
+  {
+    if (size * sizeof(sample_t) <= stack_work_size)
+      buf = (sample_t *)(((size_t)stack_buf + pool_align - 1) & ~(pool_align - 1));
+    else
+      buf = pool_buf = (sample_t *)pool_alloc(size * sizeof(sample_t));
+  }
+
+  ~WorkBuf()
+  { pool_free(pool_buf); }
+
+  operator sample_t *() const { return buf; }
+};
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+FFT::FFT(): plan(0), len(0), batch(1), max_batch(1), simd(false)
 {}
 
-FFT::FFT(unsigned length)
+FFT::FFT(unsigned length, int batch_): plan(0), len(0), batch(1), max_batch(1), simd(false)
 {
-  set_length(length);
+  set_length(length, batch_);
 }
 
 void
-FFT::set_length(unsigned length)
+FFT::set_length(unsigned length, int batch_)
 {
-  if (len == length)
+  assert(batch_ > 0 && batch_ <= NCHANNELS);
+  if (len == length && max_batch == batch_)
     return;
 
+  plan = 0;
   len = 0;
-  fft_ip.allocate((int)(2 + sqrt(double(length * 2))));
-  fft_w.allocate(length/2+1);
-  fft_ip[0] = 0;
+  batch = batch_;
+  max_batch = batch_;
+  if (length == 0)
+    return;
+
+  plan = plan_cache.get(length);
+  simd = false;
+#ifdef VALIB_SSE2
+  if (length >= simd_min_length && (cpu_features() & cpu_sse2))
+  {
+    size_t cache_batch = batch_cache_size / (length * 3 * sizeof(sample_t));
+    batch = MAX(1, MIN(batch, int(cache_batch)));
+    simd = true;
+  }
+#endif
   len = length;
 }
 
@@ -27,12 +637,68 @@ void
 FFT::rdft(sample_t *samples)
 {
   assert(is_ok());
-  ::rdft(len, 1, samples, fft_ip, fft_w);
+#ifdef VALIB_SSE2
+  if (simd)
+  {
+    WorkBuf work(len * 2);
+    rdft_simd(plan, &samples, 1, work);
+    return;
+  }
+#endif
+  ::rdft(len, 1, samples, plan->ip, plan->w);
 }
 
 void
 FFT::inv_rdft(sample_t *samples)
 {
   assert(is_ok());
-  ::rdft(len, -1, samples, fft_ip, fft_w);
+#ifdef VALIB_SSE2
+  if (simd)
+  {
+    WorkBuf work(len * 2);
+    inv_rdft_simd(plan, &samples, 1, work);
+    return;
+  }
+#endif
+  ::rdft(len, -1, samples, plan->ip, plan->w);
+}
+
+void
+FFT::rdft(samples_t samples, int nch)
+{
+  assert(is_ok() && nch >= 0 && nch <= NCHANNELS);
+#ifdef VALIB_SSE2
+  if (simd)
+  {
+    WorkBuf work(len * 2 * MIN(batch, nch));
+    for (int ch = 0; ch < nch; ch += batch)
+      rdft_simd(plan, samples.samples + ch, MIN(batch, nch - ch), work);
+    return;
+  }
+#endif
+  for (int ch = 0; ch < nch; ch++)
+    ::rdft(len, 1, samples[ch], plan->ip, plan->w);
+}
+
+void
+FFT::inv_rdft(samples_t samples, int nch)
+{
+  assert(is_ok() && nch >= 0 && nch <= NCHANNELS);
+#ifdef VALIB_SSE2
+  if (simd)
+  {
+    WorkBuf work(len * 2 * MIN(batch, nch));
+    for (int ch = 0; ch < nch; ch += batch)
+      inv_rdft_simd(plan, samples.samples + ch, MIN(batch, nch - ch), work);
+    return;
+  }
+#endif
+  for (int ch = 0; ch < nch; ch++)
+    ::rdft(len, -1, samples[ch], plan->ip, plan->w);
+}
+
+size_t
+FFT::cache_size()
+{
+  return plan_cache.size();
 }
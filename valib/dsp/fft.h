@@ -1,23 +1,59 @@
 /*
   Simple wrapper class for Ooura FFT
 
+  Transform tables (bit reversal indices and twiddle factors) depend only on
+  the transform length. They are computed once per length and kept in the
+  process-wide cache, so all FFT objects of the same length share the same
+  tables. The cache is thread-safe and tables are fully initialized before
+  use, so transforms may run concurrently in different threads (but each FFT
+  object must not be used by several threads simultaneously).
+
+  Tables are never released until the process exits, so reopening a filter
+  does not need any trig computations.
+
+  Transforms of 64 points and longer use the SIMD backend when the processor
+  supports SSE2 (see cpu_features()); shorter ones use Ooura's code. The
+  backend is chosen at set_length(). Both give the same output format:
+
+  rdft:     a[0] = R[0], a[1] = R[n/2], a[2k] = R[k], a[2k+1] = I[k]
+            R[k] = sum(a[j] * cos(2*pi*j*k/n)), I[k] = sum(a[j] * sin(2*pi*j*k/n))
+  inv_rdft: reverse of rdft scaled by n/2
+
   FFT();
     Create an uninitialized FFT transform
 
-  FFT(unsigned length);
+  FFT(unsigned length, int batch = 1);
     Create and initialize an FFT transform of length 'length'
     Can throw std::bad_alloc
 
-  void set_length(unsigned length)
-    Initialize the FFT transorm of length 'length'
+  void set_length(unsigned length, int batch = 1)
+    Initialize the FFT transorm of length 'length'. 'batch' is the maximum
+    number of channels transformed together by the multichannel rdft() and
+    inv_rdft() (more channels are processed by groups). Long transforms are
+    batched less, so the working set of a batch fits the cache. FFT objects
+    do not own work buffers: a transform takes a temporary one from the stack
+    or from the buffer pool (for long transforms).
     Can throw std::bad_alloc
 
+  void rdft(sample_t *samples)
+  void inv_rdft(sample_t *samples)
+    Forward and inverse transform of one buffer in-place.
+
+  void rdft(samples_t samples, int nch)
+  void inv_rdft(samples_t samples, int nch)
+    Transform 'nch' buffers. Channels of a batch are transformed stage by
+    stage, so twiddles are loaded once for all of them. Result is the same
+    as the transform of each buffer separately.
+
   unsigned get_length() const
     Return the length of the FFT transform. Returns 0 when the transform was
     not initialized.
 
   bool is_ok() const
     Returns true when transform is initialized and false otherwise.
+
+  static size_t cache_size()
+    Number of transform lengths in the cache.
 */
 
 #ifndef FFT_H
@@ -25,24 +61,34 @@
 
 #include "../defs.h"
 #include "../auto_buf.h"
+#include "../spk.h"
+
+struct FFTPlan;
 
 class FFT
 {
 protected:
-  AutoBuf<int> fft_ip;
-  AutoBuf<sample_t> fft_w;
+  const FFTPlan *plan;
   unsigned len;
+  int batch;      // channels transformed together
+  int max_batch;  // batch requested
+  bool simd;
 
 public:
   FFT();
-  FFT(unsigned length);
+  FFT(unsigned length, int batch = 1);
 
-  void set_length(unsigned length);
+  void set_length(unsigned length, int batch = 1);
   unsigned get_length() const { return len; }
   bool is_ok() const { return len > 0; }
 
   void rdft(sample_t *samples);
   void inv_rdft(sample_t *samples);
+
+  void rdft(samples_t samples, int nch);
+  void inv_rdft(samples_t samples, int nch);
+
+  static size_t cache_size();
 };
 
 #endif
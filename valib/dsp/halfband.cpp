@@ -0,0 +1,246 @@
+#include <math.h>
+#include "halfband.h"
+#include "kaiser.h"
+#include "../cpu.h"
+
+#ifdef VALIB_SSE2
+#include <emmintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Folded sum kernel:
+// y[j] = sum(c[k] * (a[j-1-k] + a[j+k])), k = 0..nk-1, j = 0..n-1
+
+static void fold(const sample_t *a, const sample_t *c, int nk, sample_t *y, int n)
+{
+  for (int j = 0; j < n; j++)
+  {
+    double sum = 0;
+    for (int k = 0; k < nk; k++)
+      sum += c[k] * (a[j-1-k] + a[j+k]);
+    y[j] = sample_t(sum);
+  }
+}
+
+#ifdef VALIB_SSE2
+
+#ifdef FLOAT_SAMPLE
+
+typedef __m128 vec_t;
+static const int vec_size = 4;
+
+static inline vec_t vload(const sample_t *p)        { return _mm_loadu_ps(p); }
+static inline void  vstore(sample_t *p, vec_t v)    { _mm_storeu_ps(p, v); }
+static inline vec_t vset1(sample_t v)               { return _mm_set1_ps(v); }
+static inline vec_t vzero()                         { return _mm_setzero_ps(); }
+static inline vec_t vadd(vec_t a, vec_t b)          { return _mm_add_ps(a, b); }
+static inline vec_t vmul(vec_t a, vec_t b)          { return _mm_mul_ps(a, b); }
+
+#else
+
+typedef __m128d vec_t;
+static const int vec_size = 2;
+
+static inline vec_t vload(const sample_t *p)        { return _mm_loadu_pd(p); }
+static inline void  vstore(sample_t *p, vec_t v)    { _mm_storeu_pd(p, v); }
+static inline vec_t vset1(sample_t v)               { return _mm_set1_pd(v); }
+static inline vec_t vzero()                         { return _mm_setzero_pd(); }
+static inline vec_t vadd(vec_t a, vec_t b)          { return _mm_add_pd(a, b); }
+static inline vec_t vmul(vec_t a, vec_t b)          { return _mm_mul_pd(a, b); }
+
+#endif
+
+// Vectorized over outputs: 2 vectors of outputs share the coefficient load
+static void fold_sse2(const sample_t *a, const sample_t *c, int nk, sample_t *y, int n)
+{
+  int j = 0;
+  for (; j + 2 * vec_size <= n; j += 2 * vec_size)
+  {
+    vec_t s0 = vzero();
+    vec_t s1 = vzero();
+    const sample_t *lo = a + j - 1;
+    const sample_t *hi = a + j;
+    for (int k = 0; k < nk; k++)
+    {
+      vec_t ck = vset1(c[k]);
+      s0 = vadd(s0, vmul(ck, vadd(vload(lo - k), vload(hi + k))));
+      s1 = vadd(s1, vmul(ck, vadd(vload(lo - k + vec_size), vload(hi + k + vec_size))));
+    }
+    vstore(y + j, s0);
+    vstore(y + j + vec_size, s1);
+  }
+  fold(a + j, c, nk, y + j, n - j);
+}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+HalfBand::HalfBand():
+  mode(decimate), nch(0), nk(0), neven(0), nodd(0), pos(0)
+{}
+
+int
+HalfBand::coefs(double fp, double a)
+{
+  // Length is 4K+3, so the outermost taps are non-zero. Length estimation
+  // is not precise for short filters, so keep 2 taps of margin.
+  int n = kaiser_n(a, 0.5 - 2 * fp) + 2;
+  return MAX(1, (n + 1 + 3) / 4);
+}
+
+void
+HalfBand::init(mode_t mode_, int nch_, double fp, double a, size_t max_block)
+{
+  assert(nch_ > 0 && nch_ <= NCHANNELS);
+  assert(fp > 0 && fp < 0.25);
+
+  nch = 0;
+  nk = 0;
+
+  int nk_ = coefs(fp, a);
+  int len = 4 * nk_ - 1;
+
+  double alpha = kaiser_alpha(a);
+  coef.allocate(nk_);
+  for (int k = 0; k < nk_; k++)
+  {
+    // h(t) = 0.5 * sinc(pi * t / 2), t = 2k+1
+    double t = 2 * k + 1;
+    double h = kaiser_window(t, len, alpha) * 0.5 * sin(M_PI * t / 2) / (M_PI * t / 2);
+    coef[k] = sample_t(mode_ == interpolate? 2 * h: h);
+  }
+
+  if (mode_ == decimate)
+  {
+    even.allocate(nch_, 2 * nk_ + max_block / 2 + 2);
+    odd.allocate(nch_, 2 * nk_ + max_block / 2 + 2);
+  }
+  else
+  {
+    even.allocate(nch_, 2 * nk_ + max_block + 2);
+    odd.allocate(nch_, max_block);  // odd outputs
+  }
+
+  mode = mode_;
+  nch = nch_;
+  nk = nk_;
+  reset();
+}
+
+void
+HalfBand::reset()
+{
+  if (!nch)
+    return;
+
+  if (mode == decimate)
+  {
+    zero_samples(even, nch, nk);
+    zero_samples(odd, nch, nk);
+    neven = nk;
+    nodd = nk;
+    pos = nk;
+  }
+  else
+  {
+    zero_samples(even, nch, nk - 1);
+    neven = nk - 1;
+    nodd = 0;
+    pos = nk - 1;
+  }
+}
+
+size_t
+HalfBand::process(samples_t in, size_t n, samples_t out)
+{
+  int ch;
+  size_t i;
+
+#ifdef VALIB_SSE2
+  void (*fold_func)(const sample_t *, const sample_t *, int, sample_t *, int) =
+    (cpu_features() & cpu_sse2)? fold_sse2: fold;
+#else
+  void (*fold_func)(const sample_t *, const sample_t *, int, sample_t *, int) = fold;
+#endif
+
+  if (mode == decimate)
+  {
+    // Split the input into even and odd samples. Next sample is odd when
+    // the even buffer has one sample more.
+    const size_t e0 = neven, o0 = nodd;
+    for (ch = 0; ch < nch; ch++)
+    {
+      size_t ne = e0, no = o0;
+      sample_t *e = even[ch];
+      sample_t *o = odd[ch];
+      for (i = 0; i < n; i++)
+        if (ne == no)
+          e[ne++] = in[ch][i];
+        else
+          o[no++] = in[ch][i];
+      neven = ne;
+      nodd = no;
+    }
+
+    // y[i] needs e[i] and o[i+nk-1]
+    size_t n_out = 0;
+    if (neven > pos && nodd + 1 > pos + nk)
+      n_out = MIN(neven - pos, nodd + 1 - nk - pos);
+
+    for (ch = 0; ch < nch; ch++)
+    {
+      const sample_t *e = even[ch] + pos;
+      fold_func(odd[ch] + pos, coef, nk, out[ch], int(n_out));
+      for (i = 0; i < n_out; i++)
+        out[ch][i] += sample_t(0.5) * e[i];
+    }
+
+    // Keep nk odd samples of history
+    pos += n_out;
+    size_t drop = pos - nk;
+    if (drop)
+    {
+      move_samples(even, 0, even, drop, nch, neven - drop);
+      move_samples(odd, 0, odd, drop, nch, nodd - drop);
+      neven -= drop;
+      nodd -= drop;
+      pos -= drop;
+    }
+    return n_out;
+  }
+  else
+  {
+    copy_samples(even, neven, in, 0, nch, n);
+    neven += n;
+
+    // z[2i+1] needs x[i+nk]
+    size_t n_out = 0;
+    if (neven > pos + nk)
+      n_out = neven - pos - nk;
+
+    for (ch = 0; ch < nch; ch++)
+    {
+      const sample_t *x = even[ch] + pos;
+      sample_t *z = out[ch];
+      sample_t *t = odd[ch];
+      fold_func(x + 1, coef, nk, t, int(n_out));
+      for (i = 0; i < n_out; i++)
+      {
+        z[2*i] = x[i];
+        z[2*i+1] = t[i];
+      }
+    }
+
+    // Keep nk-1 samples of history
+    pos += n_out;
+    size_t drop = pos - (nk - 1);
+    if (drop)
+    {
+      move_samples(even, 0, even, drop, nch, neven - drop);
+      neven -= drop;
+      pos -= drop;
+    }
+    return n_out * 2;
+  }
+}
@@ -0,0 +1,107 @@
+/**************************************************************************//**
+  \file halfband.h
+  \brief HalfBand: Half-band decimator and interpolator by 2
+******************************************************************************/
+
+#ifndef VALIB_HALFBAND_H
+#define VALIB_HALFBAND_H
+
+#include "../buffer.h"
+
+/**************************************************************************//**
+  \class HalfBand
+  \brief Streaming half-band filter for decimation or interpolation by 2.
+
+  Half-band filter is a lowpass symmetric around a quarter of the sample rate
+  (of the higher rate): passband edge fp and stopband edge 0.5 - fp. Every
+  other coefficient of such filter is zero except the center one, which
+  equals 0.5. So with symmetric folding the filter of length 4K+3 requires
+  only K+1 multiplications per output of the decimator and per odd output
+  of the interpolator:
+
+  \verbatim
+    Decimator:    y[i]    = 0.5 * x[2i] + sum(g[k] * (x[2i-2k-1] + x[2i+2k+1]))
+    Interpolator: z[2i]   = x[i]
+                  z[2i+1] = sum(2 * g[k] * (x[i-k] + x[i+k+1]))
+  \endverbatim
+
+  Filter is zero-phase: the output sample is centered at the input sample of
+  the same time, so the filter requires lookahead() input samples after the
+  input sample to produce the corresponding output. At the start of the
+  stream the history is filled with zeros.
+
+  Passband is preserved exactly and aliases (images) are attenuated in the
+  passband. Transition band [fp, 0.5 - fp] may contain attenuated aliases.
+
+  \fn void HalfBand::init(mode_t mode, int nch, double fp, double a, size_t max_block)
+    \param mode      Decimation or interpolation.
+    \param nch       Number of channels.
+    \param fp        Passband edge normalized to the higher sample rate
+                     (0 < fp < 0.25).
+    \param a         Stopband attenuation in dB.
+    \param max_block Maximum number of input samples per process() call.
+
+    Design the filter and allocate buffers. Can throw std::bad_alloc.
+
+  \fn static int HalfBand::coefs(double fp, double a)
+    Number of multiplications per output of the decimator (per odd output of
+    the interpolator) for the given passband edge and attenuation.
+
+  \fn void HalfBand::reset()
+    Clear the history.
+
+  \fn size_t HalfBand::process(samples_t in, size_t n, samples_t out)
+    Process n input samples of each channel and return the number of output
+    samples. Output buffer must have at least max_output(n) samples.
+
+  \fn size_t HalfBand::max_output(size_t n) const
+    Maximum number of output samples for n input samples.
+
+  \fn int HalfBand::lookahead() const
+    Number of input samples required after the sample to produce the
+    corresponding output.
+
+  \fn int HalfBand::length() const
+    Filter length.
+******************************************************************************/
+
+class HalfBand
+{
+public:
+  enum mode_t { decimate, interpolate };
+
+  HalfBand();
+
+  static int coefs(double fp, double a);
+
+  void init(mode_t mode, int nch, double fp, double a, size_t max_block);
+  void reset();
+
+  size_t process(samples_t in, size_t n, samples_t out);
+
+  size_t max_output(size_t n) const
+  { return mode == decimate? n / 2 + 1: n * 2; }
+
+  int lookahead() const
+  { return mode == decimate? 2 * nk + 1: nk + 1; }
+
+  int length() const
+  { return 4 * nk - 1; }
+
+protected:
+  mode_t mode;
+  int nch;
+  int nk;             // number of coefficients (K + 1)
+  Samples coef;       // folded coefficients [nk]
+
+  // Decimator keeps even and odd input samples separately, so the folded
+  // sums read contiguous data. Both buffers start with nk zeros.
+  // Interpolator keeps the input at 'even' buffer only.
+  SampleBuf even;
+  SampleBuf odd;
+  size_t neven;       // samples at the even buffer
+  size_t nodd;        // samples at the odd buffer
+  size_t pos;         // next output position at the buffers
+};
+
+#endif
@@ -0,0 +1,176 @@
+#include "part_conv.h"
+
+PartConv::PartConv():
+  block_size(0), nparts(0), nch(0), nfilters(0)
+{
+  for (int i = 0; i < NCHANNELS; i++)
+  {
+    fdl_pos[i] = 0;
+    part_begin[i] = 0;
+    part_end[i] = 0;
+  }
+}
+
+void
+PartConv::init(int nch_, int nfilters_, int block_size_, int max_length)
+{
+  assert(nch_ > 0 && nch_ <= NCHANNELS);
+  assert(nfilters_ > 0 && nfilters_ <= NCHANNELS);
+  assert(block_size_ > 0 && (block_size_ & (block_size_ - 1)) == 0);
+  assert(max_length > 0);
+
+  int nparts_ = (max_length + block_size_ - 1) / block_size_;
+  size_t spectra_size = size_t(nparts_) * block_size_ * 2;
+
+  nch = 0;
+  nfilters = 0;
+  block_size = 0;
+  nparts = 0;
+
+  fft.set_length(block_size_ * 2, nch_);
+  filter.allocate(nfilters_, spectra_size);
+  fdl.allocate(nch_, spectra_size);
+  tail.allocate(nch_, block_size_);
+  acc.allocate(nch_, block_size_ * 2);
+
+  nch = nch_;
+  nfilters = nfilters_;
+  block_size = block_size_;
+  nparts = nparts_;
+
+  filter.zero();
+  for (int i = 0; i < nfilters; i++)
+  {
+    part_begin[i] = 0;
+    part_end[i] = 0;
+  }
+  reset();
+}
+
+void
+PartConv::set_filter(int f, const double *data, int length, int shift)
+{
+  assert(f >= 0 && f < nfilters);
+  assert(shift >= 0 && length + shift <= nparts * block_size);
+
+  const int n = block_size * 2;
+  sample_t *filter_f = filter[f];
+
+  part_begin[f] = 0;
+  part_end[f] = 0;
+  zero_samples(filter_f, nparts * n);
+  if (length <= 0)
+    return;
+
+  // Scale to compensate 2/N factor of the inverse transform
+  for (int i = 0; i < length; i++)
+  {
+    int pos = i + shift;
+    filter_f[(pos / block_size) * n + pos % block_size] = sample_t(data[i] / block_size);
+  }
+
+  part_begin[f] = shift / block_size;
+  part_end[f] = (shift + length - 1) / block_size + 1;
+  for (int part = part_begin[f]; part < part_end[f]; part++)
+    fft.rdft(filter_f + part * n);
+}
+
+void
+PartConv::reset()
+{
+  fdl.zero();
+  tail.zero();
+  for (int ch = 0; ch < nch; ch++)
+    fdl_pos[ch] = 0;
+}
+
+void
+PartConv::process(int f, int ch, sample_t *samples)
+{
+  assert(f >= 0 && f < nfilters);
+  assert(ch >= 0 && ch < nch);
+
+  int filters[NCHANNELS];
+  samples_t s;
+  for (int i = 0; i < nch; i++)
+  {
+    filters[i] = -1;
+    s[i] = 0;
+  }
+  filters[ch] = f;
+  s[ch] = samples;
+  process(filters, s);
+}
+
+void
+PartConv::process(const int *filters, samples_t samples)
+{
+  const int n = block_size * 2;
+  int chs[NCHANNELS];
+  samples_t x, y;
+  int nactive = 0;
+  int i, ch;
+
+  // Transform new blocks into the current FDL slots
+  for (ch = 0; ch < nch; ch++)
+    if (filters[ch] >= 0)
+    {
+      assert(filters[ch] < nfilters);
+      chs[nactive] = ch;
+      x[nactive] = fdl[ch] + fdl_pos[ch] * n;
+      y[nactive] = acc[ch];
+      copy_samples(x[nactive], samples[ch], block_size);
+      zero_samples(x[nactive], block_size, block_size);
+      nactive++;
+    }
+
+  if (!nactive)
+    return;
+
+  fft.rdft(x, nactive);
+
+  // Multiply-accumulate partition spectra with past input spectra.
+  // Partition k is applied to the input block k blocks ago.
+  for (int j = 0; j < nactive; j++)
+  {
+    ch = chs[j];
+    const int f = filters[ch];
+    sample_t *acc_ch = acc[ch];
+    zero_samples(acc_ch, n);
+
+    for (int part = part_begin[f]; part < part_end[f]; part++)
+    {
+      int slot = fdl_pos[ch] - part;
+      if (slot < 0) slot += nparts;
+
+      const sample_t *h = filter[f] + part * n;
+      const sample_t *xs = fdl[ch] + slot * n;
+
+      // Ooura packing: DC and Nyquist are real and stored at [0] and [1]
+      acc_ch[0] += h[0] * xs[0];
+      acc_ch[1] += h[1] * xs[1];
+      for (i = 2; i < n; i += 2)
+      {
+        acc_ch[i  ] += h[i] * xs[i  ] - h[i+1] * xs[i+1];
+        acc_ch[i+1] += h[i] * xs[i+1] + h[i+1] * xs[i  ];
+      }
+    }
+  }
+
+  fft.inv_rdft(y, nactive);
+
+  // Overlap-add
+  for (int j = 0; j < nactive; j++)
+  {
+    ch = chs[j];
+    const sample_t *acc_ch = acc[ch];
+    sample_t *tail_ch = tail[ch];
+    sample_t *out = samples[ch];
+    for (i = 0; i < block_size; i++)
+      out[i] = acc_ch[i] + tail_ch[i];
+    copy_samples(tail_ch, 0, acc_ch, block_size, block_size);
+
+    if (++fdl_pos[ch] >= nparts)
+      fdl_pos[ch] = 0;
+  }
+}
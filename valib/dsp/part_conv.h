@@ -0,0 +1,108 @@
+/**************************************************************************//**
+  \file part_conv.h
+  \brief PartConv: Uniformly partitioned FFT convolution
+******************************************************************************/
+
+#ifndef VALIB_PART_CONV_H
+#define VALIB_PART_CONV_H
+
+#include "../buffer.h"
+#include "fft.h"
+
+/**************************************************************************//**
+  \class PartConv
+  \brief Uniformly partitioned frequency-domain convolution.
+
+  Impulse response is split into partitions of block_size samples. Each
+  input block is transformed once and kept in the frequency-domain delay line
+  (FDL). Output block is the sum of products of partition spectra and the
+  spectra of the corresponding past input blocks:
+
+  \verbatim
+    Y(i) = H(0) * X(i) + H(1) * X(i-1) + ... + H(P-1) * X(i-P+1)
+  \endverbatim
+
+  So the processing latency is block_size samples whatever the filter length
+  is, and the work per block is one forward and one inverse FFT of
+  2 * block_size plus P complex multiplications of spectra.
+
+  Several channels with own delay lines may be processed with the same
+  filter (see process()). Processing all channels in one call transforms
+  them together (see FFT::rdft(samples_t, int)).
+
+  \fn void PartConv::init(int nch, int nfilters, int block_size, int max_length)
+    \param nch        Number of channels (delay lines)
+    \param nfilters   Number of filters
+    \param block_size Partition size (power of 2)
+    \param max_length Maximum length of the impulse response
+
+    Allocate buffers. Filters are initialized to zero response, delay lines
+    are cleared. Can throw std::bad_alloc.
+
+  \fn void PartConv::set_filter(int filter, const double *data, int length, int shift)
+    \param filter Filter number
+    \param data   Impulse response
+    \param length Impulse response length
+    \param shift  Position of the impulse response at the filter
+
+    Set the impulse response of the filter. The response is delayed by
+    'shift' samples; length + shift must not exceed max_length.
+
+  \fn void PartConv::reset()
+    Clear all delay lines.
+
+  \fn void PartConv::process(int filter, int ch, sample_t *samples)
+    \param filter  Filter to use
+    \param ch      Channel (delay line) to process
+    \param samples Block of block_size samples to process
+
+    Convolve the next block of the channel with the filter. Processing is
+    done in-place.
+
+  \fn void PartConv::process(const int *filters, samples_t samples)
+    \param filters Filter for each channel, -1 to skip the channel
+    \param samples Block of block_size samples for each channel
+
+    Convolve the next block of all channels in one pass. Processing is done
+    in-place.
+
+  \fn int PartConv::get_block_size() const
+    Partition size.
+
+  \fn int PartConv::get_nparts() const
+    Number of partitions.
+******************************************************************************/
+
+class PartConv
+{
+protected:
+  FFT fft;
+  int block_size;
+  int nparts;
+  int nch;
+  int nfilters;
+
+  SampleBuf filter;  // partition spectra of each filter
+  SampleBuf fdl;     // spectra of past input blocks of each channel
+  SampleBuf tail;    // overlap-add tail of each channel
+  SampleBuf acc;     // spectrum accumulator of each channel
+
+  int fdl_pos[NCHANNELS];     // current FDL slot of each channel
+  int part_begin[NCHANNELS];  // first non-zero partition of each filter
+  int part_end[NCHANNELS];    // last non-zero partition + 1 of each filter
+
+public:
+  PartConv();
+
+  void init(int nch, int nfilters, int block_size, int max_length);
+  void set_filter(int filter, const double *data, int length, int shift = 0);
+  void reset();
+
+  void process(int filter, int ch, sample_t *samples);
+  void process(const int *filters, samples_t samples);
+
+  int get_block_size() const { return block_size; }
+  int get_nparts() const { return nparts; }
+};
+
+#endif
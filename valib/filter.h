@@ -11,6 +11,7 @@
 #include "exception.h"
 
 class Filter;
+class Arena;
 
 /**************************************************************************//**
   \class Filter
@@ -86,6 +87,11 @@ class Filter;
   Note, that some filters may behave differently depending on the input format
   and/or its settings (see Mixer).
 
+  Chunk data may be placed into a reference-counted buffer (see Chunk::buf).
+  In this case several consumers may get and keep the same data without
+  copying. So inplace filters must call Chunk::make_writable() before
+  changing the data: it copies the buffer when it is shared.
+
   \subsection filter_by_streaming By streaming type
 
   Filters may break the output stream and start a new one. We may classify
@@ -526,6 +532,17 @@ class Filter;
 
     This function should not throw.
 
+  \fn void Filter::set_arena(Arena *arena)
+    \param arena Arena for the working buffers or null.
+
+    Filter graph calls this before and after open() to let the filter take
+    its working buffers from the graph's arena (see Arena). Memory taken
+    from the arena is valid until the filter is closed, so a filter should
+    use the arena only to allocate buffers at open() and must allocate them
+    again at the next open().
+
+    Default implementation ignores the arena.
+
   \name Processing
 
   \fn void Filter::reset()
@@ -697,6 +714,8 @@ public:
   virtual void close() = 0;
   virtual bool is_open() const = 0;
 
+  virtual void set_arena(Arena *arena) {}
+
   /////////////////////////////////////////////////////////
   // Processing
 
@@ -779,6 +798,15 @@ public:
   \fn void SimpleFilter::uninit()
     Override this to free resources allocated by init().
 
+  \fn void SimpleFilter::set_arena(Arena *arena)
+    Sets the arena member. When init() is called by the filter graph, the
+    arena member points to the graph's arena, so init() may allocate working
+    buffers with it:
+    \code
+    buf.allocate(nch, nsamples, arena);
+    \endcode
+    Otherwise the arena is null and buffers are allocated from the pool.
+
   \name Processing
 
   \fn void SimpleFilter::reset()
@@ -805,9 +833,10 @@ class SimpleFilter : public Filter
 protected:
   bool f_open;
   Speakers spk;
+  Arena *arena; ///< Arena for the buffers allocated by init()
 
 public:
-  SimpleFilter(): f_open(false)
+  SimpleFilter(): f_open(false), arena(0)
   {}
 
   /////////////////////////////////////////////////////////
@@ -839,6 +868,9 @@ public:
   virtual bool is_open() const
   { return f_open; }
 
+  virtual void set_arena(Arena *new_arena)
+  { arena = new_arena; }
+
   /////////////////////////////////////////////////////////
   // Init/Uninit placeholders
 
@@ -953,6 +985,9 @@ public:
   virtual bool is_open() const
   { return f? f->is_open(): false; }
 
+  virtual void set_arena(Arena *arena)
+  { if (f) f->set_arena(arena); }
+
   /////////////////////////////////////////////////////////
   // Processing
 
@@ -17,6 +17,10 @@ AGC::AGC()
 
   level     = 0;
 
+  peak_kernel   = 0;
+  window_kernel = 0;
+  clip_kernel   = 0;
+
   // Options
   auto_gain = true;
   normalize = false;
@@ -48,11 +52,17 @@ AGC::init()
 {
   const int nch = spk.nch();
 
+  peak_kernel   = nch_kernel<PeakKernel, peak_kernel_t>(nch);
+  window_kernel = nch_kernel<WindowKernel, window_kernel_t>(nch);
+  clip_kernel   = nch_kernel<ClipKernel, clip_kernel_t>(nch);
+  if (!peak_kernel || !window_kernel || !clip_kernel)
+    return false;
+
   // allocate buffers
   nsamples = loudness_interval * spk.sample_rate;
-  buf[0].allocate(nch, nsamples);
-  buf[1].allocate(nch, nsamples);
-  w.allocate(2, nsamples);
+  buf[0].allocate(nch, nsamples, arena);
+  buf[1].allocate(nch, nsamples, arena);
+  w.allocate(2, nsamples, arena);
 
   // hann window
   double f = 2.0 * M_PI / (nsamples * 2);
@@ -81,7 +91,6 @@ AGC::fill_buffer(Chunk &chunk)
 void 
 AGC::process()
 {
-  size_t s;
   int ch, nch = spk.nch();
   sample_t spk_level = spk.level;
 
@@ -102,9 +111,13 @@ AGC::process()
 
   // block level
 
+  sample_t max_level[NCHANNELS];
+  (*peak_kernel)(max_level, buf[block], nsamples);
+
   level = 0;
   for (ch = 0; ch < nch; ch++)
-    level = max_samples(level, buf[block][ch], nsamples);
+    if (max_level[ch] > level)
+      level = max_level[ch];
   level = level / spk_level;
 
   // Here 'level' is block peak-level. Normally, this level should not be 
@@ -155,15 +168,8 @@ AGC::process()
   // * no windowing when no gain is applied
 
   if (!EQUAL_SAMPLES(old_gain, gain))
-  {
     // windowing
-    for (ch = 0; ch < nch; ch++)
-    {
-      sample_t *sptr = buf[block][ch];
-      for (s = 0; s < nsamples; s++, sptr++)
-        *sptr = *sptr * (old_gain * w[1][s] + gain * w[0][s]);
-    }
-  }
+    (*window_kernel)(buf[block], nsamples, old_gain, w[1], gain, w[0]);
   else if (!EQUAL_SAMPLES(gain, 1.0))
     gain_samples(gain, buf[block], nch, nsamples);
 
@@ -173,16 +179,7 @@ AGC::process()
   // of previous block overflow...
 
   if (level * gain > 1.0 || old_level * old_gain > 1.0)
-    for (ch = 0; ch < nch; ch++)
-    {
-      sample_t *sptr = buf[block][ch];
-      for (s = 0; s < nsamples; s++, sptr++)
-        if (*sptr > +spk_level) 
-          *sptr = +spk_level;
-        else
-        if (*sptr < -spk_level) 
-          *sptr = -spk_level;
-    }
+    (*clip_kernel)(buf[block], nsamples, spk_level);
 
   ///////////////////////////////////////
   // Debug
@@ -23,6 +23,7 @@
 
 #include "../buffer.h"
 #include "../filter.h"
+#include "../nch_kernel.h"
 #include "../sync.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -44,6 +45,10 @@ protected:
 
   sample_t  level;                // previous block level (not scaled)
 
+  peak_kernel_t   peak_kernel;    // kernels for the number of channels
+  window_kernel_t window_kernel;
+  clip_kernel_t   clip_kernel;
+
   inline size_t next_block();
 
   bool fill_buffer(Chunk &chunk);
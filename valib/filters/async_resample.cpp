@@ -0,0 +1,256 @@
+#include <sstream>
+#include <iomanip>
+#include <limits.h>
+#include <math.h>
+#include "async_resample.h"
+#include "dejitter.h"
+#include "../dsp/kaiser.h"
+
+const double AsyncResample::max_ratio_deviation = 0.02;
+const int AsyncResample::phases = 512;
+
+// Input samples processed at once
+static const int block_size = 4096;
+
+inline double sinc(double x) { return x == 0 ? 1 : sin(x)/x; }
+inline double lpf(double t, double freq) { return 2 * freq * sinc(t * 2 * M_PI * freq); }
+
+AsyncResample::AsyncResample(int sample_rate_, double a_, double q_):
+  sample_rate(0), a(100), q(0.95),
+  target_ratio(1.0), ratio(1.0), ratio_time(1.0), ratio_k(1.0),
+  drift_source(0), nch(0), step(1.0), taps(0), half(0),
+  avail(0), pos(0), has_data(false), sync(false), time(0)
+{
+  set(sample_rate_, a_, q_);
+}
+
+bool
+AsyncResample::set(int sample_rate_, double a_, double q_)
+{
+  if (sample_rate_ < 0) return false;
+  if (a_ < 6) return false;
+  if (q_ < 0.1) return false;
+  if (q_ >= 0.9999999999) return false;
+
+  sample_rate = sample_rate_;
+  a = a_;
+  q = q_;
+
+  if (is_open())
+    return open(spk);
+  return true;
+}
+
+void
+AsyncResample::set_ratio(double ratio_)
+{
+  target_ratio = MAX(1.0 - max_ratio_deviation, MIN(1.0 + max_ratio_deviation, ratio_));
+}
+
+void
+AsyncResample::set_ratio_time(double time_)
+{
+  ratio_time = MAX(0.0, time_);
+  ratio_k = 1.0;
+  if (ratio_time > 0 && out_spk.sample_rate > 0)
+    ratio_k = 1.0 - exp(-1.0 / (ratio_time * out_spk.sample_rate));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool
+AsyncResample::init()
+{
+  const int fs = spk.sample_rate;
+  const int fd = sample_rate? sample_rate: fs;
+
+  nch = spk.nch();
+  out_spk = spk;
+  out_spk.sample_rate = fd;
+  step = double(fs) / double(fd);
+  set_ratio_time(ratio_time);
+
+  // Filter is designed at the input sample rate and must pass q of the
+  // bandwidth at the lowest output rate possible.
+  double band = MIN(1.0, double(fd) * (1.0 - max_ratio_deviation) / double(fs));
+  double fc = band * (1 + q) / 4;
+  double df = band * (1 - q) / 2;
+
+  taps = (kaiser_n(a, df) + 1) & ~1;
+  half = taps / 2;
+
+  // Row p is the response at the offset p/phases between input samples.
+  // Extra row is the next input sample's row 0, so interpolation between
+  // rows never wraps.
+  double alpha = kaiser_alpha(a);
+  table.allocate((phases + 1) * taps);
+  for (int p = 0; p <= phases; p++)
+    for (int j = 0; j < taps; j++)
+    {
+      double t = double(p) / phases + half - 1 - j;
+      table[p * taps + j] = sample_t(kaiser_window(t, taps + 1, alpha) * lpf(t, fc));
+    }
+
+  const int max_out = int((block_size + taps) / step * (1 + max_ratio_deviation)) + 4;
+  buf.allocate(nch, half - 1 + block_size + taps);
+  out_buf.allocate(nch, max_out);
+  out_base.allocate(max_out);
+  out_phase.allocate(max_out);
+
+  reset();
+  return true;
+}
+
+void
+AsyncResample::reset()
+{
+  ratio = target_ratio;
+  sync = false;
+  time = 0;
+  has_data = false;
+
+  // Start with half-1 zeros so the first input sample is the center of the
+  // filter for the first output sample.
+  avail = half - 1;
+  pos = half - 1;
+  if (buf.nch())
+    zero_samples(buf, nch, avail);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t
+AsyncResample::resample(int end)
+{
+  // Output positions do not depend on the channel
+  size_t n = 0;
+  while (true)
+  {
+    int base = int(pos);
+    if (base + half >= avail || base >= end)
+      break;
+
+    out_base[n] = base - half + 1;
+    out_phase[n] = (pos - base) * phases;
+    n++;
+
+    ratio += (target_ratio - ratio) * ratio_k;
+    pos += step / ratio;
+  }
+
+  for (int ch = 0; ch < nch; ch++)
+  {
+    const sample_t *in = buf[ch];
+    sample_t *out = out_buf[ch];
+    for (size_t i = 0; i < n; i++)
+    {
+      const sample_t *x = in + out_base[i];
+      const int row = int(out_phase[i]);
+      const double frac = out_phase[i] - row;
+      const sample_t *h0 = table.begin() + row * taps;
+      const sample_t *h1 = h0 + taps;
+
+      double s0 = 0, s1 = 0;
+      for (int j = 0; j < taps; j++)
+      {
+        s0 += x[j] * h0[j];
+        s1 += x[j] * h1[j];
+      }
+      out[i] = sample_t(s0 + (s1 - s0) * frac);
+    }
+  }
+  return n;
+}
+
+void
+AsyncResample::drop_history()
+{
+  // Keep half-1 samples before the next output position
+  int drop = int(pos) - (half - 1);
+  drop = MIN(drop, avail);
+  if (drop <= 0)
+    return;
+
+  move_samples(buf, 0, buf, drop, nch, avail - drop);
+  avail -= drop;
+  pos -= drop;
+}
+
+bool
+AsyncResample::process(Chunk &in, Chunk &out)
+{
+  if (drift_source)
+    set_ratio(1.0 + drift_source->get_drift());
+
+  while (in.size)
+  {
+    // Timestamp of the next output sample. Position does not move between
+    // outputs, so the time stays valid until the next output.
+    if (in.sync)
+    {
+      sync = true;
+      time = in.time + (pos - avail) / spk.sample_rate;
+      in.sync = false;
+      in.time = 0;
+    }
+
+    size_t n = MIN(in.size, size_t(block_size));
+    copy_samples(buf, avail, in.samples, 0, nch, n);
+    avail += int(n);
+    in.drop_samples(n);
+    has_data = true;
+
+    size_t n_out = resample(INT_MAX);
+    drop_history();
+
+    if (n_out)
+    {
+      out.set_linear(out_buf.samples(), n_out);
+      out.set_sync(sync, time);
+      sync = false;
+      time = 0;
+      return true;
+    }
+  }
+
+  out.clear();
+  return false;
+}
+
+bool
+AsyncResample::flush(Chunk &out)
+{
+  if (!has_data)
+    return false;
+
+  // Pad with zeros to finish the outputs up to the last input sample
+  int end = avail;
+  zero_samples(buf, avail, nch, half);
+  avail += half;
+  size_t n_out = resample(end);
+
+  out.set_linear(out_buf.samples(), n_out);
+  out.set_sync(sync, time);
+  reset();
+  return n_out > 0;
+}
+
+string
+AsyncResample::info() const
+{
+  std::stringstream s;
+  s << std::boolalpha << std::fixed << std::setprecision(1);
+  s << "Sample rate: " << sample_rate << "Hz" << nl
+    << "Attenuation: " << a << "dB" << nl
+    << "Quality: " << q << nl
+    << std::setprecision(6)
+    << "Ratio: " << target_ratio << nl
+    << "Current ratio: " << ratio << nl
+    << std::setprecision(1)
+    << "Ratio time: " << ratio_time << "s" << nl
+    << "Follow drift: " << (drift_source != 0) << nl;
+
+  if (is_open())
+    s << "Filter length: " << taps << " x " << phases << " phases" << nl;
+  return s.str();
+}
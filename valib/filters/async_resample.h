@@ -0,0 +1,144 @@
+/**************************************************************************//**
+  \file async_resample.h
+  \brief AsyncResample: Variable-ratio resampling for clock drift compensation
+******************************************************************************/
+
+#ifndef VALIB_ASYNC_RESAMPLE_H
+#define VALIB_ASYNC_RESAMPLE_H
+
+#include "../buffer.h"
+#include "../filter.h"
+
+class Dejitter;
+
+/**************************************************************************//**
+  \class AsyncResample
+  \brief Asynchronous resampler with continuously adjustable ratio.
+
+  Unlike Resample, conversion ratio is not limited to a ratio of integer
+  sample rates and may change during the processing. This allows to
+  compensate the drift between the source and the playback clocks by small
+  (fractions of a percent) changes of the ratio instead of dropping or
+  repeating samples.
+
+  Output sample rate is the nominal conversion rate. The actual ratio of the
+  number of output samples to the number of input samples is:
+
+  \verbatim
+    (sample_rate / input_sample_rate) * ratio
+  \endverbatim
+
+  Ratio is limited to 1 +/- max_ratio_deviation. Ratio changes are smoothed
+  with a one-pole filter with the time constant set by set_ratio_time().
+  Current ratio follows the target ratio sample by sample, so there are no
+  clicks even when the target changes abruptly.
+
+  Interpolation is done with a windowed sinc filter, tabulated at
+  'phases' points per input sample with linear interpolation between the
+  table rows (polyphase filter with interpolated coefficients). Filter is
+  designed for the worst-case ratio, so the passband is preserved over the
+  whole range of ratios.
+
+  Filter may be driven by Dejitter: when the drift source is set, the target
+  ratio is set to 1 + Dejitter::get_drift() before each input chunk is
+  processed. Dejitter must be placed before this filter in the chain.
+
+  \fn AsyncResample::AsyncResample(int sample_rate, double a, double q)
+    \param sample_rate Output sample rate. Zero means the input sample rate.
+    \param a           Attenuation in dB.
+    \param q           Quality (normalized passband width).
+
+  \fn bool AsyncResample::set(int sample_rate, double a, double q)
+    Set the conversion parameters. Returns false for invalid parameters.
+    Filter is reinitialized when open.
+
+  \fn void AsyncResample::set_ratio(double ratio)
+    Set the target ratio. The value is clamped to the allowed range.
+
+  \fn double AsyncResample::get_current_ratio() const
+    Ratio applied to the last sample processed.
+
+  \fn void AsyncResample::set_ratio_time(double time)
+    Time constant of the ratio smoothing in seconds.
+
+  \fn void AsyncResample::set_drift_source(const Dejitter *dejitter)
+    Follow the drift measured by Dejitter. Zero disables this mode.
+******************************************************************************/
+
+class AsyncResample : public SamplesFilter
+{
+public:
+  static const double max_ratio_deviation;
+  static const int phases;
+
+  AsyncResample(int sample_rate = 0, double a = 100, double q = 0.95);
+
+  /////////////////////////////////////////////////////////
+  // Own interface
+
+  bool set(int sample_rate, double a = 100, double q = 0.95);
+  int get_sample_rate() const { return sample_rate; }
+  double get_attenuation() const { return a; }
+  double get_quality() const { return q; }
+
+  void set_ratio(double ratio);
+  double get_ratio() const { return target_ratio; }
+  double get_current_ratio() const { return ratio; }
+
+  void set_ratio_time(double time);
+  double get_ratio_time() const { return ratio_time; }
+
+  void set_drift_source(const Dejitter *dejitter) { drift_source = dejitter; }
+  const Dejitter *get_drift_source() const { return drift_source; }
+
+  /////////////////////////////////////////////////////////
+  // SamplesFilter overrides
+
+  virtual bool init();
+  virtual void reset();
+
+  virtual bool process(Chunk &in, Chunk &out);
+  virtual bool flush(Chunk &out);
+
+  virtual Speakers get_output() const
+  { return out_spk; }
+
+  virtual string info() const;
+
+protected:
+  int sample_rate;      // output sample rate (0 = input sample rate)
+  double a;             // attenuation [dB]
+  double q;             // quality (passband width)
+
+  double target_ratio;  // ratio to reach
+  double ratio;         // current ratio
+  double ratio_time;    // smoothing time constant [s]
+  double ratio_k;       // smoothing factor per output sample
+  const Dejitter *drift_source;
+
+  Speakers out_spk;
+  int nch;
+  double step;          // nominal input step per output sample
+
+  // filter
+  int taps;             // filter length (even)
+  int half;             // taps / 2
+  Samples table;        // filter [phases + 1][taps]
+
+  // processing
+  SampleBuf buf;        // input history [half - 1 + block_size + taps]
+  int avail;            // samples at the buffer
+  double pos;           // position of the next output sample at the buffer
+  SampleBuf out_buf;    // output buffer
+  AutoBuf<int> out_base;     // first input sample of each output
+  AutoBuf<double> out_phase; // table position of each output [0..phases)
+  bool has_data;        // input received after reset
+
+  bool      sync;
+  vtime_t   time;
+
+  size_t resample(int end);
+  void drop_history();
+};
+
+#endif
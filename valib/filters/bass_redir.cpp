@@ -45,30 +45,27 @@ BassRedir::update_filters()
     lpf_iir->apply_gain(gain * ch_gain);
 
     lpf.init(lpf_iir.get());
+
+    const IIRInstance *iir[NCHANNELS];
     for (ch = 0; ch < nch; ch++)
       if ((CH_MASK(order[ch]) & ch_mask) == 0)
-        f[ch].init(hpf_iir.get());
+        iir[ch] = hpf_iir.get();
       else
-        f[ch].init(apf_iir.get());
-
-    for (ch = nch; ch < NCHANNELS; ch++)
-      f[ch].drop();
+        iir[ch] = apf_iir.get();
+    f.init(nch, iir);
   }
   else
   {
     lpf.drop();
-    for (int i = 0; i < nch; i++)
-      f[i].drop();
+    f.drop();
   }
 }
 
 void
 BassRedir::reset()
 {
-  int nch = spk.nch();
   lpf.reset();
-  for (int ch = 0; ch < nch; ch++)
-    f[ch].reset();
+  f.reset();
 
   level = 0;
   level_accum = 0;
@@ -99,6 +96,7 @@ BassRedir::process(Chunk &in, Chunk &out)
     return true;
   }
 
+  out.make_writable();
   int ch, nch = spk.nch();
   order_t order;
   spk.get_order(order);
@@ -132,19 +130,12 @@ BassRedir::process(Chunk &in, Chunk &out)
       level_samples = 0;
     }
 
-    // Do filtering and mix bass
+    // High-pass filter channels to be filtered,
+    // allpass and mix bass to other channels
+    f.process(samples + pos, block_size);
     for (ch = 0; ch < nch; ch++)
-      if ((CH_MASK(order[ch]) & ch_mask) == 0)
-      {
-        // High-pass filter
-        f[ch].process(samples[ch] + pos, block_size);
-      }
-      else
-      {
-        // Allpass and mix bass
-        f[ch].process(samples[ch] + pos, block_size);
+      if ((CH_MASK(order[ch]) & ch_mask) != 0)
         sum_samples(samples[ch] + pos, buf, block_size);
-      }
 
     // Next block
     pos += block_size;
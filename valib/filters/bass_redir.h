@@ -134,7 +134,7 @@ protected:
   size_t    level_samples;  //!< Number of samples accumulated
 
   Samples   buf;            //!< Bass channel buffer
-  IIRFilter f[NCHANNELS];   //!< Channel filters
+  IIRMultiFilter f;         //!< Channel filters
   IIRFilter lpf;            //!< Bass channel lowpass filter
 
   void update_filters();    //!< Recalculate filters
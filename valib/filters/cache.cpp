@@ -150,7 +150,7 @@ CacheFilter::init()
 {
   stream_time = 0;
   buf_samples = round<int>(buf_size * spk.sample_rate);
-  buf.allocate(spk.nch(), buf_samples);
+  buf.allocate(spk.nch(), buf_samples, arena);
   buf.zero();
   cached_samples = 0;
   pos = 0;
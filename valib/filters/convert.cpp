@@ -3,7 +3,21 @@
 
 // todo: PCM-to-PCM conversions
 
-static const int converter_formats = FORMAT_MASK_LINEAR | FORMAT_MASK_PCM16 | FORMAT_MASK_PCM24 | FORMAT_MASK_PCM32 | FORMAT_MASK_PCM16_BE | FORMAT_MASK_PCM24_BE | FORMAT_MASK_PCM32_BE | FORMAT_MASK_PCMFLOAT | FORMAT_MASK_PCMDOUBLE | FORMAT_MASK_LPCM20 | FORMAT_MASK_LPCM24;
+static const int converter_formats = FORMAT_MASK_LINEAR | FORMAT_MASK_PCM16 | FORMAT_MASK_PCM24 | FORMAT_MASK_PCM32 | FORMAT_MASK_PCM16_BE | FORMAT_MASK_PCM24_BE | FORMAT_MASK_PCM32_BE | FORMAT_MASK_PCMFLOAT | FORMAT_MASK_PCMDOUBLE | FORMAT_MASK_LPCM20 | FORMAT_MASK_LPCM24 | FORMAT_CLASS_INTERLEAVED;
+
+// Interleaved linear formats have the same samples as PCM Float and PCM
+// Double, so the same conversion functions are used. Channel order of the
+// interleaved formats is always standard.
+
+static int pcm_format(int format)
+{
+  switch (format)
+  {
+    case FORMAT_INTERLEAVED_FLOAT:  return FORMAT_PCMFLOAT;
+    case FORMAT_INTERLEAVED_DOUBLE: return FORMAT_PCMDOUBLE;
+  }
+  return format;
+}
 
 Converter::Converter(size_t _nsamples)
 {
@@ -18,9 +32,9 @@ convert_t
 Converter::find_conversion(int _format, Speakers _spk) const
 {
   if (_format == FORMAT_LINEAR)
-    return find_pcm2linear(_spk.format, _spk.nch());
+    return find_pcm2linear(pcm_format(_spk.format), _spk.nch());
   else if (_spk.format == FORMAT_LINEAR)
-    return find_linear2pcm(_format, _spk.nch());
+    return find_linear2pcm(pcm_format(_format), _spk.nch());
 
   return 0;
 }
@@ -114,7 +128,8 @@ Converter::convert_pcm2linear(Chunk &in, Chunk &out)
   // Make output chunk and update input
 
   out.set_linear(out_samples, out_size, in.sync, in.time);
-  out.samples.reorder_to_std(spk, order);
+  if (!spk.is_interleaved())
+    out.samples.reorder_to_std(spk, order);
   in.set_rawdata(rawdata, size);
   return !out.is_dummy();
 }
@@ -126,7 +141,8 @@ Converter::convert_linear2pcm(Chunk &in, Chunk &out)
   size_t out_size = n * sample_size(format) * spk.nch();
 
   samples_t samples = in.samples;
-  samples.reorder_from_std(spk, order);
+  if ((FORMAT_MASK(format) & FORMAT_CLASS_INTERLEAVED) == 0)
+    samples.reorder_from_std(spk, order);
 
   convert(out_rawdata, samples, n);
 
@@ -221,7 +237,7 @@ Converter::init()
   if (convert == 0)
     return false;
 
-  buf.allocate(spk.nch() * nsamples * sample_size(format));
+  buf.allocate(spk.nch() * nsamples * sample_size(format), arena);
 
   if (format == FORMAT_LINEAR)
   {
@@ -1,11 +1,13 @@
 /*
   PCM format conversions
 
-  Input formats:   PCMxx, Linear
-  Ouptupt formats: PCMxx, Linear
+  Input formats:   PCMxx, Linear, Interleaved (float/double)
+  Ouptupt formats: PCMxx, Linear, Interleaved (float/double)
   Format conversions:
     Linear -> PCMxx
     PCMxx  -> Linear
+    Linear -> Interleaved
+    Interleaved -> Linear
   Default format conversion:
     Linear -> PCM16
   Timing: Preserve original
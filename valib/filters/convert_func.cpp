@@ -59,12 +59,21 @@
 
   Note, that conversion DOES NOT do scaling. The correct level and no overflow
   guarantee is the task for the caller.
+
+  SIMD
+  ====
+
+  When the processor supports SSE2, find_pcm2linear() and find_linear2pcm()
+  return SSE2 versions of the functions where they are faster (see
+  convert_sse2.h). SSE2 functions give the same result as generic ones for
+  in-range values.
 */
 
 
 
 #include <math.h>
 #include "convert_func.h"
+#include "../cpu.h"
 
 #if defined(_DEBUG) || !defined(_M_IX86)
 
@@ -123,6 +132,7 @@ static inline int32_t s2i(sample_t s)
 
 #include "convert_pcm2linear.h"
 #include "convert_linear2pcm.h"
+#include "convert_sse2.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -157,7 +167,14 @@ convert_t find_pcm2linear(int pcm_format, int nch)
 
   for (int i = 0; i < array_size(pcm2linear_formats); i++)
     if (pcm_format == pcm2linear_formats[i])
+    {
+#ifdef VALIB_SSE2
+      if (i < array_size(pcm2linear_sse2_tbl[0]) && pcm2linear_sse2_tbl[nch-1][i] &&
+          (cpu_features() & cpu_sse2))
+        return pcm2linear_sse2_tbl[nch-1][i];
+#endif
       return pcm2linear_tbl[nch-1][i];
+    }
 
   return 0;
 }
@@ -169,7 +186,14 @@ convert_t find_linear2pcm(int pcm_format, int nch)
 
   for (int i = 0; i < array_size(linear2pcm_formats); i++)
     if (pcm_format == linear2pcm_formats[i])
+    {
+#ifdef VALIB_SSE2
+      if (i < array_size(linear2pcm_sse2_tbl[0]) && linear2pcm_sse2_tbl[nch-1][i] &&
+          (cpu_features() & cpu_sse2))
+        return linear2pcm_sse2_tbl[nch-1][i];
+#endif
       return linear2pcm_tbl[nch-1][i];
+    }
 
   return 0;
 }
@@ -0,0 +1,323 @@
+/* included from convert_func.cpp */
+
+/*
+  SSE2 conversion kernels
+  =======================
+
+  Most of the time of the generic linear to PCM conversion is spent in
+  floor() (or FPU rounding mode switch). SSE2 functions convert samples to
+  integers in 2 stages by blocks of block_frames samples:
+  1) Samples of all channels are interleaved into a temporary buffer.
+     Functions are instantiated for each number of channels so the compiler
+     unrolls the loop over channels. Stereo interleave is vectorized.
+  2) Interleaved samples are converted as one contiguous array. This stage
+     is vectorized for any number of channels.
+
+  Mono conversion skips the first stage. Mono PCM16 and PCM32 to linear
+  conversion is vectorized too.
+
+  Multichannel PCM to linear conversion and floating-point PCM formats are
+  not included: generic functions are limited by memory bandwidth already,
+  and the additional deinterleave stage makes SSE2 versions slower.
+
+  Integer to sample conversion is exactly the same as i2s(). Sample to integer
+  conversion is floor() as s2i() does, but out-of-range values are clipped
+  instead of overflow. SSE2 has no floor instruction, so truncation is
+  corrected for values below the truncated result.
+
+  PCM24 has no vector load/store, so only the conversion itself is
+  vectorized.
+*/
+
+#ifdef VALIB_SSE2
+#include <emmintrin.h>
+
+static const size_t block_frames = 256;
+
+///////////////////////////////////////////////////////////////////////////////
+// Vector helpers
+
+static inline __m128i bswap16_sse2(__m128i v)
+{
+  return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+static inline __m128i bswap32_sse2(__m128i v)
+{
+  v = bswap16_sse2(v);
+  return _mm_or_si128(_mm_slli_epi32(v, 16), _mm_srli_epi32(v, 16));
+}
+
+#ifdef FLOAT_SAMPLE
+
+// Store 4 integers as samples with i2s() conversion
+static inline void store_i2s(sample_t *dst, __m128i i)
+{
+  _mm_storeu_ps(dst, _mm_add_ps(_mm_cvtepi32_ps(i), _mm_set1_ps(0.5f)));
+}
+
+// Load 4 samples, clip and convert with s2i() rounding
+static inline __m128i load_s2i(const sample_t *src, __m128 lo, __m128 hi)
+{
+  __m128 s = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src), lo), hi);
+  __m128i i = _mm_cvttps_epi32(s);
+  __m128 correction = _mm_cmpgt_ps(_mm_cvtepi32_ps(i), s);
+  return _mm_add_epi32(i, _mm_castps_si128(correction));
+}
+
+#else
+
+static inline void store_i2s(sample_t *dst, __m128i i)
+{
+  const __m128d half = _mm_set1_pd(0.5);
+  _mm_storeu_pd(dst,     _mm_add_pd(_mm_cvtepi32_pd(i), half));
+  _mm_storeu_pd(dst + 2, _mm_add_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(i, 0xee)), half));
+}
+
+static inline __m128i s2i_pd(__m128d s, __m128d lo, __m128d hi)
+{
+  s = _mm_min_pd(_mm_max_pd(s, lo), hi);
+  __m128i i = _mm_cvttpd_epi32(s);
+  __m128d correction = _mm_cmpgt_pd(_mm_cvtepi32_pd(i), s);
+  // 64-bit mask lanes to 32-bit lanes
+  return _mm_add_epi32(i, _mm_shuffle_epi32(_mm_castpd_si128(correction), 0x08));
+}
+
+static inline __m128i load_s2i(const sample_t *src, __m128d lo, __m128d hi)
+{
+  __m128i i0 = s2i_pd(_mm_loadu_pd(src), lo, hi);
+  __m128i i1 = s2i_pd(_mm_loadu_pd(src + 2), lo, hi);
+  return _mm_unpacklo_epi64(i0, i1);
+}
+
+#endif
+
+#ifdef FLOAT_SAMPLE
+typedef __m128 vsample_t;
+static inline vsample_t set1_sample(double v) { return _mm_set1_ps(float(v)); }
+#else
+typedef __m128d vsample_t;
+static inline vsample_t set1_sample(double v) { return _mm_set1_pd(v); }
+#endif
+
+// Scalar version of the clipped s2i() for the tails
+static inline int32_t clip_s2i(sample_t s, sample_t lo, sample_t hi)
+{
+  if (s < lo) s = lo;
+  if (s > hi) s = hi;
+  return int32_t(floor(s));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Contiguous conversion
+// to_samples(src, dst, n) converts n PCM values into samples
+// from_samples(src, dst, n) converts n samples into PCM values
+
+template <bool be>
+struct pcm16_sse2
+{
+  static const int sample_size = 2;
+
+  static void to_samples(const uint8_t *src, sample_t *dst, size_t n)
+  {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+      __m128i v = _mm_loadu_si128((const __m128i *)(src + i * 2));
+      if (be) v = bswap16_sse2(v);
+      store_i2s(dst + i,     _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+      store_i2s(dst + i + 4, _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16));
+    }
+    const int16_t *tail = (const int16_t *)src;
+    for (; i < n; i++)
+      dst[i] = i2s(be? be2int16(tail[i]): le2int16(tail[i]));
+  }
+
+  static void from_samples(const sample_t *src, uint8_t *dst, size_t n)
+  {
+    const vsample_t lo = set1_sample(-32768.0);
+    const vsample_t hi = set1_sample(32767.0);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+      __m128i v = _mm_packs_epi32(load_s2i(src + i, lo, hi), load_s2i(src + i + 4, lo, hi));
+      if (be) v = bswap16_sse2(v);
+      _mm_storeu_si128((__m128i *)(dst + i * 2), v);
+    }
+    int16_t *tail = (int16_t *)dst;
+    for (; i < n; i++)
+    {
+      int16_t v = int16_t(clip_s2i(src[i], -32768.0, 32767.0));
+      tail[i] = be? int2be16(v): int2le16(v);
+    }
+  }
+};
+
+template <bool be>
+struct pcm24_sse2
+{
+  static const int sample_size = 3;
+
+  static void from_samples(const sample_t *src, uint8_t *dst, size_t n)
+  {
+    const vsample_t lo = set1_sample(-8388608.0);
+    const vsample_t hi = set1_sample(8388607.0);
+    int24_t *p = (int24_t *)dst;
+    int32_t i32[4];
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      _mm_storeu_si128((__m128i *)i32, load_s2i(src + i, lo, hi));
+      for (int j = 0; j < 4; j++)
+        p[i + j] = be? int2be24(i32[j]): int2le24(i32[j]);
+    }
+    for (; i < n; i++)
+    {
+      int32_t v = clip_s2i(src[i], -8388608.0, 8388607.0);
+      p[i] = be? int2be24(v): int2le24(v);
+    }
+  }
+};
+
+template <bool be>
+struct pcm32_sse2
+{
+  static const int sample_size = 4;
+
+  static void to_samples(const uint8_t *src, sample_t *dst, size_t n)
+  {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      __m128i v = _mm_loadu_si128((const __m128i *)(src + i * 4));
+      if (be) v = bswap32_sse2(v);
+      store_i2s(dst + i, v);
+    }
+    const int32_t *tail = (const int32_t *)src;
+    for (; i < n; i++)
+      dst[i] = i2s(be? be2int32(tail[i]): le2int32(tail[i]));
+  }
+
+  static void from_samples(const sample_t *src, uint8_t *dst, size_t n)
+  {
+    // Max float below 2^31 for float samples
+    const double max32 = sizeof(sample_t) == sizeof(float)? 2147483520.0: 2147483647.0;
+    const vsample_t lo = set1_sample(-2147483648.0);
+    const vsample_t hi = set1_sample(max32);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      __m128i v = load_s2i(src + i, lo, hi);
+      if (be) v = bswap32_sse2(v);
+      _mm_storeu_si128((__m128i *)(dst + i * 4), v);
+    }
+    int32_t *tail = (int32_t *)dst;
+    for (; i < n; i++)
+    {
+      int32_t v = clip_s2i(src[i], -2147483648.0, sample_t(max32));
+      tail[i] = be? int2be32(v): int2le32(v);
+    }
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Interleave
+
+template <int nch>
+static inline void interleave(samples_t src, sample_t *dst, size_t n)
+{
+  const sample_t *s[nch];
+  for (int ch = 0; ch < nch; ch++)
+    s[ch] = src[ch];
+
+  for (size_t i = 0; i < n; i++, dst += nch)
+    for (int ch = 0; ch < nch; ch++)
+      dst[ch] = s[ch][i];
+}
+
+// Stereo is the most common case, so it is vectorized
+
+template <>
+inline void interleave<2>(samples_t src, sample_t *dst, size_t n)
+{
+  const sample_t *l = src[0], *r = src[1];
+  size_t i = 0;
+#ifdef FLOAT_SAMPLE
+  for (; i + 4 <= n; i += 4, dst += 8)
+  {
+    __m128 a = _mm_loadu_ps(l + i), b = _mm_loadu_ps(r + i);
+    _mm_storeu_ps(dst,     _mm_unpacklo_ps(a, b));
+    _mm_storeu_ps(dst + 4, _mm_unpackhi_ps(a, b));
+  }
+#else
+  for (; i + 2 <= n; i += 2, dst += 4)
+  {
+    __m128d a = _mm_loadu_pd(l + i), b = _mm_loadu_pd(r + i);
+    _mm_storeu_pd(dst,     _mm_unpacklo_pd(a, b));
+    _mm_storeu_pd(dst + 2, _mm_unpackhi_pd(a, b));
+  }
+#endif
+  for (; i < n; i++, dst += 2)
+  {
+    dst[0] = l[i];
+    dst[1] = r[i];
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Conversion functions
+
+template <class Format>
+static void pcm2linear_mono_sse2(uint8_t *rawdata, samples_t samples, size_t size)
+{
+  Format::to_samples(rawdata, samples[0], size);
+}
+
+template <class Format, int nch>
+static void linear2pcm_sse2(uint8_t *rawdata, samples_t samples, size_t size)
+{
+  sample_t block[block_frames * nch];
+  while (size)
+  {
+    size_t n = MIN(size, block_frames);
+    if (nch == 1)
+      Format::from_samples(samples[0], rawdata, n);
+    else
+    {
+      interleave<nch>(samples, block, n);
+      Format::from_samples(block, rawdata, n * nch);
+    }
+    rawdata += n * nch * Format::sample_size;
+    samples += n;
+    size -= n;
+  }
+}
+
+// Formats order is the same as linear2pcm_formats (and first formats of
+// pcm2linear_formats). Zero means that the generic function is used.
+
+static const convert_t pcm2linear_sse2_tbl[NCHANNELS][8] = {
+ { pcm2linear_mono_sse2<pcm16_sse2<false> >, 0, pcm2linear_mono_sse2<pcm32_sse2<false> >,
+   pcm2linear_mono_sse2<pcm16_sse2<true> >,  0, pcm2linear_mono_sse2<pcm32_sse2<true> >, 0, 0 },
+ { 0 }, { 0 }, { 0 }, { 0 }, { 0 }, { 0 }, { 0 }
+};
+
+#define SSE2_FORMATS(nch) \
+  linear2pcm_sse2<pcm16_sse2<false>, nch>, linear2pcm_sse2<pcm24_sse2<false>, nch>, linear2pcm_sse2<pcm32_sse2<false>, nch>, \
+  linear2pcm_sse2<pcm16_sse2<true>,  nch>, linear2pcm_sse2<pcm24_sse2<true>,  nch>, linear2pcm_sse2<pcm32_sse2<true>,  nch>, \
+  0, 0
+
+static const convert_t linear2pcm_sse2_tbl[NCHANNELS][8] = {
+ { SSE2_FORMATS(1) },
+ { SSE2_FORMATS(2) },
+ { SSE2_FORMATS(3) },
+ { SSE2_FORMATS(4) },
+ { SSE2_FORMATS(5) },
+ { SSE2_FORMATS(6) },
+ { SSE2_FORMATS(7) },
+ { SSE2_FORMATS(8) },
+};
+
+#undef SSE2_FORMATS
+
+#endif
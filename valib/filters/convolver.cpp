@@ -23,6 +23,7 @@ inline unsigned int clp2(unsigned int x)
 
 Convolver::Convolver(const FIRGen *gen_):
   gen(gen_), fir(0),
+  block_size(0), cur_block_size(0),
   buf_size(0), n(0), c(0),
   pos(0), pre_samples(0), post_samples(0),
   state(state_pass)
@@ -38,55 +39,50 @@ Convolver::~Convolver()
 bool
 Convolver::fir_changed() const
 {
-  return ver != gen.version();
+  return ver != gen.version() || block_size != cur_block_size;
 }
 
 void
 Convolver::convolve()
 {
-  int i;
-  int ch, nch = spk.nch();
-  sample_t *buf_ch, *delay_ch;
+  int filters[NCHANNELS];
+  for (int ch = 0; ch < spk.nch(); ch++)
+    filters[ch] = 0;
 
-  for (ch = 0; ch < nch; ch++)
-    for (int fft_pos = 0; fft_pos < buf_size; fft_pos += n)
-    {
-      buf_ch = buf[ch] + fft_pos;
-      delay_ch = buf[ch] + buf_size;
-
-      copy_samples(fft_buf, buf_ch, n);
-      zero_samples(fft_buf, n, n);
-
-      fft.rdft(fft_buf);
-
-      fft_buf[0] = filter[0] * fft_buf[0];
-      fft_buf[1] = filter[1] * fft_buf[1]; 
-
-      for (i = 1; i < n; i++)
-      {
-        sample_t re,im;
-        re = filter[i*2  ] * fft_buf[i*2] - filter[i*2+1] * fft_buf[i*2+1];
-        im = filter[i*2+1] * fft_buf[i*2] + filter[i*2  ] * fft_buf[i*2+1];
-        fft_buf[i*2  ] = re;
-        fft_buf[i*2+1] = im;
-      }
-
-      fft.inv_rdft(fft_buf);
+  for (int block_pos = 0; block_pos < buf_size; block_pos += n)
+    conv.process(filters, buf.samples() + block_pos);
+}
 
-      for (i = 0; i < n; i++)
-        buf_ch[i] = fft_buf[i] + delay_ch[i];
+void
+Convolver::start_stream()
+{
+  pos = 0;
+  pre_samples = c;
+  post_samples = 0;
+  conv.reset();
+}
 
-      copy_samples(delay_ch, 0, fft_buf, n, n);
-    }
+bool
+Convolver::drop_pre_samples(Chunk &out)
+{
+  // Drop the filter delay at the start of the stream.
+  // It may be longer than the block.
+  if (pre_samples)
+  {
+    size_t drop = MIN(out.size, size_t(pre_samples));
+    out.drop_samples(drop);
+    pre_samples -= (int)drop;
+  }
+  return out.size > 0;
 }
 
 bool Convolver::init()
 {
-  int i;
   int nch = spk.nch();
 
   uninit();
   ver = gen.version();
+  cur_block_size = block_size;
   fir = gen.make(spk.sample_rate);
 
   if (!fir)
@@ -103,7 +99,7 @@ bool Convolver::init()
   }
 
   /////////////////////////////////////////////////////////
-  // Decide filter length
+  // Decide partition and block sizes
 
   if (fir->length <= 0 || fir->center < 0)
     return false;
@@ -114,19 +110,25 @@ bool Convolver::init()
   if (n < min_fft_size / 2)
     n = min_fft_size / 2;
 
-  buf_size = n;
-  if (buf_size < min_chunk_size)
-    buf_size = clp2(min_chunk_size);
+  if (block_size)
+  {
+    buf_size = MAX(clp2(block_size), unsigned(min_fft_size / 2));
+    n = MIN(n, buf_size);
+  }
+  else
+  {
+    buf_size = n;
+    if (buf_size < min_chunk_size)
+      buf_size = clp2(min_chunk_size);
+  }
 
   /////////////////////////////////////////////////////////
-  // Allocate buffers
+  // Allocate buffers and build the filter
 
   try
   {
-    fft.set_length(n * 2);
-    filter.allocate(n * 2);
-    buf.allocate(nch, buf_size + n);
-    fft_buf.allocate(n * 2);
+    conv.init(nch, 1, n, fir->length);
+    buf.allocate(nch, buf_size);
   }
   catch (...)
   {
@@ -134,27 +136,13 @@ bool Convolver::init()
     return false;
   }
 
-  /////////////////////////////////////////////////////////
-  // Build the filter
-
-  for (i = 0; i < fir->length; i++)
-    filter[i] = fir->data[i] / n;
-
-  for (i = i; i < 2 * n; i++)
-    filter[i] = 0;
-
-  fft.rdft(filter);
-
+  conv.set_filter(0, fir->data, fir->length);
   state = state_filter;
 
   /////////////////////////////////////////////////////////
   // Initial state
 
-  pos = 0;
-  pre_samples = c;
-  post_samples = fir->length - c;
-  buf.zero();
-
+  start_stream();
   return true;
 }
 
@@ -177,12 +165,7 @@ Convolver::reset()
 {
   sync.reset();
   if (state == state_filter)
-  {
-    pos = 0;
-    pre_samples = c;
-    post_samples = fir->length - c;
-    buf.zero();
-  }
+    start_stream();
 }
 
 bool
@@ -195,8 +178,8 @@ Convolver::process(Chunk &in, Chunk &out)
 
   if (fir_changed())
   {
-    if (need_flushing())
-      return flush(out);
+    if (need_flushing() && flush(out))
+      return true;
 
     if (!open(spk))
       THROW(EFirChange());
@@ -207,6 +190,9 @@ Convolver::process(Chunk &in, Chunk &out)
 
   if (state != state_filter)
   {
+    if (state != state_pass)
+      in.make_writable();
+
     if (state == state_zero)
       zero_samples(in.samples, nch, in.size);
 
@@ -222,28 +208,28 @@ Convolver::process(Chunk &in, Chunk &out)
   // Convolution
 
   sync.receive_sync(in);
-  if (pos < buf_size)
+  do
   {
     size_t gone = MIN(in.size, size_t(buf_size - pos));
     copy_samples(buf, pos, in.samples, 0, nch, gone);
 
+    // The tail of the filter response must be flushed
+    if (gone)
+      post_samples = c;
+
     pos += (int)gone;
     in.drop_samples(gone);
     sync.put(gone);
 
     if (pos < buf_size)
       return false;
-  }
-
-  pos = 0;
-  convolve();
 
-  out.set_linear(buf, buf_size);
-  if (pre_samples)
-  {
-    out.drop_samples(pre_samples);
-    pre_samples = 0;
+    pos = 0;
+    convolve();
+    out.set_linear(buf, buf_size);
   }
+  while (!drop_pre_samples(out));
+
   sync.send_sync_linear(out, spk.sample_rate);
   return true;
 }
@@ -251,21 +237,32 @@ Convolver::process(Chunk &in, Chunk &out)
 bool
 Convolver::flush(Chunk &out)
 {
-  if (!need_flushing())
-    return false;
+  // Output the rest of the input (pos samples) and the tail of the
+  // response (post_samples). Both may take several blocks.
+  while (need_flushing())
+  {
+    zero_samples(buf, pos, spk.nch(), buf_size - pos);
+    convolve();
 
-  zero_samples(buf, pos, spk.nch(), buf_size - pos);
-  convolve();
+    int size = MIN(pos + post_samples, buf_size);
+    post_samples = pos + post_samples - size;
+    pos = 0;
 
-  post_samples = 0;
-  pos = 0;
+    out.set_linear(buf, size);
+    bool has_data = drop_pre_samples(out);
+    if (!need_flushing())
+      // Prepare for the next stream, buf remains untouched
+      start_stream();
 
-  out.set_linear(buf, pos + c);
-  if (pre_samples)
-  {
-    out.drop_samples(pre_samples);
-    pre_samples = 0;
+    if (has_data)
+    {
+      sync.send_sync_linear(out, spk.sample_rate);
+      return true;
+    }
   }
-  sync.send_sync_linear(out, spk.sample_rate);
-  return true;
+
+  // End of the stream without the tail to output
+  if (state == state_filter)
+    start_stream();
+  return false;
 }
@@ -6,12 +6,17 @@
 #include "../fir.h"
 #include "../sync.h"
 #include "../buffer.h"
-#include "../dsp/fft.h"
+#include "../dsp/part_conv.h"
 
 
 ///////////////////////////////////////////////////////////////////////////////
 // Convolver class
 // Use impulse response to implement FIR filtering.
+//
+// Convolution is done in blocks with uniformly partitioned FFT convolution
+// (see PartConv). Block size defines the processing latency and is
+// independent of the filter length. Zero block size (default) means the whole
+// filter in one partition, with at least 1024 samples block.
 ///////////////////////////////////////////////////////////////////////////////
 
 class Convolver : public SamplesFilter
@@ -22,25 +27,28 @@ protected:
   const FIRInstance *fir;
   SyncHelper sync;
 
+  int block_size;     // requested block size
+  int cur_block_size; // block size the filter was opened with
+
   int buf_size;
   int n, c;
   int pos;
 
-  FFT       fft;
-  Samples   filter;
+  PartConv  conv;
   SampleBuf buf;
-  Samples   fft_buf;
 
   int pre_samples;
   int post_samples;
 
   bool fir_changed() const;
   void convolve();
+  void start_stream();
+  bool drop_pre_samples(Chunk &out);
 
   enum { state_filter, state_zero, state_pass, state_gain } state;
 
   bool need_flushing() const
-  { return state == state_filter && post_samples > 0; }
+  { return state == state_filter && (pos > 0 || post_samples > 0); }
 
 public:
   //! Fir change error
@@ -56,6 +64,13 @@ public:
   const FIRGen *get_fir() const    { return gen.get(); }
   void release_fir()               { gen.release();    }
 
+  /////////////////////////////////////////////////////////
+  // Block size (rounded up to a power of 2, 0 = auto)
+  // Change is applied like the FIR change.
+
+  void set_block_size(int block_size_) { block_size = MAX(0, block_size_); }
+  int  get_block_size() const          { return block_size; }
+
   /////////////////////////////////////////////////////////
   // SamplesFilter overrides
 
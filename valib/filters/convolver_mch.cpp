@@ -22,8 +22,9 @@ inline unsigned int clp2(unsigned int x)
 
 
 ConvolverMch::ConvolverMch():
-  buf_size(0), n(0), c(0),
-  pos(0), pre_samples(0), post_samples(0)
+  block_size(0), cur_block_size(0),
+  buf_size(0), length(0), n(0), c(0),
+  pos(0), need_shift(false), pre_samples(0), post_samples(0)
 {
   for (int ch_name = 0; ch_name < CH_NAMES; ch_name++)
     ver[ch_name] = gen[ch_name].version();
@@ -46,7 +47,7 @@ ConvolverMch::fir_changed() const
   for (int ch_name = 0; ch_name < CH_NAMES; ch_name++)
     if (ver[ch_name] != gen[ch_name].version())
       return true;
-  return false;
+  return block_size != cur_block_size;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -108,47 +109,56 @@ ConvolverMch::process_trivial(samples_t samples, size_t size)
 void
 ConvolverMch::process_convolve()
 {
-  int ch, i;
-  int nch = spk.nch();
-  sample_t *buf_ch, *filter_ch, *delay_ch;
-
-  for (ch = 0; ch < nch; ch++)
-    if (type[ch] == type_conv)
-      for (int fft_pos = 0; fft_pos < buf_size; fft_pos += n)
-      {
-        buf_ch = buf[ch] + fft_pos;
-        delay_ch = buf[ch] + buf_size;
-        filter_ch = filter[ch];
-
-        copy_samples(fft_buf, buf_ch, n);
-        zero_samples(fft_buf, n, n);
-
-        fft.rdft(fft_buf);
+  int filters[NCHANNELS];
+  for (int ch = 0; ch < spk.nch(); ch++)
+    filters[ch] = type[ch] == type_conv? ch: -1;
 
-        fft_buf[0] = filter_ch[0] * fft_buf[0];
-        fft_buf[1] = filter_ch[1] * fft_buf[1]; 
+  for (int block_pos = 0; block_pos < buf_size; block_pos += n)
+    conv.process(filters, buf.samples() + block_pos);
+}
 
-        for (i = 1; i < n; i++)
-        {
-          sample_t re,im;
-          re = filter_ch[i*2  ] * fft_buf[i*2] - filter_ch[i*2+1] * fft_buf[i*2+1];
-          im = filter_ch[i*2+1] * fft_buf[i*2] + filter_ch[i*2  ] * fft_buf[i*2+1];
-          fft_buf[i*2  ] = re;
-          fft_buf[i*2+1] = im;
-        }
+void
+ConvolverMch::shift_delayed()
+{
+  // Trivial channels are delayed by c samples: delayed samples are kept after
+  // the end of the block and moved to the start before the next block.
+  if (need_shift)
+    for (int ch = 0; ch < spk.nch(); ch++)
+      if (type[ch] != type_conv)
+        move_samples(buf[ch], 0, buf[ch], buf_size, c);
+  need_shift = false;
+}
 
-        fft.inv_rdft(fft_buf);
+void
+ConvolverMch::start_stream()
+{
+  // Do not touch the block itself, it may be sent out already
+  for (int ch = 0; ch < spk.nch(); ch++)
+    if (type[ch] != type_conv)
+      zero_samples(buf[ch], buf_size, c);
 
-        for (i = 0; i < n; i++)
-          buf_ch[i] = fft_buf[i] + delay_ch[i];
+  pos = 0;
+  need_shift = true;
+  pre_samples = c;
+  post_samples = 0;
+  conv.reset();
+}
 
-        copy_samples(delay_ch, 0, fft_buf, n, n);
-      }
+bool
+ConvolverMch::drop_pre_samples(Chunk &out)
+{
+  if (pre_samples)
+  {
+    size_t drop = MIN(out.size, size_t(pre_samples));
+    out.drop_samples(drop);
+    pre_samples -= (int)drop;
+  }
+  return out.size > 0;
 }
 
 bool ConvolverMch::init()
 {
-  int i, ch, ch_name;
+  int ch, ch_name;
   int nch = spk.nch();
 
   trivial = true;
@@ -158,6 +168,7 @@ bool ConvolverMch::init()
   // Update versions
   for (ch_name = 0; ch_name < CH_NAMES; ch_name++)
     ver[ch_name] = gen[ch_name].version();
+  cur_block_size = block_size;
 
   order_t order;
   spk.get_order(order);
@@ -204,24 +215,34 @@ bool ConvolverMch::init()
     return true;
 
   /////////////////////////////////////////////////////////
-  // Allocate buffers
+  // Decide partition and block sizes
 
-  n = clp2(max_point - min_point);
+  length = max_point - min_point;
+  n = clp2(length);
   c = -min_point;
 
   if (n < min_fft_size / 2)
     n = min_fft_size / 2;
 
-  buf_size = n;
-  if (buf_size < min_chunk_size)
-    buf_size = clp2(min_chunk_size);
+  if (block_size)
+  {
+    buf_size = MAX(clp2(block_size), unsigned(min_fft_size / 2));
+    n = MIN(n, buf_size);
+  }
+  else
+  {
+    buf_size = n;
+    if (buf_size < min_chunk_size)
+      buf_size = clp2(min_chunk_size);
+  }
+
+  /////////////////////////////////////////////////////////
+  // Allocate buffers and build filters
 
   try
   {
-    fft.set_length(n * 2);
-    filter.allocate(nch, n * 2);
-    buf.allocate(nch, buf_size + n);
-    fft_buf.allocate(n * 2);
+    conv.init(nch, nch, n, length);
+    buf.allocate(nch, buf_size + c);
   }
   catch (...)
   {
@@ -229,25 +250,15 @@ bool ConvolverMch::init()
     return false;
   }
 
-  /////////////////////////////////////////////////////////
-  // Build filters
-
-  filter.zero();
   for (ch = 0; ch < nch; ch++)
     if (type[ch] == type_conv)
-    {
-      for (i = 0; i < fir[ch]->length; i++)
-        filter[ch][i + c - fir[ch]->center] = fir[ch]->data[i] / n;
-      fft.rdft(filter[ch]);
-    }
+      conv.set_filter(ch, fir[ch]->data, fir[ch]->length, c - fir[ch]->center);
 
   /////////////////////////////////////////////////////////
   // Initial state
 
-  pos = 0;
-  pre_samples = c;
-  post_samples = n - c;
   buf.zero();
+  start_stream();
   return true;
 }
 
@@ -255,9 +266,11 @@ void
 ConvolverMch::uninit()
 {
   buf_size = 0;
+  length = 0;
   n = 0;
   c = 0;
   pos = 0;
+  need_shift = false;
 
   trivial = true;
   for (int ch = 0; ch < spk.nch(); ch++)
@@ -274,10 +287,8 @@ void
 ConvolverMch::reset()
 {
   sync.reset();
-  pos = 0;
-  pre_samples = c;
-  post_samples = n - c;
-  buf.zero();
+  if (!trivial)
+    start_stream();
 }
 
 bool
@@ -291,8 +302,8 @@ ConvolverMch::process(Chunk &in, Chunk &out)
 
   if (fir_changed())
   {
-    if (need_flushing())
-      return flush(out);
+    if (need_flushing() && flush(out))
+      return true;
 
     if (!open(spk))
       THROW(EFirChange());
@@ -303,6 +314,7 @@ ConvolverMch::process(Chunk &in, Chunk &out)
 
   if (trivial)
   {
+    in.make_writable();
     process_trivial(in.samples, in.size);
     out = in;
     in.clear();
@@ -313,17 +325,11 @@ ConvolverMch::process(Chunk &in, Chunk &out)
   // Convolution
 
   sync.receive_sync(in);
-
-  // Trivial cases:
-  // Copy delayed samples to the start of the buffer
-  if (pos == 0)
-    for (ch = 0; ch < nch; ch++)
-      if (type[ch] != type_conv)
-        copy_samples(buf[ch], 0, buf[ch], buf_size, c);
-
-  // Accumulate the buffer
-  if (pos < buf_size)
+  do
   {
+    shift_delayed();
+
+    // Accumulate the buffer
     size_t gone = MIN(in.size, size_t(buf_size - pos));
     for (ch = 0; ch < nch; ch++)
       if (type[ch] == type_conv)
@@ -331,24 +337,27 @@ ConvolverMch::process(Chunk &in, Chunk &out)
       else
         // Trivial cases are shifted
         copy_samples(buf[ch], c + pos, in.samples[ch], 0, gone);
+
+    // The tail of the filter response must be flushed
+    if (gone)
+      post_samples = c;
+
     pos += (int)gone;
     in.drop_samples(gone);
     sync.put(gone);
 
     if (pos < buf_size)
       return false;
-  }
 
-  pos = 0;
-  process_trivial(buf, buf_size);
-  process_convolve();
+    pos = 0;
+    process_trivial(buf, buf_size);
+    process_convolve();
+    need_shift = true;
 
-  out.set_linear(buf, buf_size);
-  if (pre_samples)
-  {
-    out.drop_samples(pre_samples);
-    pre_samples = 0;
+    out.set_linear(buf, buf_size);
   }
+  while (!drop_pre_samples(out));
+
   sync.send_sync_linear(out, spk.sample_rate);
   return true;
 }
@@ -358,32 +367,41 @@ ConvolverMch::flush(Chunk &out)
 {
   int ch, nch = spk.nch();
 
-  if (!need_flushing())
-    return false;
-
-  if (pos == 0)
+  // Output the rest of the input (pos samples) and the tail of the
+  // response (post_samples). Both may take several blocks.
+  while (need_flushing())
+  {
+    shift_delayed();
     for (ch = 0; ch < nch; ch++)
-      if (type[ch] != type_conv)
-        copy_samples(buf[ch], 0, buf[ch], buf_size, c);
+      if (type[ch] == type_conv)
+        zero_samples(buf[ch], pos, buf_size - pos);
+      else
+        zero_samples(buf[ch], c + pos, buf_size - pos);
 
-  for (ch = 0; ch < nch; ch++)
-    if (type[ch] == type_conv)
-      zero_samples(buf[ch], pos, buf_size - pos);
+    process_trivial(buf, buf_size);
+    process_convolve();
+    need_shift = true;
 
-  process_trivial(buf, buf_size);
-  process_convolve();
+    int size = MIN(pos + post_samples, buf_size);
+    post_samples = pos + post_samples - size;
+    pos = 0;
 
-  out.set_linear(buf, pos + c);
-  post_samples = 0;
-  pos = 0;
+    out.set_linear(buf, size);
+    bool has_data = drop_pre_samples(out);
+    if (!need_flushing())
+      start_stream();
 
-  if (pre_samples)
-  {
-    out.drop_samples(pre_samples);
-    pre_samples = 0;
+    if (has_data)
+    {
+      sync.send_sync_linear(out, spk.sample_rate);
+      return true;
+    }
   }
-  sync.send_sync_linear(out, spk.sample_rate);
-  return true;
+
+  // End of the stream without the tail to output
+  if (!trivial)
+    start_stream();
+  return false;
 }
 
 string
@@ -397,8 +415,10 @@ ConvolverMch::info() const
   if (trivial)
     s << "Trivial processing (no convolution)\n";
   else
-    s << "Filter length: " << n << nl
-      << "Filter center: " << c << nl;
+    s << "Filter length: " << length << nl
+      << "Filter center: " << c << nl
+      << "Block size: " << buf_size << nl
+      << "Partitions: " << conv.get_nparts() << " x " << n << nl;
 
   order_t order;
   spk.get_order(order);
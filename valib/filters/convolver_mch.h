@@ -6,12 +6,16 @@
 #include "../fir.h"
 #include "../sync.h"
 #include "../buffer.h"
-#include "../dsp/fft.h"
+#include "../dsp/part_conv.h"
 
 
 ///////////////////////////////////////////////////////////////////////////////
 // Multichannel convolver class
 // Use impulse response to implement FIR filtering.
+//
+// Convolution is done with uniformly partitioned FFT convolution (see
+// PartConv and Convolver). Channels with trivial filters are delayed to match
+// the latency of the convolution.
 ///////////////////////////////////////////////////////////////////////////////
 
 class ConvolverMch : public SamplesFilter
@@ -26,24 +30,30 @@ protected:
   const FIRInstance *fir[NCHANNELS];
   enum { type_pass, type_gain, type_zero, type_conv } type[NCHANNELS];
 
+  int block_size;     // requested block size
+  int cur_block_size; // block size the filter was opened with
+
   int buf_size;
+  int length;
   int n, c;
   int pos;
+  bool need_shift;
 
-  FFT       fft;
-  SampleBuf filter;
+  PartConv  conv;
   SampleBuf buf;
-  Samples   fft_buf;
 
   int pre_samples;
   int post_samples;
 
   bool fir_changed() const;
   bool need_flushing() const
-  { return !trivial && post_samples > 0; }
+  { return !trivial && (pos > 0 || post_samples > 0); }
 
   void process_trivial(samples_t samples, size_t size);
   void process_convolve();
+  void shift_delayed();
+  void start_stream();
+  bool drop_pre_samples(Chunk &out);
 
 public:
   //! Fir change error
@@ -63,6 +73,13 @@ public:
   void get_all_firs(const FIRGen *gen[CH_NAMES]);
   void release_all_firs();
 
+  /////////////////////////////////////////////////////////
+  // Block size (rounded up to a power of 2, 0 = auto)
+  // Change is applied like the FIR change.
+
+  void set_block_size(int block_size_) { block_size = MAX(0, block_size_); }
+  int  get_block_size() const          { return block_size; }
+
   /////////////////////////////////////////////////////////
   // SamplesFilter overrides
 
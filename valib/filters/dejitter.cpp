@@ -79,6 +79,8 @@ Dejitter::Dejitter()
 
   dejitter  = true;
   threshold = 0.1;
+
+  last_time = 0;
 }
 
 bool
@@ -143,6 +145,21 @@ Dejitter::reset()
   continuous_time = 0.0;
   istat.reset();
   ostat.reset();
+  tstat.reset();
+  last_time = 0;
+}
+
+vtime_t
+Dejitter::get_drift() const
+{
+  // Total correction applied over the total time of the statistics window
+  if (!dejitter || ostat.size() < min_stat_size || tstat.size() != ostat.size())
+    return 0;
+
+  vtime_t interval = tstat.mean();
+  if (interval <= 0)
+    return 0;
+  return ostat.mean() / interval;
 }
 
 bool 
@@ -174,6 +191,7 @@ Dejitter::process(Chunk &in, Chunk &out)
     out.set_sync(true, time * time_factor + time_shift);
     continuous_sync = true;
     continuous_time = time + out.size * size2time;
+    last_time = time;
     return true;
   }
 
@@ -198,6 +216,8 @@ Dejitter::process(Chunk &in, Chunk &out)
       continuous_time = time;
       istat.reset();
       ostat.reset();
+      tstat.reset();
+      last_time = time;
       return true;
     }
 
@@ -296,6 +316,8 @@ Dejitter::process(Chunk &in, Chunk &out)
 
     istat.push(delta);
     ostat.push(correction);
+    tstat.push(time - last_time);
+    last_time = time;
 
     valib_log(log_trace, log_module, "input:  %-6.0f delta: %-6.0f stddev: %-6.0f mean: %-6.0f", time*1000, delta*1000, istat.stddev()*1000, istat.mean()*1000);
     valib_log(log_trace, log_module, "output: %-6.0f correction: %-6.0f", continuous_time*1000, correction*1000);
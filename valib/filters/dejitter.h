@@ -44,6 +44,8 @@ protected:
   };
   Stat istat;
   Stat ostat;
+  Stat tstat;           // intervals between input timestamps
+  vtime_t last_time;    // last input timestamp
 
 public:
   Dejitter();
@@ -72,6 +74,12 @@ public:
   vtime_t get_output_mean() const                { return ostat.mean(); }
   vtime_t get_output_stddev() const              { return ostat.stddev(); }
 
+  // Clock drift: relative difference between the input timestamps clock and
+  // the sample clock (k - 1 in terms of dejitter.cpp), averaged over the
+  // statistics window. Positive drift means that the source produces less
+  // samples than its sample rate says. Only measured with dejitter enabled.
+  vtime_t get_drift() const;
+
   /////////////////////////////////////////////////////////
   // SimpleFilter overrides
 
@@ -91,7 +91,7 @@ Delay::init()
     if (nsamples < ch_delays[ch])
       nsamples = ch_delays[ch];
 
-  buf.allocate(nch, nsamples * 2);
+  buf.allocate(nch, nsamples * 2, arena);
   buf.zero();
   first_half = true;
   return true;
@@ -116,6 +116,8 @@ Delay::process(Chunk &in, Chunk &out)
   if (!enabled)
     return true; 
 
+  out.make_writable();
+
   if (out.sync)
     out.time += vtime_t(lag) / spk.sample_rate;
 
@@ -12,6 +12,7 @@ Dither::process(Chunk &in, Chunk &out)
 
   if (level > 0.0)
   {
+    out.make_writable();
     if (EQUAL_SAMPLES(level * spk.level, 1.0))
     {
       // most probable convert-to-pcm dithering
@@ -22,6 +22,9 @@ DRC::DRC()
   level     = 0;
   factor    = 0;
 
+  sum_squares_kernel = 0;
+  window_kernel      = 0;
+
   drc       = false;
   drc_power = 0;     // dB; this value has meaning of loudness raise at -50dB level
   drc_level = 1.0;   // factor
@@ -51,11 +54,16 @@ DRC::init()
 {
   const int nch = spk.nch();
 
+  sum_squares_kernel = nch_kernel<SumSquaresKernel, sum_squares_kernel_t>(nch);
+  window_kernel      = nch_kernel<WindowKernel, window_kernel_t>(nch);
+  if (!sum_squares_kernel || !window_kernel)
+    return false;
+
   // allocate buffers
   nsamples = loudness_interval * spk.sample_rate;
-  buf[0].allocate(nch, nsamples);
-  buf[1].allocate(nch, nsamples);
-  w.allocate(2, nsamples);
+  buf[0].allocate(nch, nsamples, arena);
+  buf[1].allocate(nch, nsamples, arena);
+  w.allocate(2, nsamples, arena);
 
   // hann window
   double f = 2.0 * M_PI / (nsamples * 2);
@@ -84,7 +92,6 @@ DRC::fill_buffer(Chunk &chunk)
 void 
 DRC::process()
 {
-  size_t s;
   int ch, nch = spk.nch();
 
   ///////////////////////////////////////
@@ -103,14 +110,12 @@ DRC::process()
 
   // block level
 
+  sample_t sum[NCHANNELS];
+  (*sum_squares_kernel)(sum, buf[block], nsamples);
+
   double level = 0;
   for (ch = 0; ch < nch; ch++)
-  {
-    sample_t sum = 0;
-    for (s = 0; s < nsamples; s++)
-      sum += buf[block][ch][s] * buf[block][ch][s];
-    level += sqrt(sum / nsamples);
-  }
+    level += sqrt(sum[ch] / nsamples);
   level /= spk.level;
 
   // DRC
@@ -152,15 +157,8 @@ DRC::process()
   // * no windowing when no gain is applied
 
   if (!EQUAL_SAMPLES(old_factor, factor))
-  {
     // windowing
-    for (ch = 0; ch < nch; ch++)
-    {
-      sample_t *sptr = buf[block][ch];
-      for (s = 0; s < nsamples; s++, sptr++)
-        *sptr = *sptr * (old_factor * w[1][s] + factor * w[0][s]);
-    }
-  }
+    (*window_kernel)(buf[block], nsamples, old_factor, w[1], factor, w[0]);
   else if (!EQUAL_SAMPLES(factor, 1.0))
     gain_samples(factor, buf[block], nch, nsamples);
 
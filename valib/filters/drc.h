@@ -7,6 +7,7 @@
 
 #include "../buffer.h"
 #include "../filter.h"
+#include "../nch_kernel.h"
 #include "../sync.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +30,9 @@ protected:
   sample_t  factor;               // previous block factor
   sample_t  level;                // previous block level (not scaled)
 
+  sum_squares_kernel_t sum_squares_kernel; // kernels for the number of channels
+  window_kernel_t      window_kernel;
+
   inline size_t next_block();
 
   bool fill_buffer(Chunk &chunk);
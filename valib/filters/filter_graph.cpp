@@ -1,5 +1,6 @@
 #include <algorithm>
 #include "filter_graph.h"
+#include "../cpu.h"
 
 using std::find;
 
@@ -161,6 +162,7 @@ FilterGraph::chain_is_empty() const
 bool
 FilterGraph::process_chain(Chunk &out)
 {
+  DenormalGuard denormal_guard;
   bool allow_chain_rebuild = false;
 
   // When chain is empty we should start processing from
@@ -199,8 +201,11 @@ FilterGraph::process_chain(Chunk &out)
       }
 
       // Exit chain processing
+      // The node does not use its output after the handoff, so release the
+      // buffer reference: the receiver may change the data inplace then.
       node->state = state_processing;
       out = node->output;
+      node->output.buf.release();
       return true;
     }
 
@@ -280,6 +285,7 @@ FilterGraph::process_chain(Chunk &out)
 
       node->state = state_processing;
       node->next->input = node->output;
+      node->output.buf.release();
       node = node->next;
       continue;
 
@@ -296,6 +302,7 @@ FilterGraph::process_chain(Chunk &out)
       node->state = state_processing;
       node->rebuild = no_rebuild;
       node->next->input = node->output;
+      node->output.buf.release();
       node = node->next;
       continue;
 
@@ -390,6 +397,11 @@ void
 FilterGraph::truncate(Node *node)
 {
   node = node->next;
+
+  // Buffers of the removed filters are not used anymore
+  if (node->id != node_end)
+    arena.rewind(node->mark);
+
   while (node->id != node_end)
   {
     node->filter->close();
@@ -455,8 +467,14 @@ FilterGraph::build_chain(Node *node)
     if (!filter)
       return false;
 
-    if (!filter->open(next_spk))
+    Arena::Mark mark = arena.mark();
+    filter->set_arena(&arena);
+    bool ok = filter->open(next_spk);
+    filter->set_arena(0);
+
+    if (!ok)
     {
+      arena.rewind(mark);
       uninit_filter(next_node_id);
       return false;
     }
@@ -471,6 +489,7 @@ FilterGraph::build_chain(Node *node)
     next_node->state  = state_init;
     next_node->rebuild = no_rebuild;
     next_node->flushing = false;
+    next_node->mark   = mark;
 
     // update the list
     node->next->prev = next_node;
@@ -564,7 +583,20 @@ Filter *f5, Filter *f6, Filter *f7, Filter *f8)
 
 
 FilterChain::~FilterChain()
-{}
+{
+  // Filters are not owned, so do not leave them with the arena's buffers
+  close();
+  delete_converters();
+}
+
+void
+FilterChain::delete_converters()
+{
+  std::map<int, Converter *>::iterator it;
+  for (it = converters.begin(); it != converters.end(); ++it)
+    delete it->second;
+  converters.clear();
+}
 
 bool
 FilterChain::add_front(Filter *filter)
@@ -612,19 +644,56 @@ FilterChain::destroy()
   nodes.push_back(Node(node_start, 0));
   nodes.push_back(Node(node_end, 0));
   FilterGraph::destroy();
+  delete_converters();
+}
+
+// Buffer size of the layout conversion node (in samples)
+static const size_t convert_buffer = 2048;
+
+// Same data in the other linear layout
+static Speakers other_layout(Speakers spk)
+{
+  if (spk.is_linear())
+    spk.format = FORMAT_INTERLEAVED;
+  else if (spk.is_interleaved())
+    spk.format = FORMAT_LINEAR;
+  else
+    return spk_unknown;
+  return spk;
 }
 
 int
 FilterChain::next_id(int id_, Speakers spk_) const
 {
-  const_list_iter it = ++find(nodes.begin(), nodes.end(), id_);
-  if (it == nodes.end()) return node_err;
+  // Conversion node continues the chain from the node before it
+  bool converted = id_ >= convert_id;
+  if (converted)
+    id_ = id_ == convert_id? node_start: id_ - convert_id;
+
+  const_list_iter it = find(nodes.begin(), nodes.end(), id_);
+  if (it == nodes.end() || ++it == nodes.end()) return node_err;
+
+  if (!converted && it->filter && !it->filter->can_open(spk_))
+  {
+    Speakers convert_spk = other_layout(spk_);
+    if (!convert_spk.is_unknown() && it->filter->can_open(convert_spk))
+      return id_ == node_start? convert_id: id_ + convert_id;
+  }
   return it->id;
 }
 
 Filter *
 FilterChain::init_filter(int id_, Speakers spk_)
 {
+  if (id_ >= convert_id)
+  {
+    Converter *&conv = converters[id_];
+    if (!conv)
+      conv = new Converter(convert_buffer);
+    conv->set_format(other_layout(spk_).format);
+    return conv;
+  }
+
   const_list_iter it = find(nodes.begin(), nodes.end(), id_);
   if (it == nodes.end()) return 0;
   return it->filter;
@@ -13,13 +13,27 @@
   When format change in the chain change occurs, downstream filters are flushed,
   so it will be no gaps in the output stream. It is important because filters
   may buffer significant amount of data (several seconds for instance).
+
+  Filters of the chain take their working buffers from the graph's arena (see
+  Filter::set_arena()). Each node remembers the arena mark taken before its
+  filter was opened, and when the chain is truncated the arena is rewound to
+  the mark of the first removed node. So a chain rebuild on a format change
+  reuses the memory of the removed filters instead of going to the heap.
+
+  Filters must be closed before the arena is freed. The graph cannot do it
+  in its own destructor, because filters of a derived graph may be destroyed
+  by then. So a derived graph that includes filters it does not own must
+  call close() in its destructor.
 */
 
 #ifndef VALIB_FILTER_GRAPH_H
 #define VALIB_FILTER_GRAPH_H
 
 #include <list>
+#include <map>
 #include "../filter.h"
+#include "../mem_pool.h"
+#include "convert.h"
 #include "passthrough.h"
 
 class FilterGraph : public Filter
@@ -41,10 +55,13 @@ private:
     state_t   state;
     rebuild_t rebuild;
     bool      flushing;
+
+    Arena::Mark mark; // arena position before the filter was opened
   };
 
   Node start;
   Node end;
+  Arena arena;
 
   Passthrough pass_start;
   Passthrough pass_end;
@@ -163,6 +180,18 @@ public:
 ///////////////////////////////////////////////////////////////////////////////
 // FilterChain
 // Connects filters one after another
+//
+// All filters of the chain run on the caller's thread. To run some nodes (or
+// groups of nodes) in parallel, wrap them into ThreadedFilter (see
+// threaded_filter.h) and add the wrapper to the chain. Each wrapper is a
+// pipeline stage running on its own worker thread.
+//
+// Linear data may go in planar (FORMAT_LINEAR) or interleaved
+// (FORMAT_INTERLEAVED) layout. When a filter cannot open the layout produced
+// by the previous node but can open the other one, the chain inserts a
+// conversion node (Converter) between them. So filters that work faster with
+// interleaved data may declare it (accept FORMAT_INTERLEAVED at can_open()),
+// and the conversion happens only where the layout actually changes.
 ///////////////////////////////////////////////////////////////////////////////
 
 class FilterChain : public FilterGraph
@@ -185,6 +214,13 @@ protected:
   std::list<Node> nodes;
   typedef std::list<Node>::const_iterator const_list_iter;
 
+  // Layout conversion nodes. Id of the conversion node is the id of the
+  // previous node plus convert_id (convert_id itself for the start node).
+  // Converters are kept until the chain is destroyed.
+  enum { convert_id = 0x40000000 };
+  std::map<int, Converter *> converters;
+  void delete_converters();
+
   /////////////////////////////////////////////////////////
   // FilterGraph overrides
 
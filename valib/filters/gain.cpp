@@ -3,6 +3,13 @@
 #include <math.h>
 #include "gain.h"
 
+bool
+Gain::init()
+{
+  gain_kernel = nch_kernel<GainKernel, gain_kernel_t>(spk.nch());
+  return gain_kernel != 0;
+}
+
 bool
 Gain::process(Chunk &in, Chunk &out)
 {
@@ -11,11 +18,11 @@ Gain::process(Chunk &in, Chunk &out)
   if (out.is_dummy())
     return false;
 
-  const size_t size = out.size;
   if (!EQUAL_SAMPLES(gain, 1.0))
-    for (int ch = 0; ch < spk.nch(); ch++)
-      for (size_t s = 0; s < size; s++)
-        out.samples[ch][s] *= gain;
+  {
+    out.make_writable();
+    (*gain_kernel)(out.samples, out.size, gain);
+  }
   return true;
 }
 
@@ -6,18 +6,23 @@
 #define VALIB_GAIN_H
 
 #include "../filter.h"
+#include "../nch_kernel.h"
 
 class Gain : public SamplesFilter
 {
+protected:
+  gain_kernel_t gain_kernel;
+
 public:
   double gain;
 
-  Gain(): gain(1.0) {};
-  Gain(double gain_): gain(gain_) {}
+  Gain(): gain_kernel(0), gain(1.0) {};
+  Gain(double gain_): gain_kernel(0), gain(gain_) {}
 
   /////////////////////////////////////////////////////////
   // SamplesFilter overrides
 
+  virtual bool init();
   virtual bool process(Chunk &in, Chunk &out);
   virtual string info() const;
 };
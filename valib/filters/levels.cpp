@@ -173,11 +173,28 @@ LevelsHistogram::get_max_level(int _ch) const
 
 Levels::Levels(size_t _nsamples, int _dbpb)
 {
+  peak_kernel = 0;
+  peak_frames_kernel = 0;
   set_nsamples(_nsamples);
   set_dbpb(_dbpb);
   reset();
 }
 
+bool
+Levels::can_open(Speakers new_spk) const
+{
+  return (new_spk.is_linear() || new_spk.format == FORMAT_INTERLEAVED) &&
+    new_spk.mask != 0 && new_spk.sample_rate != 0;
+}
+
+bool
+Levels::init()
+{
+  peak_kernel = nch_kernel<PeakKernel, peak_kernel_t>(spk.nch());
+  peak_frames_kernel = nch_kernel<PeakFramesKernel, peak_frames_kernel_t>(spk.nch());
+  return peak_kernel && peak_frames_kernel;
+}
+
 void
 Levels::reset()
 {
@@ -209,16 +226,31 @@ Levels::process(Chunk &in, Chunk &out)
   order_t order;
   spk.get_order(order);
 
+  // Interleaved data: peaks of all channels are found in one pass
+  const sample_t *frames = 0;
+  size_t size = out.size;
+  if (spk.is_interleaved())
+  {
+    frames = (const sample_t *)out.rawdata;
+    size = out.size / (nch * sizeof(sample_t));
+  }
+
   size_t pos = 0;
-  while (pos < out.size)
+  while (pos < size)
   {
-    size_t block_size = MIN(out.size - pos, nsamples - sample);
+    size_t block_size = MIN(size - pos, nsamples - sample);
+
+    sample_t max[NCHANNELS];
+    if (frames)
+      (*peak_frames_kernel)(max, frames + pos * nch, block_size);
+    else
+      (*peak_kernel)(max, out.samples + pos, block_size);
 
     for (int ch = 0; ch < nch; ch++)
     {
-      sample_t max = max_samples(0, out.samples[ch] + pos, block_size) * spk_level;
-      if (max > levels[order[ch]])
-        levels[order[ch]] = max;
+      max[ch] *= spk_level;
+      if (max[ch] > levels[order[ch]])
+        levels[order[ch]] = max[ch];
     }
 
     if (sample >= nsamples)
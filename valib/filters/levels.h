@@ -4,7 +4,7 @@
   Levels histogram 
 
   Speakers: unchanged
-  Input formats: Linear
+  Input formats: Linear, Interleaved (sample_t precision)
   Buffering: no
   Timing: unchanged
   Parameters:
@@ -19,6 +19,7 @@
 
 #include <string.h>
 #include "../filter.h"
+#include "../nch_kernel.h"
 
 class LevelsCache;
 class LevelsHistogram;
@@ -95,6 +96,9 @@ protected:
   size_t nsamples; // number of samples per measure block
   size_t sample;   // current sample
   vtime_t continuous_time; // we need continuous time counter
+
+  peak_kernel_t        peak_kernel;        // kernels for the number of channels
+  peak_frames_kernel_t peak_frames_kernel;
  
 public:
   Levels(size_t _nsamples = 1024, int _dbpb = 5);
@@ -118,6 +122,8 @@ public:
   /////////////////////////////////////////////////////////
   // SamplesFilter overrides
 
+  virtual bool can_open(Speakers spk) const;
+  virtual bool init();
   virtual void reset();
   virtual bool process(Chunk &in, Chunk &out);
 };
@@ -2,37 +2,13 @@
 #include <iomanip>
 #include <math.h>
 #include <string.h>
+#include "../cpu.h"
 #include "mixer.h"
 
 static const sample_t LEVEL_SIDE_OF_CENTER_TO_SIDE = sample_t(0.86602540378443864676372317075294);
 static const sample_t LEVEL_SIDE_OF_CENTER_TO_FAR_SIDE = 0.5;
 
 
-typedef void (Mixer::*io_mixfunc_t)(samples_t, samples_t, size_t); // input-output mixing
-typedef void (Mixer::*ip_mixfunc_t)(samples_t, size_t);            // in-place mixing
-
-static const io_mixfunc_t io_mix_tbl[NCHANNELS][NCHANNELS] = {
-  { &Mixer::io_mix11, &Mixer::io_mix12, &Mixer::io_mix13, &Mixer::io_mix14, &Mixer::io_mix15, &Mixer::io_mix16, &Mixer::io_mix17, &Mixer::io_mix18 },
-  { &Mixer::io_mix21, &Mixer::io_mix22, &Mixer::io_mix23, &Mixer::io_mix24, &Mixer::io_mix25, &Mixer::io_mix26, &Mixer::io_mix27, &Mixer::io_mix28 },
-  { &Mixer::io_mix31, &Mixer::io_mix32, &Mixer::io_mix33, &Mixer::io_mix34, &Mixer::io_mix35, &Mixer::io_mix36, &Mixer::io_mix37, &Mixer::io_mix38 },
-  { &Mixer::io_mix41, &Mixer::io_mix42, &Mixer::io_mix43, &Mixer::io_mix44, &Mixer::io_mix45, &Mixer::io_mix46, &Mixer::io_mix47, &Mixer::io_mix48 },
-  { &Mixer::io_mix51, &Mixer::io_mix52, &Mixer::io_mix53, &Mixer::io_mix54, &Mixer::io_mix55, &Mixer::io_mix56, &Mixer::io_mix57, &Mixer::io_mix58 },
-  { &Mixer::io_mix61, &Mixer::io_mix62, &Mixer::io_mix63, &Mixer::io_mix64, &Mixer::io_mix65, &Mixer::io_mix66, &Mixer::io_mix67, &Mixer::io_mix68 },
-  { &Mixer::io_mix71, &Mixer::io_mix72, &Mixer::io_mix73, &Mixer::io_mix74, &Mixer::io_mix75, &Mixer::io_mix76, &Mixer::io_mix77, &Mixer::io_mix78 },
-  { &Mixer::io_mix81, &Mixer::io_mix82, &Mixer::io_mix83, &Mixer::io_mix84, &Mixer::io_mix85, &Mixer::io_mix86, &Mixer::io_mix87, &Mixer::io_mix88 },
-};
-
-static const ip_mixfunc_t ip_mix_tbl[NCHANNELS][NCHANNELS] = {
-  { &Mixer::ip_mix11, &Mixer::ip_mix12, &Mixer::ip_mix13, &Mixer::ip_mix14, &Mixer::ip_mix15, &Mixer::ip_mix16, &Mixer::ip_mix17, &Mixer::ip_mix18 },
-  { &Mixer::ip_mix21, &Mixer::ip_mix22, &Mixer::ip_mix23, &Mixer::ip_mix24, &Mixer::ip_mix25, &Mixer::ip_mix26, &Mixer::ip_mix27, &Mixer::ip_mix28 },
-  { &Mixer::ip_mix31, &Mixer::ip_mix32, &Mixer::ip_mix33, &Mixer::ip_mix34, &Mixer::ip_mix35, &Mixer::ip_mix36, &Mixer::ip_mix37, &Mixer::ip_mix38 },
-  { &Mixer::ip_mix41, &Mixer::ip_mix42, &Mixer::ip_mix43, &Mixer::ip_mix44, &Mixer::ip_mix45, &Mixer::ip_mix46, &Mixer::ip_mix47, &Mixer::ip_mix48 },
-  { &Mixer::ip_mix51, &Mixer::ip_mix52, &Mixer::ip_mix53, &Mixer::ip_mix54, &Mixer::ip_mix55, &Mixer::ip_mix56, &Mixer::ip_mix57, &Mixer::ip_mix58 },
-  { &Mixer::ip_mix61, &Mixer::ip_mix62, &Mixer::ip_mix63, &Mixer::ip_mix64, &Mixer::ip_mix65, &Mixer::ip_mix66, &Mixer::ip_mix67, &Mixer::ip_mix68 },
-  { &Mixer::ip_mix71, &Mixer::ip_mix72, &Mixer::ip_mix73, &Mixer::ip_mix74, &Mixer::ip_mix75, &Mixer::ip_mix76, &Mixer::ip_mix77, &Mixer::ip_mix78 },
-  { &Mixer::ip_mix81, &Mixer::ip_mix82, &Mixer::ip_mix83, &Mixer::ip_mix84, &Mixer::ip_mix85, &Mixer::ip_mix86, &Mixer::ip_mix87, &Mixer::ip_mix88 },
-};
-
 Mixer::Mixer(size_t _nsamples)
 {
   nsamples = _nsamples;
@@ -72,9 +48,6 @@ Mixer::prepare_matrix()
   // Convert input matrix into internal form
   // to achieve maximum performance
 
-  // todo: throw out null columns
-  // todo: zero null output channels instead of matrixing 
-  // todo: do not touch pass-through channels
   // todo: gain channel if possible instead of matrixing
 
   order_t in_order;
@@ -96,16 +69,49 @@ Mixer::prepare_matrix()
         input_gains[in_order[ch1]] * 
         output_gains[out_order[ch2]] * 
         factor;
+
+  // Non-zero elements for each output channel
+  for (int out_ch = 0; out_ch < NCHANNELS; out_ch++)
+  {
+    nterms[out_ch] = 0;
+    pass_through[out_ch] = false;
+  }
+
+  for (int out_ch = 0; out_ch < out_spk.nch(); out_ch++)
+  {
+    for (int in_ch = 0; in_ch < spk.nch(); in_ch++)
+      if (m[in_ch][out_ch] != 0)
+      {
+        term_ch[out_ch][nterms[out_ch]] = in_ch;
+        term_gain[out_ch][nterms[out_ch]] = m[in_ch][out_ch];
+        nterms[out_ch]++;
+      }
+
+    pass_through[out_ch] = 
+      nterms[out_ch] == 1 &&
+      term_ch[out_ch][0] == out_ch &&
+      term_gain[out_ch][0] == 1.0;
+  }
+
+  for (int in_ch = 0; in_ch < NCHANNELS; in_ch++)
+    for (int out_ch = 0; out_ch < NCHANNELS; out_ch++)
+    {
+      frame_gain_double[in_ch][out_ch] = 
+        in_ch < spk.nch() && out_ch < out_spk.nch()? m[in_ch][out_ch]: 0;
+      frame_gain_float[in_ch][out_ch] = float(frame_gain_double[in_ch][out_ch]);
+    }
 }
 
 bool
 Mixer::set_output(Speakers new_spk)
 {
-  if (!new_spk.is_linear() || new_spk.mask == 0)
+  if ((FORMAT_MASK(new_spk.format) & FORMAT_CLASS_LINEAR) == 0 || new_spk.mask == 0)
     return false;
 
   out_spk = new_spk;
   out_spk.sample_rate = spk.sample_rate;
+  if (is_open())
+    out_spk.format = spk.format;
 
   if (is_open())
   {
@@ -123,10 +129,18 @@ Mixer::set_output(Speakers new_spk)
 ///////////////////////////////////////////////////////////
 // Filter interface
 
+bool
+Mixer::can_open(Speakers new_spk) const
+{
+  return (FORMAT_MASK(new_spk.format) & FORMAT_CLASS_LINEAR) != 0 &&
+    new_spk.mask != 0 && new_spk.sample_rate != 0;
+}
+
 bool 
 Mixer::init()
 {
   out_spk.sample_rate = spk.sample_rate;
+  out_spk.format = spk.format;
 
   if (is_buffered())
     buf.allocate(out_spk.nch(), nsamples);
@@ -142,12 +156,38 @@ Mixer::init()
 bool 
 Mixer::process(Chunk &in, Chunk &out)
 {
+  if (spk.is_interleaved())
+  {
+    // Buffer is one memory block, so it is used for interleaved output
+    // at buffered mode (out_nch * nsamples of sample_t, so it holds fewer
+    // double frames when sample_t is float)
+    const size_t in_frame = spk.nch() * spk.sample_size();
+    const size_t out_frame = out_spk.nch() * spk.sample_size();
+    size_t n = in.size / in_frame;
+    if (is_buffered())
+    {
+      n = MIN(nsamples * sizeof(sample_t) / spk.sample_size(), n);
+      frame_mix(in.rawdata, (uint8_t *)buf[0], n);
+      out.set_rawdata((uint8_t *)buf[0], n * out_frame, in.sync, in.time);
+      in.drop_rawdata(n * in_frame);
+    }
+    else
+    {
+      in.make_writable();
+      frame_mix(in.rawdata, in.rawdata, n);
+      // Output keeps the buffer reference of the input
+      out = in;
+      out.size = n * out_frame;
+      in.clear();
+    }
+    return !out.is_dummy();
+  }
+
   if (is_buffered())
   {
     // buffered mixing
     size_t n = MIN(nsamples, in.size);
-    io_mixfunc_t mixfunc = io_mix_tbl[spk.nch()-1][out_spk.nch()-1];
-    (this->*mixfunc)(in.samples, buf, n);
+    io_mix(in.samples, buf, n);
 
     out.set_linear(buf, n, in.sync, in.time);
     in.drop_samples(n);
@@ -156,8 +196,8 @@ Mixer::process(Chunk &in, Chunk &out)
   else
   {
     // in-place mixing
-    ip_mixfunc_t mixfunc = ip_mix_tbl[spk.nch()-1][out_spk.nch()-1];
-    (this->*mixfunc)(in.samples, in.size);
+    in.make_writable();
+    ip_mix(in.samples, in.size);
 
     out = in;
     in.clear();
@@ -546,4201 +586,342 @@ Mixer::calc_matrix()
   prepare_matrix();
 }
 
-
-
 ///////////////////////////////////////////////////////////////////////////////
 // Mixing functions
 ///////////////////////////////////////////////////////////////////////////////
+// Generic matrix kernel. Output channel is a sum of input channels with
+// non-zero matrix elements only (see prepare_matrix()), so sparse matrices
+// (downmixing, upmixing) need much less work than the full matrix product.
+// Samples are processed by blocks to keep input channels in cache while
+// all output channels are calculated.
 
-void Mixer::io_mix11(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    output[0][s] = buf[0];
-  }
-}
-
-void Mixer::io_mix12(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[1]  = input[0][s] * m[0][1];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-  }
-}
-
-void Mixer::io_mix13(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[2]  = input[0][s] * m[0][2];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-  }
-}
-
-void Mixer::io_mix14(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[3]  = input[0][s] * m[0][3];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-  }
-}
-
-void Mixer::io_mix15(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[4]  = input[0][s] * m[0][4];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-  }
-}
-
-void Mixer::io_mix16(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[5]  = input[0][s] * m[0][5];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-  }
-}
-
-void Mixer::io_mix17(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[6]  = input[0][s] * m[0][6];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-  }
-}
-
-void Mixer::io_mix18(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[7]  = input[0][s] * m[0][7];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-    output[7][s] = buf[7];
-  }
-}
-
-void Mixer::io_mix21(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    output[0][s] = buf[0];
-  }
-}
-
-void Mixer::io_mix22(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-  }
-}
-
-void Mixer::io_mix23(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-  }
-}
-
-void Mixer::io_mix24(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-  }
-}
-
-void Mixer::io_mix25(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-  }
-}
-
-void Mixer::io_mix26(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-  }
-}
-
-void Mixer::io_mix27(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-  }
-}
-
-void Mixer::io_mix28(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[7]  = input[0][s] * m[0][7];
-    buf[7] += input[1][s] * m[1][7];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-    output[7][s] = buf[7];
-  }
-}
-
-void Mixer::io_mix31(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    output[0][s] = buf[0];
-  }
-}
-
-void Mixer::io_mix32(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-  }
-}
-
-void Mixer::io_mix33(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-  }
-}
-
-void Mixer::io_mix34(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-  }
-}
-
-void Mixer::io_mix35(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-  }
-}
+static const size_t block_size = 256;
 
-void Mixer::io_mix36(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-  }
-}
+// Kernels are instantiated for each number of terms, so the loop over terms
+// is unrolled by the compiler. Zero number of terms means zero output.
 
-void Mixer::io_mix37(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[6] += input[2][s] * m[2][6];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-  }
-}
+typedef void (*mix_row_t)(const sample_t *const *src, const sample_t *k, sample_t *dst, size_t n);
 
-void Mixer::io_mix38(samples_t input, samples_t output, size_t nsamples)
+template <int nterms>
+static void mix_row(const sample_t *const *src, const sample_t *k, sample_t *dst, size_t n)
 {
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
+  if (nterms == 0)
   {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[6] += input[2][s] * m[2][6];
-    buf[7]  = input[0][s] * m[0][7];
-    buf[7] += input[1][s] * m[1][7];
-    buf[7] += input[2][s] * m[2][7];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-    output[7][s] = buf[7];
+    zero_samples(dst, n);
+    return;
   }
-}
 
-void Mixer::io_mix41(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
+  for (size_t s = 0; s < n; s++)
   {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    output[0][s] = buf[0];
+    sample_t acc = src[0][s] * k[0];
+    for (int t = 1; t < nterms; t++)
+      acc += src[t][s] * k[t];
+    dst[s] = acc;
   }
 }
 
-void Mixer::io_mix42(samples_t input, samples_t output, size_t nsamples)
+static const mix_row_t mix_row_tbl[NCHANNELS + 1] =
 {
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-  }
-}
+  mix_row<0>, mix_row<1>, mix_row<2>, mix_row<3>, mix_row<4>,
+  mix_row<5>, mix_row<6>, mix_row<7>, mix_row<8>
+};
 
-void Mixer::io_mix43(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-  }
-}
+#ifdef VALIB_SSE2
+#include <emmintrin.h>
 
-void Mixer::io_mix44(samples_t input, samples_t output, size_t nsamples)
+// SSE2 version
+#ifdef FLOAT_SAMPLE
+template <int nterms>
+static void mix_row_sse2(const sample_t *const *src, const sample_t *k, sample_t *dst, size_t n)
 {
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
+  if (nterms == 0)
   {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
+    zero_samples(dst, n);
+    return;
   }
-}
 
-void Mixer::io_mix45(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-  }
-}
+  __m128 kv[nterms? nterms: 1];
+  for (int t = 0; t < nterms; t++)
+    kv[t] = _mm_set1_ps(k[t]);
 
-void Mixer::io_mix46(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
+  size_t s = 0;
+  for (; s + 8 <= n; s += 8)
   {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
+    __m128 acc0 = _mm_mul_ps(_mm_loadu_ps(src[0] + s),     kv[0]);
+    __m128 acc1 = _mm_mul_ps(_mm_loadu_ps(src[0] + s + 4), kv[0]);
+    for (int t = 1; t < nterms; t++)
+    {
+      acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(src[t] + s),     kv[t]));
+      acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(src[t] + s + 4), kv[t]));
+    }
+    _mm_storeu_ps(dst + s,     acc0);
+    _mm_storeu_ps(dst + s + 4, acc1);
   }
-}
 
-void Mixer::io_mix47(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[6] += input[2][s] * m[2][6];
-    buf[6] += input[3][s] * m[3][6];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-  }
+  // The tail
+  const sample_t *tail[NCHANNELS];
+  for (int t = 0; t < nterms; t++)
+    tail[t] = src[t] + s;
+  mix_row<nterms>(tail, k, dst + s, n - s);
 }
-
-void Mixer::io_mix48(samples_t input, samples_t output, size_t nsamples)
+#else
+template <int nterms>
+static void mix_row_sse2(const sample_t *const *src, const sample_t *k, sample_t *dst, size_t n)
 {
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
+  if (nterms == 0)
   {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[6] += input[2][s] * m[2][6];
-    buf[6] += input[3][s] * m[3][6];
-    buf[7]  = input[0][s] * m[0][7];
-    buf[7] += input[1][s] * m[1][7];
-    buf[7] += input[2][s] * m[2][7];
-    buf[7] += input[3][s] * m[3][7];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-    output[7][s] = buf[7];
+    zero_samples(dst, n);
+    return;
   }
-}
 
-void Mixer::io_mix51(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    output[0][s] = buf[0];
-  }
-}
+  __m128d kv[nterms? nterms: 1];
+  for (int t = 0; t < nterms; t++)
+    kv[t] = _mm_set1_pd(k[t]);
 
-void Mixer::io_mix52(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
+  size_t s = 0;
+  for (; s + 4 <= n; s += 4)
   {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
+    __m128d acc0 = _mm_mul_pd(_mm_loadu_pd(src[0] + s),     kv[0]);
+    __m128d acc1 = _mm_mul_pd(_mm_loadu_pd(src[0] + s + 2), kv[0]);
+    for (int t = 1; t < nterms; t++)
+    {
+      acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(src[t] + s),     kv[t]));
+      acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(src[t] + s + 2), kv[t]));
+    }
+    _mm_storeu_pd(dst + s,     acc0);
+    _mm_storeu_pd(dst + s + 2, acc1);
   }
-}
 
-void Mixer::io_mix53(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-  }
+  // The tail
+  const sample_t *tail[NCHANNELS];
+  for (int t = 0; t < nterms; t++)
+    tail[t] = src[t] + s;
+  mix_row<nterms>(tail, k, dst + s, n - s);
 }
+#endif
 
-void Mixer::io_mix54(samples_t input, samples_t output, size_t nsamples)
+static const mix_row_t mix_row_sse2_tbl[NCHANNELS + 1] =
 {
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-  }
-}
+  mix_row_sse2<0>, mix_row_sse2<1>, mix_row_sse2<2>, mix_row_sse2<3>, mix_row_sse2<4>,
+  mix_row_sse2<5>, mix_row_sse2<6>, mix_row_sse2<7>, mix_row_sse2<8>
+};
+#endif
 
-void Mixer::io_mix55(samples_t input, samples_t output, size_t nsamples)
+static const mix_row_t *select_mix_row()
 {
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-  }
+#ifdef VALIB_SSE2
+  if (cpu_features() & cpu_sse2)
+    return mix_row_sse2_tbl;
+#endif
+  return mix_row_tbl;
 }
 
-void Mixer::io_mix56(samples_t input, samples_t output, size_t nsamples)
+void
+Mixer::io_mix(samples_t input, samples_t output, size_t size)
 {
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[5] += input[4][s] * m[4][5];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-  }
-}
+  const mix_row_t *mix = select_mix_row();
+  const int out_nch = out_spk.nch();
+  const sample_t *src[NCHANNELS];
 
-void Mixer::io_mix57(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
+  for (size_t pos = 0; pos < size; pos += block_size)
   {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[5] += input[4][s] * m[4][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[6] += input[2][s] * m[2][6];
-    buf[6] += input[3][s] * m[3][6];
-    buf[6] += input[4][s] * m[4][6];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
+    size_t n = MIN(block_size, size - pos);
+    for (int out_ch = 0; out_ch < out_nch; out_ch++)
+    {
+      for (int t = 0; t < nterms[out_ch]; t++)
+        src[t] = input[term_ch[out_ch][t]] + pos;
+      mix[nterms[out_ch]](src, term_gain[out_ch], output[out_ch] + pos, n);
+    }
   }
 }
 
-void Mixer::io_mix58(samples_t input, samples_t output, size_t nsamples)
+void
+Mixer::ip_mix(samples_t samples, size_t size)
 {
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[5] += input[4][s] * m[4][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[6] += input[2][s] * m[2][6];
-    buf[6] += input[3][s] * m[3][6];
-    buf[6] += input[4][s] * m[4][6];
-    buf[7]  = input[0][s] * m[0][7];
-    buf[7] += input[1][s] * m[1][7];
-    buf[7] += input[2][s] * m[2][7];
-    buf[7] += input[3][s] * m[3][7];
-    buf[7] += input[4][s] * m[4][7];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-    output[7][s] = buf[7];
-  }
-}
+  // Output channel overwrites the input channel that may be required to
+  // calculate other output channels. So all output channels of the block
+  // are calculated first, and copied back then.
 
-void Mixer::io_mix61(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    output[0][s] = buf[0];
-  }
-}
+  const mix_row_t *mix = select_mix_row();
+  const int out_nch = out_spk.nch();
+  const sample_t *src[NCHANNELS];
+  sample_t block[NCHANNELS][block_size];
 
-void Mixer::io_mix62(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
+  for (size_t pos = 0; pos < size; pos += block_size)
   {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-  }
-}
+    size_t n = MIN(block_size, size - pos);
+    for (int out_ch = 0; out_ch < out_nch; out_ch++)
+      if (!pass_through[out_ch])
+      {
+        for (int t = 0; t < nterms[out_ch]; t++)
+          src[t] = samples[term_ch[out_ch][t]] + pos;
+        mix[nterms[out_ch]](src, term_gain[out_ch], block[out_ch], n);
+      }
 
-void Mixer::io_mix63(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
+    for (int out_ch = 0; out_ch < out_nch; out_ch++)
+      if (!pass_through[out_ch])
+        copy_samples(samples[out_ch] + pos, block[out_ch], n);
   }
 }
 
-void Mixer::io_mix64(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-  }
-}
+///////////////////////////////////////////////////////////////////////////////
+// Interleaved kernel. All output channels of a frame are calculated at once:
+// the output frame is a sum of matrix rows (frame_gain[in_ch]) multiplied by
+// input samples. The whole input frame is read before the output frame is
+// written, so the kernel works inplace when output frames are not larger
+// than input ones.
+//
+// Kernels are instantiated for both float and double samples, independently
+// of sample_t.
+
+template <class T>
+static void mix_frames(const T *src, int in_nch, T *dst, int out_nch, const T k[NCHANNELS][NCHANNELS], size_t n)
+{
+  T frame[NCHANNELS];
+  for (size_t s = 0; s < n; s++)
+  {
+    for (int out_ch = 0; out_ch < out_nch; out_ch++)
+      frame[out_ch] = src[0] * k[0][out_ch];
+    for (int in_ch = 1; in_ch < in_nch; in_ch++)
+      for (int out_ch = 0; out_ch < out_nch; out_ch++)
+        frame[out_ch] += src[in_ch] * k[in_ch][out_ch];
+    for (int out_ch = 0; out_ch < out_nch; out_ch++)
+      dst[out_ch] = frame[out_ch];
+    src += in_nch;
+    dst += out_nch;
+  }
+}
+
+#ifdef VALIB_SSE2
+
+// SSE2 version. Kernels are instantiated for each number of output vectors
+// (nv), so accumulators are kept in registers. Matrix rows are zero-padded,
+// so the last vector may be partial.
+
+template <int nv>
+static void mix_frames_sse2(const float *src, int in_nch, float *dst, int out_nch, const float k[NCHANNELS][NCHANNELS], size_t n)
+{
+  __m128 kv[NCHANNELS][nv];
+  for (int in_ch = 0; in_ch < in_nch; in_ch++)
+    for (int v = 0; v < nv; v++)
+      kv[in_ch][v] = _mm_loadu_ps(k[in_ch] + v * 4);
+
+  const int full = out_nch / 4;
+  const int tail = out_nch % 4;
+  for (size_t s = 0; s < n; s++)
+  {
+    __m128 acc[nv];
+    __m128 x = _mm_set1_ps(src[0]);
+    for (int v = 0; v < nv; v++)
+      acc[v] = _mm_mul_ps(x, kv[0][v]);
+    for (int in_ch = 1; in_ch < in_nch; in_ch++)
+    {
+      x = _mm_set1_ps(src[in_ch]);
+      for (int v = 0; v < nv; v++)
+        acc[v] = _mm_add_ps(acc[v], _mm_mul_ps(x, kv[in_ch][v]));
+    }
 
-void Mixer::io_mix65(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[4] += input[5][s] * m[5][4];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
+    for (int v = 0; v < full; v++)
+      _mm_storeu_ps(dst + v * 4, acc[v]);
+    if (tail)
+    {
+      float last[4];
+      _mm_storeu_ps(last, acc[nv - 1]);
+      for (int i = 0; i < tail; i++)
+        dst[full * 4 + i] = last[i];
+    }
+    src += in_nch;
+    dst += out_nch;
   }
 }
 
-void Mixer::io_mix66(samples_t input, samples_t output, size_t nsamples)
+template <int nv>
+static void mix_frames_sse2(const double *src, int in_nch, double *dst, int out_nch, const double k[NCHANNELS][NCHANNELS], size_t n)
 {
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[4] += input[5][s] * m[5][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[5] += input[4][s] * m[4][5];
-    buf[5] += input[5][s] * m[5][5];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-  }
-}
+  __m128d kv[NCHANNELS][nv];
+  for (int in_ch = 0; in_ch < in_nch; in_ch++)
+    for (int v = 0; v < nv; v++)
+      kv[in_ch][v] = _mm_loadu_pd(k[in_ch] + v * 2);
 
-void Mixer::io_mix67(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
+  const int full = out_nch / 2;
+  for (size_t s = 0; s < n; s++)
   {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[4] += input[5][s] * m[5][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[5] += input[4][s] * m[4][5];
-    buf[5] += input[5][s] * m[5][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[6] += input[2][s] * m[2][6];
-    buf[6] += input[3][s] * m[3][6];
-    buf[6] += input[4][s] * m[4][6];
-    buf[6] += input[5][s] * m[5][6];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-  }
-}
+    __m128d acc[nv];
+    __m128d x = _mm_set1_pd(src[0]);
+    for (int v = 0; v < nv; v++)
+      acc[v] = _mm_mul_pd(x, kv[0][v]);
+    for (int in_ch = 1; in_ch < in_nch; in_ch++)
+    {
+      x = _mm_set1_pd(src[in_ch]);
+      for (int v = 0; v < nv; v++)
+        acc[v] = _mm_add_pd(acc[v], _mm_mul_pd(x, kv[in_ch][v]));
+    }
 
-void Mixer::io_mix68(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[4] += input[5][s] * m[5][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[5] += input[4][s] * m[4][5];
-    buf[5] += input[5][s] * m[5][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[6] += input[2][s] * m[2][6];
-    buf[6] += input[3][s] * m[3][6];
-    buf[6] += input[4][s] * m[4][6];
-    buf[6] += input[5][s] * m[5][6];
-    buf[7]  = input[0][s] * m[0][7];
-    buf[7] += input[1][s] * m[1][7];
-    buf[7] += input[2][s] * m[2][7];
-    buf[7] += input[3][s] * m[3][7];
-    buf[7] += input[4][s] * m[4][7];
-    buf[7] += input[5][s] * m[5][7];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-    output[7][s] = buf[7];
+    for (int v = 0; v < full; v++)
+      _mm_storeu_pd(dst + v * 2, acc[v]);
+    if (out_nch & 1)
+      _mm_store_sd(dst + full * 2, acc[nv - 1]);
+    src += in_nch;
+    dst += out_nch;
   }
 }
 
-void Mixer::io_mix71(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    output[0][s] = buf[0];
-  }
-}
+typedef void (*mix_frames_float_t)(const float *src, int in_nch, float *dst, int out_nch, const float k[NCHANNELS][NCHANNELS], size_t n);
+typedef void (*mix_frames_double_t)(const double *src, int in_nch, double *dst, int out_nch, const double k[NCHANNELS][NCHANNELS], size_t n);
 
-void Mixer::io_mix72(samples_t input, samples_t output, size_t nsamples)
+static const mix_frames_float_t mix_frames_float_sse2_tbl[NCHANNELS / 4] =
 {
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-  }
-}
+  mix_frames_sse2<1>, mix_frames_sse2<2>
+};
 
-void Mixer::io_mix73(samples_t input, samples_t output, size_t nsamples)
+static const mix_frames_double_t mix_frames_double_sse2_tbl[NCHANNELS / 2] =
 {
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[2] += input[6][s] * m[6][2];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-  }
-}
+  mix_frames_sse2<1>, mix_frames_sse2<2>, mix_frames_sse2<3>, mix_frames_sse2<4>
+};
 
-void Mixer::io_mix74(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[2] += input[6][s] * m[6][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[3] += input[6][s] * m[6][3];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-  }
-}
+#endif
 
-void Mixer::io_mix75(samples_t input, samples_t output, size_t nsamples)
+static void select_mix_frames(const float *src, int in_nch, float *dst, int out_nch, const float k[NCHANNELS][NCHANNELS], size_t n)
 {
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
+#ifdef VALIB_SSE2
+  if (cpu_features() & cpu_sse2)
   {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[2] += input[6][s] * m[6][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[3] += input[6][s] * m[6][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[4] += input[5][s] * m[5][4];
-    buf[4] += input[6][s] * m[6][4];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
+    mix_frames_float_sse2_tbl[(out_nch + 3) / 4 - 1](src, in_nch, dst, out_nch, k, n);
+    return;
   }
+#endif
+  mix_frames(src, in_nch, dst, out_nch, k, n);
 }
 
-void Mixer::io_mix76(samples_t input, samples_t output, size_t nsamples)
+static void select_mix_frames(const double *src, int in_nch, double *dst, int out_nch, const double k[NCHANNELS][NCHANNELS], size_t n)
 {
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
+#ifdef VALIB_SSE2
+  if (cpu_features() & cpu_sse2)
   {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[2] += input[6][s] * m[6][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[3] += input[6][s] * m[6][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[4] += input[5][s] * m[5][4];
-    buf[4] += input[6][s] * m[6][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[5] += input[4][s] * m[4][5];
-    buf[5] += input[5][s] * m[5][5];
-    buf[5] += input[6][s] * m[6][5];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
+    mix_frames_double_sse2_tbl[(out_nch + 1) / 2 - 1](src, in_nch, dst, out_nch, k, n);
+    return;
   }
+#endif
+  mix_frames(src, in_nch, dst, out_nch, k, n);
 }
 
-void Mixer::io_mix77(samples_t input, samples_t output, size_t nsamples)
+void
+Mixer::frame_mix(const uint8_t *input, uint8_t *output, size_t size)
 {
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[2] += input[6][s] * m[6][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[3] += input[6][s] * m[6][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[4] += input[5][s] * m[5][4];
-    buf[4] += input[6][s] * m[6][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[5] += input[4][s] * m[4][5];
-    buf[5] += input[5][s] * m[5][5];
-    buf[5] += input[6][s] * m[6][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[6] += input[2][s] * m[2][6];
-    buf[6] += input[3][s] * m[3][6];
-    buf[6] += input[4][s] * m[4][6];
-    buf[6] += input[5][s] * m[5][6];
-    buf[6] += input[6][s] * m[6][6];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-  }
-}
+  const int in_nch = spk.nch();
+  const int out_nch = out_spk.nch();
 
-void Mixer::io_mix78(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
+  if (input == output && in_nch == out_nch)
   {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[2] += input[6][s] * m[6][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[3] += input[6][s] * m[6][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[4] += input[5][s] * m[5][4];
-    buf[4] += input[6][s] * m[6][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[5] += input[4][s] * m[4][5];
-    buf[5] += input[5][s] * m[5][5];
-    buf[5] += input[6][s] * m[6][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[6] += input[2][s] * m[2][6];
-    buf[6] += input[3][s] * m[3][6];
-    buf[6] += input[4][s] * m[4][6];
-    buf[6] += input[5][s] * m[5][6];
-    buf[6] += input[6][s] * m[6][6];
-    buf[7]  = input[0][s] * m[0][7];
-    buf[7] += input[1][s] * m[1][7];
-    buf[7] += input[2][s] * m[2][7];
-    buf[7] += input[3][s] * m[3][7];
-    buf[7] += input[4][s] * m[4][7];
-    buf[7] += input[5][s] * m[5][7];
-    buf[7] += input[6][s] * m[6][7];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-    output[7][s] = buf[7];
+    bool all_pass = true;
+    for (int out_ch = 0; out_ch < out_nch; out_ch++)
+      all_pass &= pass_through[out_ch];
+    if (all_pass)
+      return;
   }
-}
 
-void Mixer::io_mix81(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[0] += input[7][s] * m[7][0];
-    output[0][s] = buf[0];
-  }
+  if (spk.format == FORMAT_INTERLEAVED_FLOAT)
+    select_mix_frames((const float *)input, in_nch, (float *)output, out_nch, frame_gain_float, size);
+  else
+    select_mix_frames((const double *)input, in_nch, (double *)output, out_nch, frame_gain_double, size);
 }
-
-void Mixer::io_mix82(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[0] += input[7][s] * m[7][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[1] += input[7][s] * m[7][1];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-  }
-}
-
-void Mixer::io_mix83(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[0] += input[7][s] * m[7][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[1] += input[7][s] * m[7][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[2] += input[6][s] * m[6][2];
-    buf[2] += input[7][s] * m[7][2];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-  }
-}
-
-void Mixer::io_mix84(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[0] += input[7][s] * m[7][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[1] += input[7][s] * m[7][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[2] += input[6][s] * m[6][2];
-    buf[2] += input[7][s] * m[7][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[3] += input[6][s] * m[6][3];
-    buf[3] += input[7][s] * m[7][3];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-  }
-}
-
-void Mixer::io_mix85(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[0] += input[7][s] * m[7][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[1] += input[7][s] * m[7][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[2] += input[6][s] * m[6][2];
-    buf[2] += input[7][s] * m[7][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[3] += input[6][s] * m[6][3];
-    buf[3] += input[7][s] * m[7][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[4] += input[5][s] * m[5][4];
-    buf[4] += input[6][s] * m[6][4];
-    buf[4] += input[7][s] * m[7][4];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-  }
-}
-
-void Mixer::io_mix86(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[0] += input[7][s] * m[7][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[1] += input[7][s] * m[7][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[2] += input[6][s] * m[6][2];
-    buf[2] += input[7][s] * m[7][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[3] += input[6][s] * m[6][3];
-    buf[3] += input[7][s] * m[7][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[4] += input[5][s] * m[5][4];
-    buf[4] += input[6][s] * m[6][4];
-    buf[4] += input[7][s] * m[7][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[5] += input[4][s] * m[4][5];
-    buf[5] += input[5][s] * m[5][5];
-    buf[5] += input[6][s] * m[6][5];
-    buf[5] += input[7][s] * m[7][5];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-  }
-}
-
-void Mixer::io_mix87(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[0] += input[7][s] * m[7][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[1] += input[7][s] * m[7][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[2] += input[6][s] * m[6][2];
-    buf[2] += input[7][s] * m[7][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[3] += input[6][s] * m[6][3];
-    buf[3] += input[7][s] * m[7][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[4] += input[5][s] * m[5][4];
-    buf[4] += input[6][s] * m[6][4];
-    buf[4] += input[7][s] * m[7][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[5] += input[4][s] * m[4][5];
-    buf[5] += input[5][s] * m[5][5];
-    buf[5] += input[6][s] * m[6][5];
-    buf[5] += input[7][s] * m[7][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[6] += input[2][s] * m[2][6];
-    buf[6] += input[3][s] * m[3][6];
-    buf[6] += input[4][s] * m[4][6];
-    buf[6] += input[5][s] * m[5][6];
-    buf[6] += input[6][s] * m[6][6];
-    buf[6] += input[7][s] * m[7][6];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-  }
-}
-
-void Mixer::io_mix88(samples_t input, samples_t output, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = input[0][s] * m[0][0];
-    buf[0] += input[1][s] * m[1][0];
-    buf[0] += input[2][s] * m[2][0];
-    buf[0] += input[3][s] * m[3][0];
-    buf[0] += input[4][s] * m[4][0];
-    buf[0] += input[5][s] * m[5][0];
-    buf[0] += input[6][s] * m[6][0];
-    buf[0] += input[7][s] * m[7][0];
-    buf[1]  = input[0][s] * m[0][1];
-    buf[1] += input[1][s] * m[1][1];
-    buf[1] += input[2][s] * m[2][1];
-    buf[1] += input[3][s] * m[3][1];
-    buf[1] += input[4][s] * m[4][1];
-    buf[1] += input[5][s] * m[5][1];
-    buf[1] += input[6][s] * m[6][1];
-    buf[1] += input[7][s] * m[7][1];
-    buf[2]  = input[0][s] * m[0][2];
-    buf[2] += input[1][s] * m[1][2];
-    buf[2] += input[2][s] * m[2][2];
-    buf[2] += input[3][s] * m[3][2];
-    buf[2] += input[4][s] * m[4][2];
-    buf[2] += input[5][s] * m[5][2];
-    buf[2] += input[6][s] * m[6][2];
-    buf[2] += input[7][s] * m[7][2];
-    buf[3]  = input[0][s] * m[0][3];
-    buf[3] += input[1][s] * m[1][3];
-    buf[3] += input[2][s] * m[2][3];
-    buf[3] += input[3][s] * m[3][3];
-    buf[3] += input[4][s] * m[4][3];
-    buf[3] += input[5][s] * m[5][3];
-    buf[3] += input[6][s] * m[6][3];
-    buf[3] += input[7][s] * m[7][3];
-    buf[4]  = input[0][s] * m[0][4];
-    buf[4] += input[1][s] * m[1][4];
-    buf[4] += input[2][s] * m[2][4];
-    buf[4] += input[3][s] * m[3][4];
-    buf[4] += input[4][s] * m[4][4];
-    buf[4] += input[5][s] * m[5][4];
-    buf[4] += input[6][s] * m[6][4];
-    buf[4] += input[7][s] * m[7][4];
-    buf[5]  = input[0][s] * m[0][5];
-    buf[5] += input[1][s] * m[1][5];
-    buf[5] += input[2][s] * m[2][5];
-    buf[5] += input[3][s] * m[3][5];
-    buf[5] += input[4][s] * m[4][5];
-    buf[5] += input[5][s] * m[5][5];
-    buf[5] += input[6][s] * m[6][5];
-    buf[5] += input[7][s] * m[7][5];
-    buf[6]  = input[0][s] * m[0][6];
-    buf[6] += input[1][s] * m[1][6];
-    buf[6] += input[2][s] * m[2][6];
-    buf[6] += input[3][s] * m[3][6];
-    buf[6] += input[4][s] * m[4][6];
-    buf[6] += input[5][s] * m[5][6];
-    buf[6] += input[6][s] * m[6][6];
-    buf[6] += input[7][s] * m[7][6];
-    buf[7]  = input[0][s] * m[0][7];
-    buf[7] += input[1][s] * m[1][7];
-    buf[7] += input[2][s] * m[2][7];
-    buf[7] += input[3][s] * m[3][7];
-    buf[7] += input[4][s] * m[4][7];
-    buf[7] += input[5][s] * m[5][7];
-    buf[7] += input[6][s] * m[6][7];
-    buf[7] += input[7][s] * m[7][7];
-    output[0][s] = buf[0];
-    output[1][s] = buf[1];
-    output[2][s] = buf[2];
-    output[3][s] = buf[3];
-    output[4][s] = buf[4];
-    output[5][s] = buf[5];
-    output[6][s] = buf[6];
-    output[7][s] = buf[7];
-  }
-}
-
-void Mixer::ip_mix11(samples_t samples, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    samples[0][s] = buf[0];
-  }
-}
-
-void Mixer::ip_mix12(samples_t samples, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-  }
-}
-
-void Mixer::ip_mix13(samples_t samples, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-  }
-}
-
-void Mixer::ip_mix14(samples_t samples, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-  }
-}
-
-void Mixer::ip_mix15(samples_t samples, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-  }
-}
-
-void Mixer::ip_mix16(samples_t samples, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-  }
-}
-
-void Mixer::ip_mix17(samples_t samples, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-  }
-}
-
-void Mixer::ip_mix18(samples_t samples, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[7]  = samples[0][s] * m[0][7];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-    samples[7][s] = buf[7];
-  }
-}
-
-void Mixer::ip_mix21(samples_t samples, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    samples[0][s] = buf[0];
-  }
-}
-
-void Mixer::ip_mix22(samples_t samples, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-  }
-}
-
-void Mixer::ip_mix23(samples_t samples, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-  }
-}
-
-void Mixer::ip_mix24(samples_t samples, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-  }
-}
-
-void Mixer::ip_mix25(samples_t samples, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-  }
-}
-
-void Mixer::ip_mix26(samples_t samples, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-  }
-}
-
-void Mixer::ip_mix27(samples_t samples, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-  }
-}
-
-void Mixer::ip_mix28(samples_t samples, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[7]  = samples[0][s] * m[0][7];
-    buf[7] += samples[1][s] * m[1][7];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-    samples[7][s] = buf[7];
-  }
-}
-
-void Mixer::ip_mix31(samples_t samples, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    samples[0][s] = buf[0];
-  }
-}
-
-void Mixer::ip_mix32(samples_t samples, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-  }
-}
-
-void Mixer::ip_mix33(samples_t samples, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-  }
-}
-
-void Mixer::ip_mix34(samples_t samples, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-  }
-}
-
-void Mixer::ip_mix35(samples_t samples, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-  }
-}
-
-void Mixer::ip_mix36(samples_t samples, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-  }
-}
-
-void Mixer::ip_mix37(samples_t samples, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[6] += samples[2][s] * m[2][6];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-  }
-}
-
-void Mixer::ip_mix38(samples_t samples, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[6] += samples[2][s] * m[2][6];
-    buf[7]  = samples[0][s] * m[0][7];
-    buf[7] += samples[1][s] * m[1][7];
-    buf[7] += samples[2][s] * m[2][7];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-    samples[7][s] = buf[7];
-  }
-}
-
-void Mixer::ip_mix41(samples_t samples, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    samples[0][s] = buf[0];
-  }
-}
-
-void Mixer::ip_mix42(samples_t samples, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-  }
-}
-
-void Mixer::ip_mix43(samples_t samples, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-  }
-}
-
-void Mixer::ip_mix44(samples_t samples, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-  }
-}
-
-void Mixer::ip_mix45(samples_t samples, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-  }
-}
-
-void Mixer::ip_mix46(samples_t samples, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-  }
-}
-
-void Mixer::ip_mix47(samples_t samples, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[6] += samples[2][s] * m[2][6];
-    buf[6] += samples[3][s] * m[3][6];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-  }
-}
-
-void Mixer::ip_mix48(samples_t samples, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[6] += samples[2][s] * m[2][6];
-    buf[6] += samples[3][s] * m[3][6];
-    buf[7]  = samples[0][s] * m[0][7];
-    buf[7] += samples[1][s] * m[1][7];
-    buf[7] += samples[2][s] * m[2][7];
-    buf[7] += samples[3][s] * m[3][7];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-    samples[7][s] = buf[7];
-  }
-}
-
-void Mixer::ip_mix51(samples_t samples, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    samples[0][s] = buf[0];
-  }
-}
-
-void Mixer::ip_mix52(samples_t samples, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-  }
-}
-
-void Mixer::ip_mix53(samples_t samples, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-  }
-}
-
-void Mixer::ip_mix54(samples_t samples, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-  }
-}
-
-void Mixer::ip_mix55(samples_t samples, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-  }
-}
-
-void Mixer::ip_mix56(samples_t samples, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[5] += samples[4][s] * m[4][5];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-  }
-}
-
-void Mixer::ip_mix57(samples_t samples, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[5] += samples[4][s] * m[4][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[6] += samples[2][s] * m[2][6];
-    buf[6] += samples[3][s] * m[3][6];
-    buf[6] += samples[4][s] * m[4][6];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-  }
-}
-
-void Mixer::ip_mix58(samples_t samples, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[5] += samples[4][s] * m[4][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[6] += samples[2][s] * m[2][6];
-    buf[6] += samples[3][s] * m[3][6];
-    buf[6] += samples[4][s] * m[4][6];
-    buf[7]  = samples[0][s] * m[0][7];
-    buf[7] += samples[1][s] * m[1][7];
-    buf[7] += samples[2][s] * m[2][7];
-    buf[7] += samples[3][s] * m[3][7];
-    buf[7] += samples[4][s] * m[4][7];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-    samples[7][s] = buf[7];
-  }
-}
-
-void Mixer::ip_mix61(samples_t samples, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    samples[0][s] = buf[0];
-  }
-}
-
-void Mixer::ip_mix62(samples_t samples, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-  }
-}
-
-void Mixer::ip_mix63(samples_t samples, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-  }
-}
-
-void Mixer::ip_mix64(samples_t samples, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-  }
-}
-
-void Mixer::ip_mix65(samples_t samples, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[4] += samples[5][s] * m[5][4];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-  }
-}
-
-void Mixer::ip_mix66(samples_t samples, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[4] += samples[5][s] * m[5][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[5] += samples[4][s] * m[4][5];
-    buf[5] += samples[5][s] * m[5][5];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-  }
-}
-
-void Mixer::ip_mix67(samples_t samples, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[4] += samples[5][s] * m[5][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[5] += samples[4][s] * m[4][5];
-    buf[5] += samples[5][s] * m[5][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[6] += samples[2][s] * m[2][6];
-    buf[6] += samples[3][s] * m[3][6];
-    buf[6] += samples[4][s] * m[4][6];
-    buf[6] += samples[5][s] * m[5][6];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-  }
-}
-
-void Mixer::ip_mix68(samples_t samples, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[4] += samples[5][s] * m[5][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[5] += samples[4][s] * m[4][5];
-    buf[5] += samples[5][s] * m[5][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[6] += samples[2][s] * m[2][6];
-    buf[6] += samples[3][s] * m[3][6];
-    buf[6] += samples[4][s] * m[4][6];
-    buf[6] += samples[5][s] * m[5][6];
-    buf[7]  = samples[0][s] * m[0][7];
-    buf[7] += samples[1][s] * m[1][7];
-    buf[7] += samples[2][s] * m[2][7];
-    buf[7] += samples[3][s] * m[3][7];
-    buf[7] += samples[4][s] * m[4][7];
-    buf[7] += samples[5][s] * m[5][7];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-    samples[7][s] = buf[7];
-  }
-}
-
-void Mixer::ip_mix71(samples_t samples, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    samples[0][s] = buf[0];
-  }
-}
-
-void Mixer::ip_mix72(samples_t samples, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-  }
-}
-
-void Mixer::ip_mix73(samples_t samples, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[2] += samples[6][s] * m[6][2];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-  }
-}
-
-void Mixer::ip_mix74(samples_t samples, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[2] += samples[6][s] * m[6][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[3] += samples[6][s] * m[6][3];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-  }
-}
-
-void Mixer::ip_mix75(samples_t samples, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[2] += samples[6][s] * m[6][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[3] += samples[6][s] * m[6][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[4] += samples[5][s] * m[5][4];
-    buf[4] += samples[6][s] * m[6][4];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-  }
-}
-
-void Mixer::ip_mix76(samples_t samples, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[2] += samples[6][s] * m[6][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[3] += samples[6][s] * m[6][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[4] += samples[5][s] * m[5][4];
-    buf[4] += samples[6][s] * m[6][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[5] += samples[4][s] * m[4][5];
-    buf[5] += samples[5][s] * m[5][5];
-    buf[5] += samples[6][s] * m[6][5];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-  }
-}
-
-void Mixer::ip_mix77(samples_t samples, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[2] += samples[6][s] * m[6][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[3] += samples[6][s] * m[6][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[4] += samples[5][s] * m[5][4];
-    buf[4] += samples[6][s] * m[6][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[5] += samples[4][s] * m[4][5];
-    buf[5] += samples[5][s] * m[5][5];
-    buf[5] += samples[6][s] * m[6][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[6] += samples[2][s] * m[2][6];
-    buf[6] += samples[3][s] * m[3][6];
-    buf[6] += samples[4][s] * m[4][6];
-    buf[6] += samples[5][s] * m[5][6];
-    buf[6] += samples[6][s] * m[6][6];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-  }
-}
-
-void Mixer::ip_mix78(samples_t samples, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[2] += samples[6][s] * m[6][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[3] += samples[6][s] * m[6][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[4] += samples[5][s] * m[5][4];
-    buf[4] += samples[6][s] * m[6][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[5] += samples[4][s] * m[4][5];
-    buf[5] += samples[5][s] * m[5][5];
-    buf[5] += samples[6][s] * m[6][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[6] += samples[2][s] * m[2][6];
-    buf[6] += samples[3][s] * m[3][6];
-    buf[6] += samples[4][s] * m[4][6];
-    buf[6] += samples[5][s] * m[5][6];
-    buf[6] += samples[6][s] * m[6][6];
-    buf[7]  = samples[0][s] * m[0][7];
-    buf[7] += samples[1][s] * m[1][7];
-    buf[7] += samples[2][s] * m[2][7];
-    buf[7] += samples[3][s] * m[3][7];
-    buf[7] += samples[4][s] * m[4][7];
-    buf[7] += samples[5][s] * m[5][7];
-    buf[7] += samples[6][s] * m[6][7];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-    samples[7][s] = buf[7];
-  }
-}
-
-void Mixer::ip_mix81(samples_t samples, size_t nsamples)
-{
-  sample_t buf[1];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[0] += samples[7][s] * m[7][0];
-    samples[0][s] = buf[0];
-  }
-}
-
-void Mixer::ip_mix82(samples_t samples, size_t nsamples)
-{
-  sample_t buf[2];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[0] += samples[7][s] * m[7][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[1] += samples[7][s] * m[7][1];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-  }
-}
-
-void Mixer::ip_mix83(samples_t samples, size_t nsamples)
-{
-  sample_t buf[3];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[0] += samples[7][s] * m[7][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[1] += samples[7][s] * m[7][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[2] += samples[6][s] * m[6][2];
-    buf[2] += samples[7][s] * m[7][2];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-  }
-}
-
-void Mixer::ip_mix84(samples_t samples, size_t nsamples)
-{
-  sample_t buf[4];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[0] += samples[7][s] * m[7][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[1] += samples[7][s] * m[7][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[2] += samples[6][s] * m[6][2];
-    buf[2] += samples[7][s] * m[7][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[3] += samples[6][s] * m[6][3];
-    buf[3] += samples[7][s] * m[7][3];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-  }
-}
-
-void Mixer::ip_mix85(samples_t samples, size_t nsamples)
-{
-  sample_t buf[5];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[0] += samples[7][s] * m[7][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[1] += samples[7][s] * m[7][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[2] += samples[6][s] * m[6][2];
-    buf[2] += samples[7][s] * m[7][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[3] += samples[6][s] * m[6][3];
-    buf[3] += samples[7][s] * m[7][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[4] += samples[5][s] * m[5][4];
-    buf[4] += samples[6][s] * m[6][4];
-    buf[4] += samples[7][s] * m[7][4];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-  }
-}
-
-void Mixer::ip_mix86(samples_t samples, size_t nsamples)
-{
-  sample_t buf[6];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[0] += samples[7][s] * m[7][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[1] += samples[7][s] * m[7][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[2] += samples[6][s] * m[6][2];
-    buf[2] += samples[7][s] * m[7][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[3] += samples[6][s] * m[6][3];
-    buf[3] += samples[7][s] * m[7][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[4] += samples[5][s] * m[5][4];
-    buf[4] += samples[6][s] * m[6][4];
-    buf[4] += samples[7][s] * m[7][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[5] += samples[4][s] * m[4][5];
-    buf[5] += samples[5][s] * m[5][5];
-    buf[5] += samples[6][s] * m[6][5];
-    buf[5] += samples[7][s] * m[7][5];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-  }
-}
-
-void Mixer::ip_mix87(samples_t samples, size_t nsamples)
-{
-  sample_t buf[7];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[0] += samples[7][s] * m[7][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[1] += samples[7][s] * m[7][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[2] += samples[6][s] * m[6][2];
-    buf[2] += samples[7][s] * m[7][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[3] += samples[6][s] * m[6][3];
-    buf[3] += samples[7][s] * m[7][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[4] += samples[5][s] * m[5][4];
-    buf[4] += samples[6][s] * m[6][4];
-    buf[4] += samples[7][s] * m[7][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[5] += samples[4][s] * m[4][5];
-    buf[5] += samples[5][s] * m[5][5];
-    buf[5] += samples[6][s] * m[6][5];
-    buf[5] += samples[7][s] * m[7][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[6] += samples[2][s] * m[2][6];
-    buf[6] += samples[3][s] * m[3][6];
-    buf[6] += samples[4][s] * m[4][6];
-    buf[6] += samples[5][s] * m[5][6];
-    buf[6] += samples[6][s] * m[6][6];
-    buf[6] += samples[7][s] * m[7][6];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-  }
-}
-
-void Mixer::ip_mix88(samples_t samples, size_t nsamples)
-{
-  sample_t buf[8];
-  for (size_t s = 0; s < nsamples; s++)
-  {
-    buf[0]  = samples[0][s] * m[0][0];
-    buf[0] += samples[1][s] * m[1][0];
-    buf[0] += samples[2][s] * m[2][0];
-    buf[0] += samples[3][s] * m[3][0];
-    buf[0] += samples[4][s] * m[4][0];
-    buf[0] += samples[5][s] * m[5][0];
-    buf[0] += samples[6][s] * m[6][0];
-    buf[0] += samples[7][s] * m[7][0];
-    buf[1]  = samples[0][s] * m[0][1];
-    buf[1] += samples[1][s] * m[1][1];
-    buf[1] += samples[2][s] * m[2][1];
-    buf[1] += samples[3][s] * m[3][1];
-    buf[1] += samples[4][s] * m[4][1];
-    buf[1] += samples[5][s] * m[5][1];
-    buf[1] += samples[6][s] * m[6][1];
-    buf[1] += samples[7][s] * m[7][1];
-    buf[2]  = samples[0][s] * m[0][2];
-    buf[2] += samples[1][s] * m[1][2];
-    buf[2] += samples[2][s] * m[2][2];
-    buf[2] += samples[3][s] * m[3][2];
-    buf[2] += samples[4][s] * m[4][2];
-    buf[2] += samples[5][s] * m[5][2];
-    buf[2] += samples[6][s] * m[6][2];
-    buf[2] += samples[7][s] * m[7][2];
-    buf[3]  = samples[0][s] * m[0][3];
-    buf[3] += samples[1][s] * m[1][3];
-    buf[3] += samples[2][s] * m[2][3];
-    buf[3] += samples[3][s] * m[3][3];
-    buf[3] += samples[4][s] * m[4][3];
-    buf[3] += samples[5][s] * m[5][3];
-    buf[3] += samples[6][s] * m[6][3];
-    buf[3] += samples[7][s] * m[7][3];
-    buf[4]  = samples[0][s] * m[0][4];
-    buf[4] += samples[1][s] * m[1][4];
-    buf[4] += samples[2][s] * m[2][4];
-    buf[4] += samples[3][s] * m[3][4];
-    buf[4] += samples[4][s] * m[4][4];
-    buf[4] += samples[5][s] * m[5][4];
-    buf[4] += samples[6][s] * m[6][4];
-    buf[4] += samples[7][s] * m[7][4];
-    buf[5]  = samples[0][s] * m[0][5];
-    buf[5] += samples[1][s] * m[1][5];
-    buf[5] += samples[2][s] * m[2][5];
-    buf[5] += samples[3][s] * m[3][5];
-    buf[5] += samples[4][s] * m[4][5];
-    buf[5] += samples[5][s] * m[5][5];
-    buf[5] += samples[6][s] * m[6][5];
-    buf[5] += samples[7][s] * m[7][5];
-    buf[6]  = samples[0][s] * m[0][6];
-    buf[6] += samples[1][s] * m[1][6];
-    buf[6] += samples[2][s] * m[2][6];
-    buf[6] += samples[3][s] * m[3][6];
-    buf[6] += samples[4][s] * m[4][6];
-    buf[6] += samples[5][s] * m[5][6];
-    buf[6] += samples[6][s] * m[6][6];
-    buf[6] += samples[7][s] * m[7][6];
-    buf[7]  = samples[0][s] * m[0][7];
-    buf[7] += samples[1][s] * m[1][7];
-    buf[7] += samples[2][s] * m[2][7];
-    buf[7] += samples[3][s] * m[3][7];
-    buf[7] += samples[4][s] * m[4][7];
-    buf[7] += samples[5][s] * m[5][7];
-    buf[7] += samples[6][s] * m[6][7];
-    buf[7] += samples[7][s] * m[7][7];
-    samples[0][s] = buf[0];
-    samples[1][s] = buf[1];
-    samples[2][s] = buf[2];
-    samples[3][s] = buf[3];
-    samples[4][s] = buf[4];
-    samples[5][s] = buf[5];
-    samples[6][s] = buf[6];
-    samples[7][s] = buf[7];
-  }
-}
-
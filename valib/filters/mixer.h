@@ -46,6 +46,17 @@
   inplace/immediate filter, depending on the mixing mode. is_buffered() allows
   to know current mode. Buffer is allocated only buffered mode.
 
+  Only non-zero matrix elements are used for mixing, and pass-through
+  channels are not touched at inplace mode. SSE2 mixing kernel is used when
+  the processor supports it (see cpu_features()).
+
+  Mixer accepts interleaved linear formats (FORMAT_INTERLEAVED_FLOAT and
+  FORMAT_INTERLEAVED_DOUBLE) too. Output has the same layout and precision
+  as the input: format of set_output() is replaced with the input format.
+  Interleaved data is mixed frame by frame, all output channels of the frame
+  at once, so each input sample is loaded only once. Float frames are mixed
+  at float precision regardless of sample_t.
+
   Mixer also allows to gain each input/output channel and all channels at once.
   Gains are applied to both automatic and manual matrices. Thus, actual matrix
   is following:
@@ -201,6 +212,7 @@ public:
   /////////////////////////////////////////////////////////
   // SamplesFilter overrides
 
+  virtual bool can_open(Speakers spk) const;
   virtual bool init();
   virtual bool process(Chunk &in, Chunk &out);
 
@@ -276,139 +288,22 @@ protected:
   matrix_t matrix;                 //!< mixing matrix
   matrix_t m;                      //!< internal matrix representation
 
+  // Non-zero elements of the internal matrix for each output channel
+  int      nterms[NCHANNELS];                //!< number of non-zero elements
+  int      term_ch[NCHANNELS][NCHANNELS];    //!< input channel for the element
+  sample_t term_gain[NCHANNELS][NCHANNELS];  //!< element value
+  bool     pass_through[NCHANNELS];          //!< output channel equals to the input one
+
+  // Internal matrix for interleaved mixing (zero-padded), [in_ch][out_ch]
+  float    frame_gain_float[NCHANNELS][NCHANNELS];  //!< element value for float frames
+  double   frame_gain_double[NCHANNELS][NCHANNELS]; //!< element value for double frames
+
   void prepare_matrix();           //!< find internal matrix represenation
 
-public:
   // mixing functions
-  void io_mix11(samples_t input, samples_t output, size_t nsamples);
-  void io_mix12(samples_t input, samples_t output, size_t nsamples);
-  void io_mix13(samples_t input, samples_t output, size_t nsamples);
-  void io_mix14(samples_t input, samples_t output, size_t nsamples);
-  void io_mix15(samples_t input, samples_t output, size_t nsamples);
-  void io_mix16(samples_t input, samples_t output, size_t nsamples);
-  void io_mix17(samples_t input, samples_t output, size_t nsamples);
-  void io_mix18(samples_t input, samples_t output, size_t nsamples);
-  void io_mix21(samples_t input, samples_t output, size_t nsamples);
-  void io_mix22(samples_t input, samples_t output, size_t nsamples);
-  void io_mix23(samples_t input, samples_t output, size_t nsamples);
-  void io_mix24(samples_t input, samples_t output, size_t nsamples);
-  void io_mix25(samples_t input, samples_t output, size_t nsamples);
-  void io_mix26(samples_t input, samples_t output, size_t nsamples);
-  void io_mix27(samples_t input, samples_t output, size_t nsamples);
-  void io_mix28(samples_t input, samples_t output, size_t nsamples);
-  void io_mix31(samples_t input, samples_t output, size_t nsamples);
-  void io_mix32(samples_t input, samples_t output, size_t nsamples);
-  void io_mix33(samples_t input, samples_t output, size_t nsamples);
-  void io_mix34(samples_t input, samples_t output, size_t nsamples);
-  void io_mix35(samples_t input, samples_t output, size_t nsamples);
-  void io_mix36(samples_t input, samples_t output, size_t nsamples);
-  void io_mix37(samples_t input, samples_t output, size_t nsamples);
-  void io_mix38(samples_t input, samples_t output, size_t nsamples);
-  void io_mix41(samples_t input, samples_t output, size_t nsamples);
-  void io_mix42(samples_t input, samples_t output, size_t nsamples);
-  void io_mix43(samples_t input, samples_t output, size_t nsamples);
-  void io_mix44(samples_t input, samples_t output, size_t nsamples);
-  void io_mix45(samples_t input, samples_t output, size_t nsamples);
-  void io_mix46(samples_t input, samples_t output, size_t nsamples);
-  void io_mix47(samples_t input, samples_t output, size_t nsamples);
-  void io_mix48(samples_t input, samples_t output, size_t nsamples);
-  void io_mix51(samples_t input, samples_t output, size_t nsamples);
-  void io_mix52(samples_t input, samples_t output, size_t nsamples);
-  void io_mix53(samples_t input, samples_t output, size_t nsamples);
-  void io_mix54(samples_t input, samples_t output, size_t nsamples);
-  void io_mix55(samples_t input, samples_t output, size_t nsamples);
-  void io_mix56(samples_t input, samples_t output, size_t nsamples);
-  void io_mix57(samples_t input, samples_t output, size_t nsamples);
-  void io_mix58(samples_t input, samples_t output, size_t nsamples);
-  void io_mix61(samples_t input, samples_t output, size_t nsamples);
-  void io_mix62(samples_t input, samples_t output, size_t nsamples);
-  void io_mix63(samples_t input, samples_t output, size_t nsamples);
-  void io_mix64(samples_t input, samples_t output, size_t nsamples);
-  void io_mix65(samples_t input, samples_t output, size_t nsamples);
-  void io_mix66(samples_t input, samples_t output, size_t nsamples);
-  void io_mix67(samples_t input, samples_t output, size_t nsamples);
-  void io_mix68(samples_t input, samples_t output, size_t nsamples);
-  void io_mix71(samples_t input, samples_t output, size_t nsamples);
-  void io_mix72(samples_t input, samples_t output, size_t nsamples);
-  void io_mix73(samples_t input, samples_t output, size_t nsamples);
-  void io_mix74(samples_t input, samples_t output, size_t nsamples);
-  void io_mix75(samples_t input, samples_t output, size_t nsamples);
-  void io_mix76(samples_t input, samples_t output, size_t nsamples);
-  void io_mix77(samples_t input, samples_t output, size_t nsamples);
-  void io_mix78(samples_t input, samples_t output, size_t nsamples);
-  void io_mix81(samples_t input, samples_t output, size_t nsamples);
-  void io_mix82(samples_t input, samples_t output, size_t nsamples);
-  void io_mix83(samples_t input, samples_t output, size_t nsamples);
-  void io_mix84(samples_t input, samples_t output, size_t nsamples);
-  void io_mix85(samples_t input, samples_t output, size_t nsamples);
-  void io_mix86(samples_t input, samples_t output, size_t nsamples);
-  void io_mix87(samples_t input, samples_t output, size_t nsamples);
-  void io_mix88(samples_t input, samples_t output, size_t nsamples);
-
-  void ip_mix11(samples_t samples, size_t nsamples);
-  void ip_mix12(samples_t samples, size_t nsamples);
-  void ip_mix13(samples_t samples, size_t nsamples);
-  void ip_mix14(samples_t samples, size_t nsamples);
-  void ip_mix15(samples_t samples, size_t nsamples);
-  void ip_mix16(samples_t samples, size_t nsamples);
-  void ip_mix17(samples_t samples, size_t nsamples);
-  void ip_mix18(samples_t samples, size_t nsamples);
-  void ip_mix21(samples_t samples, size_t nsamples);
-  void ip_mix22(samples_t samples, size_t nsamples);
-  void ip_mix23(samples_t samples, size_t nsamples);
-  void ip_mix24(samples_t samples, size_t nsamples);
-  void ip_mix25(samples_t samples, size_t nsamples);
-  void ip_mix26(samples_t samples, size_t nsamples);
-  void ip_mix27(samples_t samples, size_t nsamples);
-  void ip_mix28(samples_t samples, size_t nsamples);
-  void ip_mix31(samples_t samples, size_t nsamples);
-  void ip_mix32(samples_t samples, size_t nsamples);
-  void ip_mix33(samples_t samples, size_t nsamples);
-  void ip_mix34(samples_t samples, size_t nsamples);
-  void ip_mix35(samples_t samples, size_t nsamples);
-  void ip_mix36(samples_t samples, size_t nsamples);
-  void ip_mix37(samples_t samples, size_t nsamples);
-  void ip_mix38(samples_t samples, size_t nsamples);
-  void ip_mix41(samples_t samples, size_t nsamples);
-  void ip_mix42(samples_t samples, size_t nsamples);
-  void ip_mix43(samples_t samples, size_t nsamples);
-  void ip_mix44(samples_t samples, size_t nsamples);
-  void ip_mix45(samples_t samples, size_t nsamples);
-  void ip_mix46(samples_t samples, size_t nsamples);
-  void ip_mix47(samples_t samples, size_t nsamples);
-  void ip_mix48(samples_t samples, size_t nsamples);
-  void ip_mix51(samples_t samples, size_t nsamples);
-  void ip_mix52(samples_t samples, size_t nsamples);
-  void ip_mix53(samples_t samples, size_t nsamples);
-  void ip_mix54(samples_t samples, size_t nsamples);
-  void ip_mix55(samples_t samples, size_t nsamples);
-  void ip_mix56(samples_t samples, size_t nsamples);
-  void ip_mix57(samples_t samples, size_t nsamples);
-  void ip_mix58(samples_t samples, size_t nsamples);
-  void ip_mix61(samples_t samples, size_t nsamples);
-  void ip_mix62(samples_t samples, size_t nsamples);
-  void ip_mix63(samples_t samples, size_t nsamples);
-  void ip_mix64(samples_t samples, size_t nsamples);
-  void ip_mix65(samples_t samples, size_t nsamples);
-  void ip_mix66(samples_t samples, size_t nsamples);
-  void ip_mix67(samples_t samples, size_t nsamples);
-  void ip_mix68(samples_t samples, size_t nsamples);
-  void ip_mix71(samples_t samples, size_t nsamples);
-  void ip_mix72(samples_t samples, size_t nsamples);
-  void ip_mix73(samples_t samples, size_t nsamples);
-  void ip_mix74(samples_t samples, size_t nsamples);
-  void ip_mix75(samples_t samples, size_t nsamples);
-  void ip_mix76(samples_t samples, size_t nsamples);
-  void ip_mix77(samples_t samples, size_t nsamples);
-  void ip_mix78(samples_t samples, size_t nsamples);
-  void ip_mix81(samples_t samples, size_t nsamples);
-  void ip_mix82(samples_t samples, size_t nsamples);
-  void ip_mix83(samples_t samples, size_t nsamples);
-  void ip_mix84(samples_t samples, size_t nsamples);
-  void ip_mix85(samples_t samples, size_t nsamples);
-  void ip_mix86(samples_t samples, size_t nsamples);
-  void ip_mix87(samples_t samples, size_t nsamples);
-  void ip_mix88(samples_t samples, size_t nsamples);
+  void io_mix(samples_t input, samples_t output, size_t nsamples);
+  void ip_mix(samples_t samples, size_t nsamples);
+  void frame_mix(const uint8_t *input, uint8_t *output, size_t nframes);
 };
 
 ///////////////////////////////////////////////////////////////////////////////
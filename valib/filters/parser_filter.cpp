@@ -8,6 +8,12 @@ ParserFilter::ParserFilter(FrameParser *frame_parser_, Filter *filter_)
   add(frame_parser_, filter_);
 }
 
+ParserFilter::~ParserFilter()
+{
+  // Decoders are not owned, so do not leave them with the arena's buffers
+  close();
+}
+
 void
 ParserFilter::add(FrameParser *frame_parser_, Filter *filter_)
 {
@@ -39,6 +39,7 @@ class ParserFilter : public FilterGraph
 public:
   ParserFilter();
   ParserFilter(FrameParser *frame_parser, Filter *filter);
+  ~ParserFilter();
 
   void add(FrameParser *frame_parser, Filter *filter);
   void add(Filter *filter);
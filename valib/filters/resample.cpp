@@ -9,16 +9,29 @@
 #include <math.h>
 #include "resample.h"
 #include "../dsp/kaiser.h"
+#include "../auto_buf.h"
+#include "../thread.h"
+#include "../cpu.h"
+
+#ifdef VALIB_SSE2
+#include <emmintrin.h>
+#endif
 
 static const double k_conv = 2;
 static const double k_fft = 20.1977305724455;
 
+// Integer ratio path: cost of a multiplication in units of t_upsample()
+// and t_downsample(), and input samples processed at once
+static const double k_halfband = 3.5;
+static const int hb_block = 4096;
+
 ///////////////////////////////////////////////////////////////////////////////
 // Math
 
 inline double sinc(double x) { return x == 0 ? 1 : sin(x)/x; }
 inline double lpf(int i, double freq) { return 2 * freq * sinc(i * 2 * M_PI * freq); }
 inline int gcd(int x, int y);
+inline bool is_pow2(int x) { return x > 0 && (x & (x - 1)) == 0; }
 inline unsigned int flp2(unsigned int x);
 inline unsigned int clp2(unsigned int x);
 
@@ -26,6 +39,7 @@ double t_upsample(int l1, int m1, int l2, int m2, double a, double q);
 double t_downsample(int l1, int m1, int l2, int m2, double a, double q);
 double optimize_upsample(int l, int m, double a, double q, int &l1, int &m1, int &l2, int &m2);
 double optimize_downsample(int l, int m, double a, double q, int &l1, int &m1, int &l2, int &m2);
+double t_halfband(int fs, int fd, int stages, double a, double q);
 
 ///////////////////////////////////////////////////////////////////////////////
 // Resample class definition
@@ -37,7 +51,8 @@ Resample::Resample():
   n1(0), n1x(0), n1y(0),
   c1(0), c1x(0), c1y(0),
   f1(0), order(0),
-  n2(0), n2b(0), c2(0)
+  n2(0), n2b(0), c2(0), f2(0), plan(0),
+  nhb(0), hb_in(0), hb_out(0)
 {
   sample_rate = 0;
   out_samples.zero();
@@ -52,7 +67,8 @@ Resample::Resample(int _sample_rate, double _a, double _q):
   n1(0), n1x(0), n1y(0),
   c1(0), c1x(0), c1y(0),
   f1(0), order(0),
-  n2(0), n2b(0), c2(0)
+  n2(0), n2b(0), c2(0), f2(0), plan(0),
+  nhb(0), hb_in(0), hb_out(0)
 {
   sample_rate = 0;
   out_samples.zero();
@@ -107,26 +123,48 @@ Resample::get(int *_sample_rate, double *_a, double *_q)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// Init
-///////////////////////////////////////////////////////////////////////////////
-
-bool
-Resample::init()
+// Filter plans
+//
+// Filters depend only on the conversion parameters (fs, fd, a, q), and
+// building them is the most expensive part of the initialization. So built
+// plans are cached and shared between all Resample instances. Plans are never
+// modified after construction and are kept until exit.
+
+struct ResamplePlan
 {
-  uninit();
+  // key
+  int fs, fd;
+  double a, q;
 
-  out_spk = spk;
-  if (sample_rate)
-    out_spk.sample_rate = sample_rate;
+  int g, l, m, l1, l2, m1, m2;
 
-  if (passthrough())
-    return true;
+  int n1, n1x, n1y;
+  int c1, c1x, c1y;
+  AutoBuf<sample_t> f1;   // reordered filter [n1y][n1x]
+  AutoBuf<int> order;     // input positions [l1]
+
+  int n2, n2b;
+  int c2;
+  AutoBuf<sample_t> f2;   // filter spectrum [n2b]
+
+  int refs;               // number of filters using the plan
+  ResamplePlan *next;
+};
 
+static void build_plan(ResamplePlan *plan)
+{
   int i;
-  fs = spk.sample_rate;     // source sample rate
-  fd = sample_rate;         // destinationsample rate
-  nch = spk.nch();          // number fo channels
-  rate = double(fd) / double(fs);
+  const int fs = plan->fs;
+  const int fd = plan->fd;
+  const double a = plan->a;
+  const double q = plan->q;
+  const double rate = double(fd) / double(fs);
+
+  int &g = plan->g, &l = plan->l, &m = plan->m;
+  int &l1 = plan->l1, &l2 = plan->l2, &m1 = plan->m1, &m2 = plan->m2;
+  int &n1 = plan->n1, &n1x = plan->n1x, &n1y = plan->n1y;
+  int &c1 = plan->c1, &c1x = plan->c1x, &c1y = plan->c1y;
+  int &n2 = plan->n2, &n2b = plan->n2b, &c2 = plan->c2;
 
   g = gcd(fs, fd);
   l = fd / g; // interpolation factor
@@ -187,36 +225,31 @@ Resample::init()
                      // must fit the filter into the given space
   c1 = (n1 - 1) / 2; // center of the filter
 
-  // allocate the filter
-  // f1[n1y][n1x]
-  f1 = new sample_t *[n1y];
-  f1[0] = new sample_t[n1x * n1y];
-  for (i = 0; i < n1x * n1y; i++) f1[0][i] = 0;
-  for (i = 1; i < n1y; i++) f1[i] = f1[0] + i * n1x;
-
-  f1_raw.allocate(n1y * n1x);
+  // build the filter
+  AutoBuf<sample_t> f1_raw(n1y * n1x);
   f1_raw.zero();
 
-  // build the filter
   alpha = kaiser_alpha(a1);
   for (i = 0; i < n1; i++)
     f1_raw[i] = (sample_t) (kaiser_window(i - c1, n1, alpha) * lpf(i - c1, lpf1) * l1);
 
   // reorder the filter
+  // f1[n1y][n1x]
   // find coordinates of the filter's center
+  plan->f1.allocate(n1y * n1x);
   for (int y = 0; y < n1y; y++)
     for (int x = 0; x < n1x; x++)
     {
       int p = l1-1 - (y*m1)%l1 + x*l1;
-      f1[y][x] = f1_raw[p];
+      plan->f1[y * n1x + x] = f1_raw[p];
       if (p == c1)
         c1x = x, c1y = y;
     }
 
   // data ordering
-  order = new int[l1];
+  plan->order.allocate(l1);
   for (i = 0; i < l1; i++) 
-    order[i] = i * m1 / l1;
+    plan->order[i] = i * m1 / l1;
 
   ///////////////////////////////////////////////////////////////////////////
   // Build fft stage filter
@@ -228,20 +261,169 @@ Resample::init()
   n2b = n2*2;
   c2 = n2 / 2 - 1;
 
-  // allocate the filter
-  // f2[n2b]
+  // make the filter
+  // filter length is n2-1
+  AutoBuf<sample_t> &f2 = plan->f2;
   f2.allocate(n2b);
   f2.zero();
 
-  // make the filter
-  // filter length is n2-1
   alpha = kaiser_alpha(a2);
   for (i = 0; i < n2-1; i++)
     f2[i] = (sample_t)(kaiser_window(i - c2, n2-1, alpha) * lpf(i - c2, lpf2) * l2 / n2);
 
-  // init fft and convert the filter to frequency domain
-  fft.set_length(n2b);
+  // convert the filter to frequency domain
+  FFT fft(n2b);
   fft.rdft(f2);
+}
+
+// Plans are reference-counted: a plan is freed when the last filter using
+// it is closed. Filters may be destroyed after the cache (static filters of
+// other translation units), so plan_cache_alive flag (a POD, valid at any
+// time) tells to leave the plan to the cache's destructor.
+
+static bool plan_cache_alive = false;
+
+class ResamplePlanCache
+{
+protected:
+  CritSec lock;
+  ResamplePlan *plans;
+  size_t count;
+
+public:
+  ResamplePlanCache(): plans(0), count(0)
+  { plan_cache_alive = true; }
+
+  ~ResamplePlanCache()
+  {
+    plan_cache_alive = false;
+    while (plans)
+    {
+      ResamplePlan *next = plans->next;
+      delete plans;
+      plans = next;
+    }
+  }
+
+  const ResamplePlan *get(int fs, int fd, double a, double q)
+  {
+    AutoLock autolock(&lock);
+
+    for (ResamplePlan *plan = plans; plan; plan = plan->next)
+      if (plan->fs == fs && plan->fd == fd && plan->a == a && plan->q == q)
+      {
+        plan->refs++;
+        return plan;
+      }
+
+    ResamplePlan *plan = new ResamplePlan;
+    try
+    {
+      plan->fs = fs;
+      plan->fd = fd;
+      plan->a = a;
+      plan->q = q;
+      plan->refs = 1;
+      build_plan(plan);
+    }
+    catch (...)
+    {
+      delete plan;
+      throw;
+    }
+
+    plan->next = plans;
+    plans = plan;
+    count++;
+    return plan;
+  }
+
+  void release(const ResamplePlan *plan)
+  {
+    AutoLock autolock(&lock);
+    if (--((ResamplePlan *)plan)->refs > 0)
+      return;
+
+    for (ResamplePlan **p = &plans; *p; p = &(*p)->next)
+      if (*p == plan)
+      {
+        *p = plan->next;
+        delete plan;
+        count--;
+        return;
+      }
+  }
+
+  size_t size()
+  {
+    AutoLock autolock(&lock);
+    return count;
+  }
+};
+
+static ResamplePlanCache plan_cache;
+
+size_t
+Resample::cache_size()
+{
+  return plan_cache.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Init
+///////////////////////////////////////////////////////////////////////////////
+
+bool
+Resample::init()
+{
+  uninit();
+
+  out_spk = spk;
+  if (sample_rate)
+    out_spk.sample_rate = sample_rate;
+
+  if (passthrough())
+    return true;
+
+  fs = spk.sample_rate;     // source sample rate
+  fd = sample_rate;         // destinationsample rate
+  nch = spk.nch();          // number fo channels
+  rate = double(fd) / double(fs);
+
+  // Integer ratio path is used when it is cheaper. General path has
+  // problems with decimation by 2 (stage 1 filter is too long), but wins
+  // for high quality interpolation.
+  g = gcd(fs, fd);
+  l = fd / g;
+  m = fs / g;
+  if ((l == 1 && is_pow2(m)) || (m == 1 && is_pow2(l)))
+  {
+    int stages = 0;
+    while ((1 << stages) < MAX(l, m))
+      stages++;
+
+    double t;
+    if (fs < fd)
+      t = optimize_upsample(l, m, a, q, l1, m1, l2, m2);
+    else
+      t = optimize_downsample(l, m, a, q, l1, m1, l2, m2);
+
+    if (stages <= max_hb_stages && t_halfband(fs, fd, stages, a, q) < t)
+      return init_halfband(stages);
+  }
+
+  plan = plan_cache.get(fs, fd, a, q);
+
+  g = plan->g; l = plan->l; m = plan->m;
+  l1 = plan->l1; l2 = plan->l2; m1 = plan->m1; m2 = plan->m2;
+  n1 = plan->n1; n1x = plan->n1x; n1y = plan->n1y;
+  c1 = plan->c1; c1x = plan->c1x; c1y = plan->c1y;
+  f1 = plan->f1; order = plan->order;
+  n2 = plan->n2; n2b = plan->n2b; c2 = plan->c2;
+  f2 = plan->f2;
+
+  // fft tables are cached by FFT itself
+  fft.set_length(n2b, nch);
 
   ///////////////////////////////////////////////////////
   // Allocate buffers
@@ -270,9 +452,9 @@ Resample::uninit()
 {
   out_spk = spk_unknown;
 
-  if (f1) safe_delete(f1[0]);
-  safe_delete(f1);
-  safe_delete(order);
+  if (plan && plan_cache_alive)
+    plan_cache.release(plan);
+  plan = 0;
 
   fs = 0; fd = 0; nch = 0; rate = 1.0;
   g = 0; l = 0; m = 0; l1 = 0; l2 = 0; m1 = 0; m2 = 0;
@@ -280,6 +462,59 @@ Resample::uninit()
   c1 = 0; c1x = 0; c1y = 0;
   f1 = 0; order = 0;
   n2 = 0; n2b = 0; c2 = 0;
+  f2 = 0;
+  nhb = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Integer ratio path
+//
+// Conversion by a power of 2 is done with a cascade of half-band filters,
+// each one decimates or interpolates by 2. All stages preserve the final
+// passband (q of the lower sample rate's nyquist), so earlier decimation
+// stages (later interpolation stages) have wide transition bands and short
+// filters. Filters are zero-phase, so the output is not shifted.
+//
+// Stages add their noise, so the attenuation of each stage is increased
+// like for the two stages of the general path.
+
+// Passband edge of the stage normalized to the higher rate of the stage
+static double halfband_fp(int fs, int fd, double q, int stage)
+{
+  if (fs > fd)
+    return q * fd / 2 / (double(fs) / (1 << stage));
+  else
+    return q * fs / 2 / (double(fs) * (2 << stage));
+}
+
+static double halfband_a(double a, int stages)
+{ return a + log10(double(stages))*20 + 6; }
+
+bool
+Resample::init_halfband(int stages)
+{
+  const double a_hb = halfband_a(a, stages);
+  for (int s = 0; s < stages; s++)
+  {
+    double fp = halfband_fp(fs, fd, q, s);
+    if (fs > fd)
+      hb[s].init(HalfBand::decimate, nch, fp, a_hb, hb_block);
+    else
+      hb[s].init(HalfBand::interpolate, nch, fp, a_hb, hb_block << s);
+  }
+  nhb = stages;
+
+  // Stage 1 buffer holds zeros to flush the stages
+  size_t buf_size = fs > fd? hb_block / 2 + 2: size_t(hb_block) * l;
+  buf1.allocate(nch, hb_block);
+  buf1.zero();
+  hb_buf[0].allocate(nch, buf_size);
+  hb_buf[1].allocate(nch, buf_size);
+
+  out_samples = hb_buf[0].samples();
+  out_size = 0;
+  reset();
+  return true;
 }
 
 
@@ -288,6 +523,76 @@ Resample::uninit()
 // Processing functions
 ///////////////////////////////////////////////////////////////////////////////
 
+///////////////////////////////////////////////////////////////////////////////
+// Stage 1 polyphase kernel: dot product of the input and a filter phase.
+// Phases are short (tens of taps), so the SIMD version keeps 2 accumulators
+// to hide the add latency and finishes the odd taps with scalar code.
+
+static inline sample_t dot(const sample_t *x, const sample_t *h, int n)
+{
+  double sum = 0;
+  for (int j = 0; j < n; j++)
+    sum += x[j] * h[j];
+  return sample_t(sum);
+}
+
+#ifdef VALIB_SSE2
+#ifdef FLOAT_SAMPLE
+
+static inline sample_t dot_sse2(const sample_t *x, const sample_t *h, int n)
+{
+  __m128 acc0 = _mm_setzero_ps();
+  __m128 acc1 = _mm_setzero_ps();
+  int j = 0;
+  for (; j + 8 <= n; j += 8)
+  {
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(x + j),     _mm_loadu_ps(h + j)));
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(x + j + 4), _mm_loadu_ps(h + j + 4)));
+  }
+  if (j + 4 <= n)
+  {
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(x + j), _mm_loadu_ps(h + j)));
+    j += 4;
+  }
+  acc0 = _mm_add_ps(acc0, acc1);
+  acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+  acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, 1));
+
+  double sum = _mm_cvtss_f32(acc0);
+  for (; j < n; j++)
+    sum += x[j] * h[j];
+  return sample_t(sum);
+}
+
+#else
+
+static inline sample_t dot_sse2(const sample_t *x, const sample_t *h, int n)
+{
+  __m128d acc0 = _mm_setzero_pd();
+  __m128d acc1 = _mm_setzero_pd();
+  int j = 0;
+  for (; j + 4 <= n; j += 4)
+  {
+    acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(x + j),     _mm_loadu_pd(h + j)));
+    acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(x + j + 2), _mm_loadu_pd(h + j + 2)));
+  }
+  if (j + 2 <= n)
+  {
+    acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(x + j), _mm_loadu_pd(h + j)));
+    j += 2;
+  }
+  acc0 = _mm_add_pd(acc0, acc1);
+  acc0 = _mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0));
+
+  double sum = _mm_cvtsd_f64(acc0);
+  for (; j < n; j++)
+    sum += x[j] * h[j];
+  return sample_t(sum);
+}
+
+#endif
+#endif
+
 inline void
 Resample::do_resample()
 {
@@ -355,6 +660,10 @@ Resample::do_stage1(sample_t *in[], sample_t *out[], int n_in, int n_out)
   stage1.start();
 #endif
 
+#ifdef VALIB_SSE2
+  const bool simd = (cpu_features() & cpu_sse2) != 0;
+#endif
+
   for (int ch = 0; ch < nch; ch++)
   {
     int i = pos_l;
@@ -376,10 +685,13 @@ Resample::do_stage1(sample_t *in[], sample_t *out[], int n_in, int n_out)
 
     while (n--)
     {
-      double sum = 0;
-      for (int j = 0; j < n1x; j++)
-        sum += iptr[order[i] + j] * f1[i][j];
-      optr[i++] = sum;
+#ifdef VALIB_SSE2
+      if (simd)
+        optr[i] = dot_sse2(iptr + order[i], f1 + i * n1x, n1x);
+      else
+#endif
+        optr[i] = dot(iptr + order[i], f1 + i * n1x, n1x);
+      i++;
 
       if (i >= l1)
       {
@@ -404,11 +716,11 @@ Resample::do_stage2()
   stage2.start();
 #endif
 
+  zero_samples(buf2, n2, nch, n2);
+  fft.rdft(buf2, nch);
+
   for (int ch = 0; ch < nch; ch++)
   {
-    zero_samples(buf2[ch] + n2, n2);
-    fft.rdft(buf2[ch]);
-
     buf2[ch][0] = f2[0] * buf2[ch][0];
     buf2[ch][1] = f2[1] * buf2[ch][1]; 
 
@@ -420,9 +732,10 @@ Resample::do_stage2()
       buf2[ch][i*2  ] = re;
       buf2[ch][i*2+1] = im;
     }
-    fft.inv_rdft(buf2[ch]);
   }
 
+  fft.inv_rdft(buf2, nch);
+
 #if RESAMPLE_PERF
   stage2.stop();
 #endif
@@ -437,6 +750,15 @@ Resample::reset()
   if (passthrough())
     return;
 
+  if (nhb)
+  {
+    for (int s = 0; s < nhb; s++)
+      hb[s].reset();
+    hb_in = 0;
+    hb_out = 0;
+    return;
+  }
+
   if (fs && fd)
   {
     pos_l = c1y;
@@ -471,6 +793,9 @@ Resample::process(Chunk &in, Chunk &out)
     return !out.is_dummy();
   }
 
+  if (nhb)
+    return process_halfband(in, out);
+
   ///////////////////////////////////////////////////////
   // Sync
 
@@ -524,6 +849,9 @@ Resample::flush(Chunk &out)
   if (!need_flushing())
     return false;
 
+  if (nhb)
+    return flush_halfband(out);
+
   int actual_out_size = (stage1_out(pos1 - c1x) + c2 - shift) / m2 - pre_samples;
   if (!actual_out_size)
     return true;
@@ -558,6 +886,76 @@ Resample::flush(Chunk &out)
   return true;
 }
 
+size_t
+Resample::do_halfband(samples_t in, size_t n)
+{
+  for (int s = 0; s < nhb; s++)
+  {
+    samples_t stage_out = hb_buf[s & 1].samples();
+    n = hb[s].process(in, n, stage_out);
+    in = stage_out;
+  }
+  out_samples = in;
+  out_size = int(n);
+  return n;
+}
+
+bool
+Resample::process_halfband(Chunk &in, Chunk &out)
+{
+  // Output sample k matches input sample k * m / l
+  if (in.sync)
+  {
+    sync = true;
+    time = in.time + (double(hb_out) * m / l - double(hb_in)) / fs;
+    in.sync = false;
+    in.time = 0;
+  }
+
+  while (in.size)
+  {
+    size_t n = MIN(in.size, size_t(hb_block));
+    size_t n_out = do_halfband(in.samples, n);
+    in.drop_samples(n);
+    hb_in += n;
+    hb_out += n_out;
+
+    if (n_out)
+    {
+      out.set_linear(out_samples, n_out);
+      out.set_sync(sync, time);
+      sync = false;
+      time = 0;
+      return true;
+    }
+  }
+
+  out.clear();
+  return false;
+}
+
+bool
+Resample::flush_halfband(Chunk &out)
+{
+  // Push zeros until the output for all input samples is done
+  const uint64_t total = halfband_out_size();
+  size_t n_out = 0;
+  while (!n_out)
+    n_out = do_halfband(buf1.samples(), hb_block);
+
+  n_out = size_t(MIN(uint64_t(n_out), total - hb_out));
+  hb_out += n_out;
+
+  out.set_linear(out_samples, n_out);
+  out.set_sync(sync, time);
+  sync = false;
+  time = 0;
+
+  if (hb_out >= total)
+    reset();
+  return true;
+}
+
 string
 Resample::info() const
 {
@@ -578,6 +976,15 @@ Resample::info() const
     return s.str();
   }
 
+  if (nhb)
+  {
+    s << "Conversion rate: " << l << "/" << m << nl
+      << "Half-band stages: " << nhb << nl;
+    for (int i = 0; i < nhb; i++)
+      s << "Stage" << i + 1 << " filter: length=" << hb[i].length() << nl;
+    return s.str();
+  }
+
   s << "Conversion rate: " << l << "/" << m << nl
     << "Stage1 rate: " << l1 << "/" << m1 << nl
     << "Stage2 rate: " << l1 << "/" << m2 << nl
@@ -665,6 +1072,22 @@ double optimize_downsample(int l, int m, double a, double q, int &l1, int &m1, i
   return t_opt;
 }
 
+double t_halfband(int fs, int fd, int stages, double a, double q)
+{
+  // Multiplications per input sample
+  double a_hb = halfband_a(a, stages);
+  double t = 0;
+  for (int s = 0; s < stages; s++)
+  {
+    int nk = HalfBand::coefs(halfband_fp(fs, fd, q, s), a_hb);
+    if (fs > fd)
+      t += double(nk) / (2 << s);
+    else
+      t += double(nk) * (1 << s);
+  }
+  return k_halfband * t;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Math
 ///////////////////////////////////////////////////////////////////////////////
@@ -2,12 +2,15 @@
 #define VALIB_RESAMPLE_H
 
 #include "../dsp/fft.h"
+#include "../dsp/halfband.h"
 #include "../buffer.h"
 #include "../filter.h"
 #if RESAMPLE_PERF
-#include "../win32\cpu.h"
+#include "../cpu.h"
 #endif
 
+struct ResamplePlan;
+
 class Resample : public SamplesFilter
 {
 protected:
@@ -29,17 +32,25 @@ protected:
   // convolution stage filter
   int n1, n1x, n1y; // filter length, x and y lengths
   int c1, c1x, c1y; // center of the filter, x and y coordinates
-  sample_t **f1;    // reordered filter [n1y][n1x]
-  Samples f1_raw;   // raw filter [n1y * n1x]
-  int *order;       // input positions [l]
+  const sample_t *f1;  // reordered filter [n1y][n1x] (shared plan)
+  const int *order;    // input positions [l1] (shared plan)
 
   // fft stage filter
   int n2, n2b;      // filter size and fft size
   int c2;           // center of the filter
-  Samples f2;       // filter [n2b]
+  const sample_t *f2; // filter spectrum [n2b] (shared plan)
+  const ResamplePlan *plan; // plan in use (released at uninit())
 
   FFT fft;          // fft transformer
 
+  // integer ratio path: cascade of half-band filters
+  enum { max_hb_stages = 8 };
+  int nhb;                     // number of stages (0 = general path)
+  HalfBand hb[max_hb_stages];  // decimators or interpolators by 2
+  SampleBuf hb_buf[2];         // stage output buffers
+  uint64_t hb_in;              // input samples after reset
+  uint64_t hb_out;             // output samples after reset
+
   // processing
   int pos_l, pos_m;            // stage1 convolution positions [0..l1), [0..m1)
   int pos1;                    // stage1 buffer position
@@ -60,8 +71,19 @@ protected:
   inline void do_stage1(sample_t *in[], sample_t *out[], int n_in, int n_out);
   inline void do_stage2();
 
+  bool init_halfband(int stages);
+  size_t do_halfband(samples_t in, size_t n);
+  bool process_halfband(Chunk &in, Chunk &out);
+  bool flush_halfband(Chunk &out);
+  uint64_t halfband_out_size() const
+  { return (hb_in * l + m - 1) / m; }
+
   bool need_flushing() const
-  { return !passthrough() && post_samples > 0 && ((stage1_out(pos1 - c1x) + c2 - shift) / m2 - pre_samples) > 0; }
+  {
+    if (nhb)
+      return !passthrough() && hb_in > 0 && hb_out < halfband_out_size();
+    return !passthrough() && post_samples > 0 && ((stage1_out(pos1 - c1x) + c2 - shift) / m2 - pre_samples) > 0;
+  }
 
 protected:
   int sample_rate;       // destination sample rate
@@ -116,6 +138,13 @@ public:
   { return out_spk; }
 
   virtual string info() const;
+
+  /////////////////////////////////////////////////////////
+  // Number of filter plans in use. Plans are shared between
+  // instances with the same sample rates, attenuation and
+  // quality, and freed when the last instance is closed.
+
+  static size_t cache_size();
 };
 
 #endif
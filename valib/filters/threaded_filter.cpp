@@ -0,0 +1,579 @@
+#include "../buffer.h"
+#include "../cpu.h"
+#include "../thread.h"
+#include "threaded_filter.h"
+
+// Time the worker sleeps before it checks the termination flag again
+static const int worker_timeout_ms = 100;
+
+// Time to wait for the worker to stop
+static const int terminate_timeout_ms = 5000;
+
+///////////////////////////////////////////////////////////////////////////////
+// Queue slot
+// Holds a copy of the chunk data or a control command.
+
+enum slot_type_t
+{
+  slot_data,  // chunk of data
+  slot_flush, // flush request (input) or end of flushing (output)
+  slot_reset, // reset request (input) or reset done (output)
+  slot_error  // worker has failed (output)
+};
+
+struct Slot
+{
+  slot_type_t type;
+  Speakers    spk;        // format of the chunk
+  bool        new_stream; // output chunk starts a new stream
+  Chunk       chunk;
+
+  Rawdata     rawdata;
+  SampleBuf   samples;
+  boost::exception_ptr error;
+
+  Slot(): type(slot_data), new_stream(false)
+  {}
+
+  void set_command(slot_type_t type_, Speakers spk_)
+  {
+    type = type_;
+    spk = spk_;
+    new_stream = false;
+    chunk.clear();
+  }
+
+  void set_data(Speakers spk_, const Chunk &data, bool new_stream_)
+  {
+    type = slot_data;
+    spk = spk_;
+    new_stream = new_stream_;
+
+    if (data.is_empty())
+    {
+      chunk.clear();
+      chunk.set_sync(data.sync, data.time);
+    }
+    else if (spk.is_linear())
+    {
+      samples.allocate(spk.nch(), data.size);
+      copy_samples(samples, data.samples, spk.nch(), data.size);
+      chunk.set_linear(samples, data.size, data.sync, data.time);
+    }
+    else
+    {
+      rawdata.allocate(data.size);
+      memcpy(rawdata, data.rawdata, data.size);
+      chunk.set_rawdata(rawdata, data.size, data.sync, data.time);
+    }
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Single-producer/single-consumer ring queue
+//
+// Producer owns 'head' and fills the slot at head; consumer owns 'tail' and
+// reads the slot at tail. Slot is published with an atomic write of the index,
+// so no locks are required. One slot is always kept free to tell the
+// full queue from the empty one.
+
+class SlotQueue
+{
+protected:
+  Slot *slots;
+  long  nslots;
+  AtomicInt head;
+  AtomicInt tail;
+
+  inline long next(long i) const { return i + 1 < nslots? i + 1: 0; }
+
+public:
+  SlotQueue(): slots(0), nslots(0)
+  {}
+
+  ~SlotQueue()
+  { free(); }
+
+  void allocate(size_t size)
+  {
+    free();
+    slots = new Slot[size + 1];
+    nslots = long(size + 1);
+  }
+
+  void free()
+  {
+    delete[] slots;
+    slots = 0;
+    nslots = 0;
+    head.set(0);
+    tail.set(0);
+  }
+
+  // Producer side
+  inline bool can_push() const { return next(head.get()) != tail.get(); }
+  inline Slot &back() { return slots[head.get()]; }
+  inline void push() { head.set(next(head.get())); }
+
+  // Consumer side
+  inline bool can_pop() const { return tail.get() != head.get(); }
+  inline Slot &front() { return slots[tail.get()]; }
+  inline void pop() { tail.set(next(tail.get())); }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// ThreadedFilter::Private
+
+class ThreadedFilter::Private : public Thread
+{
+public:
+  Filter  *f;
+  size_t   queue_size;
+
+  Speakers in_spk;
+  Speakers out_spk;
+  bool     is_new_stream;
+  bool     is_flushing;   // flush request was sent to the worker
+  bool     out_pending;   // the front output slot was returned to the caller
+
+  SlotQueue input;        // caller -> worker
+  SlotQueue output;       // worker -> caller
+  Event     input_event;  // signaled by the caller: input pushed or output popped
+  Event     output_event; // signaled by the worker: output pushed or input popped
+
+  Private(Filter *f_, size_t queue_size_):
+  f(f_), queue_size(queue_size_), is_new_stream(false), is_flushing(false),
+  out_pending(false)
+  {}
+
+  ~Private()
+  { stop(); }
+
+  bool start();
+  void stop();
+  void release_output();
+  bool receive_output(Chunk &out);
+
+  // Worker thread
+  bool wait_output_slot();
+  bool send_data(const Chunk &chunk);
+  bool send_command(slot_type_t type);
+  bool send_error(boost::exception_ptr error);
+  virtual unsigned long process();
+};
+
+bool
+ThreadedFilter::Private::start()
+{
+  stop();
+  input.allocate(queue_size);
+  // One more slot is held by the caller until the next call
+  output.allocate(queue_size + 1);
+  is_new_stream = false;
+  is_flushing = false;
+  out_pending = false;
+  return create(false);
+}
+
+void
+ThreadedFilter::Private::stop()
+{
+  if (thread_exists())
+  {
+    f_terminate = true;
+    input_event.set();
+    terminate(terminate_timeout_ms);
+  }
+  input.free();
+  output.free();
+}
+
+void
+ThreadedFilter::Private::release_output()
+{
+  if (out_pending)
+  {
+    output.pop();
+    input_event.set();
+    out_pending = false;
+  }
+}
+
+// Takes the data slot at the front of the output queue and makes the output
+// chunk. Rethrows the worker's error.
+bool
+ThreadedFilter::Private::receive_output(Chunk &out)
+{
+  Slot &slot = output.front();
+  if (slot.type == slot_error)
+  {
+    boost::exception_ptr error = slot.error;
+    slot.error = boost::exception_ptr();
+    output.pop();
+    input_event.set();
+    boost::rethrow_exception(error);
+  }
+
+  if (slot.type != slot_data)
+  {
+    // Stray command acknowledgment, skip it
+    output.pop();
+    input_event.set();
+    return false;
+  }
+
+  out = slot.chunk;
+  out_spk = slot.spk;
+  is_new_stream = slot.new_stream;
+  out_pending = true;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Worker thread
+
+bool
+ThreadedFilter::Private::wait_output_slot()
+{
+  while (!output.can_push())
+  {
+    if (f_terminate) return false;
+    input_event.wait(worker_timeout_ms);
+  }
+  return true;
+}
+
+bool
+ThreadedFilter::Private::send_data(const Chunk &chunk)
+{
+  if (!wait_output_slot())
+    return false;
+
+  output.back().set_data(f->get_output(), chunk, f->new_stream());
+  output.push();
+  output_event.set();
+  return true;
+}
+
+bool
+ThreadedFilter::Private::send_command(slot_type_t type)
+{
+  if (!wait_output_slot())
+    return false;
+
+  output.back().set_command(type, f->get_output());
+  output.push();
+  output_event.set();
+  return true;
+}
+
+bool
+ThreadedFilter::Private::send_error(boost::exception_ptr error)
+{
+  if (!wait_output_slot())
+    return false;
+
+  Slot &slot = output.back();
+  slot.set_command(slot_error, f->get_output());
+  slot.error = error;
+  output.push();
+  output_event.set();
+  return true;
+}
+
+unsigned long
+ThreadedFilter::Private::process()
+{
+  // Denormal mode is per-thread, so set it for the whole thread life
+  DenormalGuard denormal_guard;
+  Chunk out;
+  bool failed = false; // error was sent, waiting for the reset request
+  while (!f_terminate)
+  {
+    if (!input.can_pop())
+    {
+      input_event.wait(worker_timeout_ms);
+      continue;
+    }
+
+    Slot &slot = input.front();
+    if (failed && slot.type != slot_reset)
+    {
+      // Do not process the data with the failed filter and do not send
+      // anything after the error
+      input.pop();
+      output_event.set();
+      continue;
+    }
+
+    bool ok = true;
+    try
+    {
+      switch (slot.type)
+      {
+      case slot_data:
+        while (ok && f->process(slot.chunk, out))
+          ok = send_data(out);
+        break;
+
+      case slot_flush:
+        while (ok && f->flush(out))
+          ok = send_data(out);
+        if (ok)
+          ok = send_command(slot_flush);
+        break;
+
+      case slot_reset:
+        failed = false;
+        f->reset();
+        ok = send_command(slot_reset);
+        break;
+
+      default:
+        assert(false);
+      }
+    }
+    catch (...)
+    {
+      // Filter state is undefined now. The caller must reset the filter,
+      // so just send the error and drop the input until the reset request.
+      send_error(boost::current_exception());
+      failed = true;
+    }
+
+    // Output was copied into the queue, do not keep the filter's buffer
+    out.clear();
+    input.pop();
+    output_event.set();
+  }
+  return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// ThreadedFilter
+
+ThreadedFilter::ThreadedFilter(Filter *f, size_t queue_size):
+p(new Private(f, queue_size))
+{}
+
+ThreadedFilter::~ThreadedFilter()
+{
+  delete p;
+}
+
+void
+ThreadedFilter::set_filter(Filter *f)
+{
+  close();
+  p->f = f;
+}
+
+Filter *
+ThreadedFilter::get_filter() const
+{
+  return p->f;
+}
+
+void
+ThreadedFilter::set_queue_size(size_t queue_size)
+{
+  p->queue_size = MAX(queue_size, 1);
+}
+
+size_t
+ThreadedFilter::get_queue_size() const
+{
+  return p->queue_size;
+}
+
+///////////////////////////////////////////////////////////
+// Open/close the filter
+
+bool
+ThreadedFilter::can_open(Speakers spk) const
+{
+  return p->f? p->f->can_open(spk): false;
+}
+
+bool
+ThreadedFilter::open(Speakers spk)
+{
+  p->stop();
+  if (!p->f || !p->f->open(spk))
+    return false;
+
+  p->in_spk = spk;
+  p->out_spk = p->f->get_output();
+  if (!p->start())
+  {
+    p->f->close();
+    return false;
+  }
+  return true;
+}
+
+void
+ThreadedFilter::close()
+{
+  p->stop();
+  if (p->f)
+    p->f->close();
+  p->in_spk = spk_unknown;
+  p->out_spk = spk_unknown;
+}
+
+bool
+ThreadedFilter::is_open() const
+{
+  return p->f && p->f->is_open() && p->thread_exists();
+}
+
+///////////////////////////////////////////////////////////
+// Processing
+
+void
+ThreadedFilter::reset()
+{
+  if (!is_open())
+    return;
+
+  p->release_output();
+
+  // Drop everything until the worker confirms the reset
+  bool sent = false;
+  while (true)
+  {
+    if (p->output.can_pop())
+    {
+      Slot &slot = p->output.front();
+      slot_type_t type = slot.type;
+      Speakers spk = slot.spk;
+      slot.error = boost::exception_ptr();
+      p->output.pop();
+      p->input_event.set();
+
+      if (sent && type == slot_reset)
+      {
+        p->out_spk = spk;
+        break;
+      }
+      continue;
+    }
+
+    if (!sent && p->input.can_push())
+    {
+      p->input.back().set_command(slot_reset, p->in_spk);
+      p->input.push();
+      p->input_event.set();
+      sent = true;
+      continue;
+    }
+
+    p->output_event.wait();
+  }
+
+  p->is_new_stream = false;
+  p->is_flushing = false;
+}
+
+bool
+ThreadedFilter::process(Chunk &in, Chunk &out)
+{
+  p->release_output();
+  while (true)
+  {
+    if (p->output.can_pop())
+    {
+      if (p->receive_output(out))
+        return true;
+      continue;
+    }
+
+    if (in.is_dummy())
+      return false;
+
+    if (p->input.can_push())
+    {
+      p->input.back().set_data(p->in_spk, in, false);
+      p->input.push();
+      p->input_event.set();
+      in.clear();
+      continue;
+    }
+
+    p->output_event.wait();
+  }
+}
+
+bool
+ThreadedFilter::flush(Chunk &out)
+{
+  p->release_output();
+  while (true)
+  {
+    if (p->output.can_pop())
+    {
+      Slot &slot = p->output.front();
+      if (slot.type == slot_flush && p->is_flushing)
+      {
+        p->out_spk = slot.spk;
+        p->is_new_stream = false;
+        p->is_flushing = false;
+        p->output.pop();
+        p->input_event.set();
+        return false;
+      }
+
+      if (p->receive_output(out))
+        return true;
+      continue;
+    }
+
+    if (!p->is_flushing && p->input.can_push())
+    {
+      p->input.back().set_command(slot_flush, p->in_spk);
+      p->input.push();
+      p->input_event.set();
+      p->is_flushing = true;
+      continue;
+    }
+
+    p->output_event.wait();
+  }
+}
+
+bool
+ThreadedFilter::new_stream() const
+{
+  return p->is_new_stream;
+}
+
+///////////////////////////////////////////////////////////
+// Filter state
+
+Speakers
+ThreadedFilter::get_input() const
+{
+  return p->in_spk;
+}
+
+Speakers
+ThreadedFilter::get_output() const
+{
+  return p->out_spk;
+}
+
+///////////////////////////////////////////////////////////
+// Filter info
+
+string
+ThreadedFilter::info() const
+{
+  return p->f? p->f->info(): string();
+}
+
+string
+ThreadedFilter::name() const
+{
+  return p->f? Filter::name() + "/" + p->f->name(): Filter::name();
+}
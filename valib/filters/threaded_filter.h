@@ -0,0 +1,125 @@
+/**************************************************************************//**
+  \file threaded_filter.h
+  \brief ThreadedFilter: run a filter on a separate worker thread.
+******************************************************************************/
+
+#ifndef VALIB_THREADED_FILTER_H
+#define VALIB_THREADED_FILTER_H
+
+#include "../filter.h"
+
+/**************************************************************************//**
+  \class ThreadedFilter
+  \brief Runs the wrapped filter on a worker thread.
+
+  Filter chain runs all filters on the caller's thread, so a long chain can
+  use only one processor core. ThreadedFilter moves the wrapped filter (or a
+  group of filters wrapped into FilterChain) to a worker thread. Several
+  threaded filters in a chain form a pipeline where each stage works in
+  parallel with others:
+
+  \code
+  FilterChain stage1(&mixer, &resample);
+  FilterChain stage2(&convolver, &dither);
+
+  ThreadedFilter t1(&stage1);
+  ThreadedFilter t2(&stage2);
+
+  FilterChain chain(&decoder, &t1, &t2, &converter);
+  \endcode
+
+  The caller and the worker are joined with two bounded single-producer/
+  single-consumer queues of chunks: the input queue and the output queue.
+  Queue slots own their buffers, so chunk data is copied when it crosses the
+  thread boundary. Queues are lock-free, the threads sleep only when the queue
+  they wait for is empty (or full).
+
+  process() sends the input chunk to the worker and returns an output chunk
+  when it is ready. When no output is ready yet it returns false immediately,
+  so the upstream may produce the next chunk while the worker processes the
+  previous one. Therefore the filter behaves as a buffering filter. Output
+  chunk points to the queue's slot and it is valid until the next call to
+  process(), flush() or reset().
+
+  Timestamps, new_stream() and output format changes are transferred from the
+  worker with each output chunk, so the wrapped filter's semantics is
+  preserved. flush() sends a flush request through the input queue and waits
+  until the worker flushes the wrapped filter and returns all the data
+  buffered. reset() drops all the data in queues and resets the wrapped filter.
+
+  Filter errors thrown at the worker thread are transferred to the caller and
+  rethrown at process() or flush().
+
+  The wrapped filter must not be touched directly while the threaded filter
+  is open. Parameters that affect the wrapped filter on the fly (like gain)
+  may be changed only if the filter allows it in a multithreaded environment.
+
+  \fn ThreadedFilter::ThreadedFilter(Filter *f = 0, size_t queue_size = 4)
+    \param f          Filter to run on the worker thread.
+    \param queue_size Number of chunks in each queue.
+
+  \fn void ThreadedFilter::set_filter(Filter *f)
+    \param f Filter to run on the worker thread.
+
+    Set the filter to run. Closes the threaded filter if it is open.
+
+  \fn Filter *ThreadedFilter::get_filter() const
+    Returns the filter wrapped.
+
+  \fn void ThreadedFilter::set_queue_size(size_t queue_size)
+    \param queue_size Number of chunks in each queue.
+
+    Set the depth of the queues. More chunks in queues smooth the processing
+    time jitter between pipeline stages, but increase memory usage. Change
+    takes effect at the next open() call.
+
+  \fn size_t ThreadedFilter::get_queue_size() const
+    Returns the depth of queues.
+******************************************************************************/
+
+class ThreadedFilter : public Filter
+{
+public:
+  ThreadedFilter(Filter *f = 0, size_t queue_size = 4);
+  virtual ~ThreadedFilter();
+
+  void    set_filter(Filter *f);
+  Filter *get_filter() const;
+
+  void    set_queue_size(size_t queue_size);
+  size_t  get_queue_size() const;
+
+  /////////////////////////////////////////////////////////
+  // Open/close the filter
+
+  virtual bool can_open(Speakers spk) const;
+  virtual bool open(Speakers spk);
+  virtual void close();
+  virtual bool is_open() const;
+
+  /////////////////////////////////////////////////////////
+  // Processing
+
+  virtual void reset();
+  virtual bool process(Chunk &in, Chunk &out);
+  virtual bool flush(Chunk &out);
+  virtual bool new_stream() const;
+
+  /////////////////////////////////////////////////////////
+  // Filter state
+
+  virtual Speakers get_input() const;
+  virtual Speakers get_output() const;
+
+  /////////////////////////////////////////////////////////
+  // Filter info
+
+  virtual string info() const;
+  virtual string name() const;
+
+protected:
+  class Private;
+  Private *p;
+};
+
+#endif
@@ -1,4 +1,10 @@
+#include <math.h>
 #include "iir.h"
+#include "cpu.h"
+
+#ifdef VALIB_SSE2
+#include <emmintrin.h>
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 // Constant generators
@@ -73,13 +79,226 @@ bool IIRInstance::is_infinity() const
 
 
 
+///////////////////////////////////////////////////////////////////////////////
+// Section processing
+//
+// Transposed direct form II section with b0 = 1. Scalar and vector versions
+// use the same order of operations, so they produce the same result.
+
+static inline sample_t section(IIRLanes &s, int lane, sample_t x)
+{
+  sample_t y = x + s.s1[lane];
+  s.s1[lane] = (s.b1[lane] * x + s.s2[lane]) - s.a1[lane] * y;
+  s.s2[lane] = s.b2[lane] * x - s.a2[lane] * y;
+  return y;
+}
+
+// Cascade of sections of a single channel: section k is the lane k % size of
+// the group k / size.
+static void cascade(IIRLanes *groups, int nsections, sample_t gain, sample_t *samples, size_t nsamples)
+{
+  for (size_t i = 0; i < nsamples; i++)
+  {
+    sample_t y = gain * samples[i];
+    for (int k = 0; k < nsections; k++)
+      y = section(groups[k / IIRLanes::size], k % IIRLanes::size, y);
+    samples[i] = y;
+  }
+}
+
+// Cascade of sections of a single lane
+static void cascade_lane(IIRLanes *sections, int nsections, int lane, sample_t gain, sample_t *samples, size_t nsamples)
+{
+  for (size_t i = 0; i < nsamples; i++)
+  {
+    sample_t y = gain * samples[i];
+    for (int k = 0; k < nsections; k++)
+      y = section(sections[k], lane, y);
+    samples[i] = y;
+  }
+}
+
+#ifdef VALIB_SSE2
+
+#ifdef FLOAT_SAMPLE
+
+typedef __m128 vec_t;
+
+static inline vec_t vload(const sample_t *p)        { return _mm_loadu_ps(p); }
+static inline void  vstore(sample_t *p, vec_t v)    { _mm_storeu_ps(p, v); }
+static inline vec_t vzero()                         { return _mm_setzero_ps(); }
+static inline vec_t vadd(vec_t a, vec_t b)          { return _mm_add_ps(a, b); }
+static inline vec_t vsub(vec_t a, vec_t b)          { return _mm_sub_ps(a, b); }
+static inline vec_t vmul(vec_t a, vec_t b)          { return _mm_mul_ps(a, b); }
+static inline vec_t vselect(vec_t m, vec_t a, vec_t b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+
+// Mask of lanes lo..hi
+static inline vec_t vlanes(int lo, int hi)
+{
+  const vec_t lane = _mm_set_ps(3, 2, 1, 0);
+  return _mm_and_ps(_mm_cmpge_ps(lane, _mm_set1_ps(float(lo))), _mm_cmple_ps(lane, _mm_set1_ps(float(hi))));
+}
+
+// Shift lanes up and put x into the lane 0
+static inline vec_t vshift_in(vec_t v, sample_t x)
+{ return _mm_move_ss(_mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)), _mm_set_ss(x)); }
+
+static inline void vstore_last(sample_t *p, vec_t v)
+{ _mm_store_ss(p, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))); }
+
+static inline vec_t vgather(sample_t *const *p, size_t i)
+{ return _mm_set_ps(p[3][i], p[2][i], p[1][i], p[0][i]); }
+
+static inline void vscatter(sample_t *const *p, size_t i, vec_t v)
+{
+  _mm_store_ss(p[0] + i, v);
+  _mm_store_ss(p[1] + i, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+  _mm_store_ss(p[2] + i, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)));
+  _mm_store_ss(p[3] + i, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)));
+}
+
+#else
+
+typedef __m128d vec_t;
+
+static inline vec_t vload(const sample_t *p)        { return _mm_loadu_pd(p); }
+static inline void  vstore(sample_t *p, vec_t v)    { _mm_storeu_pd(p, v); }
+static inline vec_t vzero()                         { return _mm_setzero_pd(); }
+static inline vec_t vadd(vec_t a, vec_t b)          { return _mm_add_pd(a, b); }
+static inline vec_t vsub(vec_t a, vec_t b)          { return _mm_sub_pd(a, b); }
+static inline vec_t vmul(vec_t a, vec_t b)          { return _mm_mul_pd(a, b); }
+static inline vec_t vselect(vec_t m, vec_t a, vec_t b) { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+
+// Mask of lanes lo..hi
+static inline vec_t vlanes(int lo, int hi)
+{
+  const vec_t lane = _mm_set_pd(1, 0);
+  return _mm_and_pd(_mm_cmpge_pd(lane, _mm_set1_pd(lo)), _mm_cmple_pd(lane, _mm_set1_pd(hi)));
+}
+
+// Shift lanes up and put x into the lane 0
+static inline vec_t vshift_in(vec_t v, sample_t x)
+{ return _mm_unpacklo_pd(_mm_set_sd(x), v); }
+
+static inline void vstore_last(sample_t *p, vec_t v)
+{ _mm_storeh_pd(p, v); }
+
+static inline vec_t vgather(sample_t *const *p, size_t i)
+{ return _mm_loadh_pd(_mm_load_sd(p[0] + i), p[1] + i); }
+
+static inline void vscatter(sample_t *const *p, size_t i, vec_t v)
+{
+  _mm_store_sd(p[0] + i, v);
+  _mm_storeh_pd(p[1] + i, v);
+}
+
+#endif
+
+static inline vec_t vsection(vec_t x, const IIRLanes &s, vec_t &s1, vec_t &s2)
+{
+  vec_t y = vadd(x, s1);
+  s1 = vsub(vadd(vmul(vload(s.b1), x), s2), vmul(vload(s.a1), y));
+  s2 = vsub(vmul(vload(s.b2), x), vmul(vload(s.a2), y));
+  return y;
+}
+
+// Pipelined cascade of the sections of a group: at step t lane j filters
+// the sample t - j. Lanes out of the data range keep their state.
+static void cascade_sse2(IIRLanes &s, sample_t *samples, size_t nsamples)
+{
+  const int lanes = IIRLanes::size;
+  const size_t steps = nsamples + lanes - 1;
+
+  vec_t s1 = vload(s.s1);
+  vec_t s2 = vload(s.s2);
+  vec_t y = vzero();
+
+  for (size_t t = 0; t < steps; t++)
+  {
+    vec_t x = vshift_in(y, t < nsamples? samples[t]: 0);
+    if (t < size_t(lanes - 1) || t >= nsamples)
+    {
+      // Active lanes are j: 0 <= t - j < nsamples
+      int lo = t < nsamples? 0: int(t - nsamples + 1);
+      int hi = t < size_t(lanes - 1)? int(t): lanes - 1;
+      vec_t mask = vlanes(lo, hi);
+      vec_t new_s1 = s1;
+      vec_t new_s2 = s2;
+      y = vsection(x, s, new_s1, new_s2);
+      s1 = vselect(mask, new_s1, s1);
+      s2 = vselect(mask, new_s2, s2);
+    }
+    else
+      y = vsection(x, s, s1, s2);
+
+    if (t >= size_t(lanes - 1))
+      vstore_last(samples + t - (lanes - 1), y);
+  }
+
+  vstore(s.s1, s1);
+  vstore(s.s2, s2);
+}
+
+#endif
+
+// State values below this level are flushed to zero. It is far below any
+// meaningful signal level, but far above the denormal range of float.
+static const sample_t denormal_level = sample_t(1e-20);
+
+// Block size for multichannel processing (size of the scratch buffer)
+static const size_t block_size = 256;
+
+///////////////////////////////////////////////////////////////////////////////
+// IIRLanes
+
+IIRLanes::IIRLanes()
+{
+  for (int i = 0; i < size; i++)
+  {
+    a1[i] = a2[i] = 0;
+    b1[i] = b2[i] = 0;
+    s1[i] = s2[i] = 0;
+  }
+}
+
+void
+IIRLanes::set(int lane, const Biquad &biquad)
+{
+  assert(lane >= 0 && lane < size);
+  a1[lane] = sample_t(biquad.a[1] / biquad.a[0]);
+  a2[lane] = sample_t(biquad.a[2] / biquad.a[0]);
+  b1[lane] = sample_t(biquad.b[1] / biquad.b[0]);
+  b2[lane] = sample_t(biquad.b[2] / biquad.b[0]);
+  s1[lane] = 0;
+  s2[lane] = 0;
+}
+
+void
+IIRLanes::reset()
+{
+  for (int i = 0; i < size; i++)
+    s1[i] = s2[i] = 0;
+}
+
+void
+IIRLanes::flush_denormals()
+{
+  for (int i = 0; i < size; i++)
+  {
+    if (fabs(s1[i]) < denormal_level) s1[i] = 0;
+    if (fabs(s2[i]) < denormal_level) s2[i] = 0;
+  }
+}
+
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // IIRFilter
 
-IIRFilter::IIRFilter(): gain(1.0)
+IIRFilter::IIRFilter(): gain(1.0), nsections(0)
 {}
 
-IIRFilter::IIRFilter(const IIRInstance *iir): gain(1.0)
+IIRFilter::IIRFilter(const IIRInstance *iir): gain(1.0), nsections(0)
 {
   init(iir);
 }
@@ -112,20 +331,15 @@ IIRFilter::init(const IIRInstance *iir)
 
   /////////////////////////////////////////////////////////
   // Normalize and copy non-trivial sections
+  // Spare lanes of the last group remain identity
 
   for (size_t i = 0; i < iir->sections.size(); i++)
     if (!iir->sections[i].is_gain())
     {
-      Section s;
-      Biquad b = iir->sections[i];
-      s.a1 = b.a[1] / b.a[0];
-      s.a2 = b.a[2] / b.a[0];
-      s.b1 = b.b[1] / b.b[0];
-      s.b2 = b.b[2] / b.b[0];
-      s.h1 = 0;
-      s.h2 = 0;
-
-      sections.push_back(s);
+      if (nsections % IIRLanes::size == 0)
+        groups.push_back(IIRLanes());
+      groups.back().set(nsections % IIRLanes::size, iir->sections[i]);
+      nsections++;
     }
 
   return true;
@@ -135,7 +349,8 @@ void
 IIRFilter::drop()
 {
   gain = 1.0;
-  sections.clear();
+  nsections = 0;
+  groups.clear();
 }
 
 void
@@ -146,7 +361,7 @@ IIRFilter::process(sample_t *samples, size_t nsamples)
   /////////////////////////////////////
   // Trivial cases
 
-  if (sections.empty())
+  if (nsections == 0)
   {
     if (gain == 1.0)
     {
@@ -168,32 +383,226 @@ IIRFilter::process(sample_t *samples, size_t nsamples)
   }
 
   /////////////////////////////////////
-  // Apply direct form 2 cascade
+  // Apply the cascade
+
+#ifdef VALIB_SSE2
+  if (nsections > 1 && (cpu_features() & cpu_sse2))
+  {
+    if (g != 1.0)
+      gain_samples(g, samples, nsamples);
+    for (size_t i = 0; i < groups.size(); i++)
+      cascade_sse2(groups[i], samples, nsamples);
+  }
+  else
+#endif
+    cascade(&groups[0], nsections, g, samples, nsamples);
+
+  for (size_t i = 0; i < groups.size(); i++)
+    groups[i].flush_denormals();
+}
+
+void
+IIRFilter::reset()
+{
+  for (size_t i = 0; i < groups.size(); i++)
+    groups[i].reset();
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// IIRMultiFilter
+
+IIRMultiFilter::IIRMultiFilter(): nch(0)
+{
+  drop();
+}
+
+bool
+IIRMultiFilter::init(int nch_, const IIRInstance *iir)
+{
+  const IIRInstance *iirs[NCHANNELS];
+  for (int ch = 0; ch < nch_; ch++)
+    iirs[ch] = iir;
+  return init(nch_, iirs);
+}
+
+bool
+IIRMultiFilter::init(int nch_, const IIRInstance *const *iir)
+{
+  assert(nch_ >= 0 && nch_ <= NCHANNELS);
+  int ch, i;
+
+  drop();
+  for (ch = 0; ch < nch_; ch++)
+    if (iir[ch] && iir[ch]->is_infinity())
+      return false;
+
+  /////////////////////////////////////////////////////////
+  // Channel gains and number of non-trivial sections
+
+  int nsections[NCHANNELS];
+  for (ch = 0; ch < nch_; ch++)
+  {
+    nsections[ch] = 0;
+    if (!iir[ch])
+      continue;
+
+    if (iir[ch]->is_null())
+    {
+      gain[ch] = 0;
+      continue;
+    }
+
+    gain[ch] = iir[ch]->get_gain();
+    for (i = 0; i < (int)iir[ch]->sections.size(); i++)
+      if (!iir[ch]->sections[i].is_gain())
+        nsections[ch]++;
+  }
 
-  Section *s;
-  Section *begin = &sections[0];
-  Section *end   = begin + sections.size();
-  sample_t y, h;
-  while (nsamples--)
+  /////////////////////////////////////////////////////////
+  // Order channels with sections by the number of sections
+  // (descending, keep the channel order otherwise)
+
+  int order[NCHANNELS];
+  int n = 0;
+  for (ch = 0; ch < nch_; ch++)
+    if (nsections[ch])
+    {
+      for (i = n; i > 0 && nsections[order[i-1]] < nsections[ch]; i--)
+        order[i] = order[i-1];
+      order[i] = ch;
+      n++;
+    }
+
+  /////////////////////////////////////////////////////////
+  // Build groups
+
+  for (i = 0; i < n; i += IIRLanes::size)
   {
-    y = g * *samples;
-    for (s = begin; s < end; s++)
+    Group group;
+    group.first = sections.size();
+    group.nsections = nsections[order[i]];
+    sections.resize(group.first + group.nsections);
+
+    for (int lane = 0; lane < IIRLanes::size; lane++)
     {
-      h = y - s->a1 * s->h1 - s->a2 * s->h2;
-      y = h + s->b1 * s->h1 + s->b2 * s->h2;
-      s->h2 = s->h1;
-      s->h1 = h;
+      if (i + lane >= n)
+      {
+        group.ch[lane] = -1;
+        group.gain[lane] = 0;
+        continue;
+      }
+
+      ch = order[i + lane];
+      group.ch[lane] = ch;
+      group.gain[lane] = gain[ch];
+      grouped[ch] = true;
+
+      int k = 0;
+      for (size_t j = 0; j < iir[ch]->sections.size(); j++)
+        if (!iir[ch]->sections[j].is_gain())
+          sections[group.first + k++].set(lane, iir[ch]->sections[j]);
     }
-    *samples++ = y;
+    groups.push_back(group);
+  }
+
+  scratch.assign(block_size, 0);
+  nch = nch_;
+  return true;
+}
+
+void
+IIRMultiFilter::drop()
+{
+  nch = 0;
+  for (int ch = 0; ch < NCHANNELS; ch++)
+  {
+    gain[ch] = 1.0;
+    grouped[ch] = false;
   }
+  groups.clear();
+  sections.clear();
 }
 
 void
-IIRFilter::reset()
+IIRMultiFilter::process(samples_t samples, size_t nsamples)
 {
-  for (size_t i = 0; i < sections.size(); i++)
+  /////////////////////////////////////
+  // Channels without sections
+
+  for (int ch = 0; ch < nch; ch++)
+    if (!grouped[ch])
+    {
+      if (gain[ch] == 0)
+        zero_samples(samples[ch], nsamples);
+      else if (gain[ch] != 1.0)
+        gain_samples(gain[ch], samples[ch], nsamples);
+    }
+
+  if (groups.empty())
+    return;
+
+  /////////////////////////////////////
+  // Groups
+
+  const size_t ngroups = groups.size();
+  size_t g;
+
+#ifdef VALIB_SSE2
+  if (cpu_features() & cpu_sse2)
+  {
+    // All groups are processed at each sample, so the recursions of
+    // different groups overlap
+    sample_t *ptr[NCHANNELS][IIRLanes::size];
+    for (size_t pos = 0; pos < nsamples; pos += block_size)
+    {
+      size_t n = MIN(block_size, nsamples - pos);
+      for (g = 0; g < ngroups; g++)
+        for (int lane = 0; lane < IIRLanes::size; lane++)
+        {
+          int ch = groups[g].ch[lane];
+          ptr[g][lane] = ch >= 0? samples[ch] + pos: &scratch[0];
+        }
+
+      for (size_t i = 0; i < n; i++)
+        for (g = 0; g < ngroups; g++)
+        {
+          const Group &group = groups[g];
+          IIRLanes *s = &sections[group.first];
+          vec_t y = vmul(vgather(ptr[g], i), vload(group.gain));
+          for (int k = 0; k < group.nsections; k++, s++)
+          {
+            vec_t s1 = vload(s->s1);
+            vec_t s2 = vload(s->s2);
+            y = vsection(y, *s, s1, s2);
+            vstore(s->s1, s1);
+            vstore(s->s2, s2);
+          }
+          vscatter(ptr[g], i, y);
+        }
+    }
+  }
+  else
+#endif
   {
-    sections[i].h1 = 0;
-    sections[i].h2 = 0;
+    for (g = 0; g < ngroups; g++)
+      for (int lane = 0; lane < IIRLanes::size; lane++)
+      {
+        int ch = groups[g].ch[lane];
+        if (ch >= 0)
+          cascade_lane(&sections[groups[g].first], groups[g].nsections,
+            lane, groups[g].gain[lane], samples[ch], nsamples);
+      }
   }
+
+  for (size_t i = 0; i < sections.size(); i++)
+    sections[i].flush_denormals();
+}
+
+void
+IIRMultiFilter::reset()
+{
+  for (size_t i = 0; i < sections.size(); i++)
+    sections[i].reset();
 }
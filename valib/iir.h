@@ -8,6 +8,7 @@
 
 #include <vector>
 #include "defs.h"
+#include "spk.h"
 
 class IIRGen;
 class IIRInstance;
@@ -17,7 +18,9 @@ class IIRZero;
 class IIRIdentity;
 class IIRGain;
 
+struct IIRLanes;
 class IIRFilter;
+class IIRMultiFilter;
 
 /**************************************************************************//**
   \class IIRGen
@@ -353,9 +356,66 @@ public:
   { return ver; }
 };
 
+/**************************************************************************//**
+  \struct IIRLanes
+  \brief Coefficients and state of a group of biquad sections processed in
+  parallel SIMD lanes.
+
+  Each lane holds a transposed direct form II section with b0 = 1 (the gain
+  is applied to the input separately):
+
+  \verbatim
+  y  = x + s1
+  s1 = b1*x - a1*y + s2
+  s2 = b2*x - a2*y
+  \endverbatim
+
+  Transposed form has only one addition between the input and the output of
+  the section, so a cascade adds little latency per section. A lane with all
+  coefficients zero is an identity section, so lanes may be padded without
+  changing the result.
+
+  Number of lanes is the number of samples fitting into a 128-bit register:
+  2 for double and 4 for float samples.
+
+  \fn void IIRLanes::set(int lane, const Biquad &biquad)
+    Set the lane section from a biquad and reset its state. Biquad gain
+    (b0/a0) is not included.
+
+  \fn void IIRLanes::reset()
+    Reset the state of all lanes.
+
+  \fn void IIRLanes::flush_denormals()
+    Zero state values below the denormal threshold.
+******************************************************************************/
+
+struct IIRLanes
+{
+  enum { size = 16 / sizeof(sample_t) };
+
+  sample_t a1[size], a2[size];
+  sample_t b1[size], b2[size];
+  sample_t s1[size], s2[size];
+
+  IIRLanes();
+
+  void set(int lane, const Biquad &biquad);
+  void reset();
+  void flush_denormals();
+};
+
 /**************************************************************************//**
   \class IIRFilter
-  \brief Simple direct form II filter implementation
+  \brief Cascade of biquad sections for a single channel
+
+  Sections are stored by groups of IIRLanes::size consecutive sections. With
+  SSE2 a group is processed as a pipeline: lane k filters the output of lane
+  k-1 delayed by one sample, so all sections of a group run in one vector
+  operation. Without SSE2 (or for a single section) sections are processed
+  one sample at a time.
+
+  Filter state values below the denormal threshold are flushed to zero after
+  each process() call, so the filter does not slow down on silence.
 
   \fn IIRFilter::IIRFilter()
     Constructs a default filter that does not change the input signel.
@@ -387,16 +447,9 @@ public:
 class IIRFilter
 {
 protected:
-  //! Direct form 2 IIR filter section
-  struct Section
-  {
-    sample_t a1, a2;
-    sample_t b1, b2;
-    sample_t h1, h2;
-  };
-
   sample_t gain;                 ///< Global gain
-  std::vector<Section> sections; ///< Filter sections
+  int nsections;                 ///< Number of non-trivial sections
+  std::vector<IIRLanes> groups;  ///< Sections by groups of IIRLanes::size
 
 public:
   IIRFilter();
@@ -409,6 +462,81 @@ public:
   void reset();
 };
 
+/**************************************************************************//**
+  \class IIRMultiFilter
+  \brief Multichannel IIR filter. Channels are processed in parallel SIMD
+  lanes.
+
+  Each channel has its own response. Channels with non-trivial responses are
+  grouped by IIRLanes::size channels (channels with more sections go first,
+  so groups are padded less), and all groups are processed together sample
+  by sample. So the independent recursions of different groups overlap
+  instead of waiting for each other.
+
+  A channel without sections (gain, identity or null response) is just
+  gained. Spare lanes of a group that is not full work on a scratch buffer.
+
+  Filter state values below the denormal threshold are flushed to zero after
+  each process() call.
+
+  \fn bool IIRMultiFilter::init(int nch, const IIRInstance *const *iir)
+    \param nch Number of channels
+    \param iir Array of nch responses. Null response means identity.
+
+    Initializes the filter with per-channel responses. Returns false when
+    some response cannot be implemented (see IIRInstance::is_infinity());
+    the filter is dropped in this case.
+
+  \fn bool IIRMultiFilter::init(int nch, const IIRInstance *iir)
+    \param nch Number of channels
+    \param iir Response for all channels
+
+    Initializes all channels with the same response.
+
+  \fn void IIRMultiFilter::drop()
+    Drops the filter. Equivalent to initialization with identity filters.
+
+  \fn void IIRMultiFilter::process(samples_t samples, size_t nsamples)
+    \param samples Data to process (inplace)
+    \param nsamples Number of samples to process
+
+    Process the data.
+
+  \fn void IIRMultiFilter::reset()
+    Reset the internal processing state.
+
+******************************************************************************/
+
+class IIRMultiFilter
+{
+public:
+  IIRMultiFilter();
+
+  bool init(int nch, const IIRInstance *const *iir);
+  bool init(int nch, const IIRInstance *iir);
+  void drop();
+
+  void process(samples_t samples, size_t nsamples);
+  void reset();
+
+protected:
+  //! Group of channels processed together
+  struct Group
+  {
+    int ch[IIRLanes::size];        ///< Channel of each lane (-1 for a spare lane)
+    sample_t gain[IIRLanes::size]; ///< Gain of each lane
+    size_t first;                  ///< First section at the sections array
+    int nsections;                 ///< Number of sections
+  };
+
+  int nch;
+  sample_t gain[NCHANNELS];        ///< Gain of channels without sections
+  bool grouped[NCHANNELS];         ///< Channel is processed by a group
+  std::vector<Group> groups;
+  std::vector<IIRLanes> sections;
+  std::vector<sample_t> scratch;   ///< Data of spare lanes
+};
+
 
 
 /******************************************************************************
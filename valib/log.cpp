@@ -1,9 +1,18 @@
 #include <algorithm>
 #include <vector>
 #include <time.h>
-#include "win32/thread.h"
+#include "thread.h"
 #include "log.h"
 
+#ifdef _MSC_VER
+#define snprintf _snprintf
+#endif
+
+// va_list may be used only once on some platforms
+#ifndef va_copy
+#define va_copy(dst, src) ((dst) = (src))
+#endif
+
 using std::string;
 
 // Default message buffer size for sprintf.
@@ -38,7 +47,7 @@ LogEntry::print() const
   char buf[64] = "0000-00-00 00:00:00 | 0 | ";
   size_t len = 0;
   if (pt)
-    len = _snprintf(buf, array_size(buf), "%04i-%02i-%02i %02i:%02i:%02i | %i | ",
+    len = snprintf(buf, array_size(buf), "%04i-%02i-%02i %02i:%02i:%02i | %i | ",
       pt->tm_year + 1900, pt->tm_mon + 1, pt->tm_mday, 
       pt->tm_hour, pt->tm_min, pt->tm_sec, 
       level);
@@ -89,11 +98,18 @@ void LogDispatcher::vlog_impl(int level, const std::string &module, const char *
   size_t len = 0;
   while (true)
   {
-    len = vsnprintf(&(buf[0]), buf.size(), format, args);
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int result = vsnprintf(&(buf[0]), buf.size(), format, args_copy);
+    va_end(args_copy);
+
+    // Result is negative or exceeds the buffer on truncation
+    len = result < 0? buf.size(): size_t(result);
     if (len < buf.size() || buf.size() >= max_message_size)
       break;
     buf.resize(buf.size() * 2);
   }
+  len = MIN(len, buf.size() - 1);
 
   // Drop newline from the end of the line
   while (len && (buf[len-1] == '\n' || buf[len-1] == '\r' || buf[len-1] == 0))
@@ -130,7 +146,7 @@ void LogDispatcher::remove_sink(LogSink *sink)
 class LogMem::Private
 {
 public:
-  LogMem::Private(): pos(0), max_size(0)
+  Private(): pos(0), max_size(0)
   {}
 
   size_t pos;
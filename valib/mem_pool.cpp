@@ -0,0 +1,297 @@
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include "mem_pool.h"
+#include "thread.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Block layout: header is placed just before the aligned data.
+// Header keeps the pointer returned by malloc() and the size class.
+
+struct BlockHeader
+{
+  void *raw;
+  int cls;      // size class, -1 for large blocks
+};
+
+union FreeBlock
+{
+  FreeBlock *next;
+  char data[1];
+};
+
+static const int nclasses = 17; // pool_align << 16 == pool_max_block
+
+static size_t class_size(int cls)
+{ return pool_align << cls; }
+
+static int size_class(size_t size)
+{
+  int cls = 0;
+  while (cls < nclasses && class_size(cls) < size)
+    cls++;
+  return cls < nclasses? cls: -1;
+}
+
+static inline BlockHeader *header(void *ptr)
+{ return (BlockHeader *)ptr - 1; }
+
+static void *block_alloc(size_t size, int cls)
+{
+  if (size > size_t(-1) - pool_align - sizeof(BlockHeader))
+    throw std::bad_alloc();
+
+  void *raw = malloc(size + pool_align + sizeof(BlockHeader));
+  if (!raw)
+    throw std::bad_alloc();
+
+  size_t data = ((size_t)raw + sizeof(BlockHeader) + pool_align - 1) & ~(pool_align - 1);
+  BlockHeader *h = header((void *)data);
+  h->raw = raw;
+  h->cls = cls;
+  return (void *)data;
+}
+
+static void block_free(void *ptr)
+{
+  free(header(ptr)->raw);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Pool of free blocks
+//
+// Pool may be used during the static initialization and destruction, before
+// it is constructed or after it is destroyed (static buffers of other
+// translation units). pool_alive flag is a POD, so it is valid at any time;
+// blocks bypass the pool when it is not alive.
+
+static bool pool_alive = false;
+
+class MemPool
+{
+public:
+  MemPool(): cached(0)
+  {
+    for (int i = 0; i < nclasses; i++)
+      free_list[i] = 0;
+    memset(&stat, 0, sizeof(stat));
+    pool_alive = true;
+  }
+
+  ~MemPool()
+  {
+    pool_alive = false;
+    release();
+  }
+
+  // Counts the allocation and takes the block of the class from the cache.
+  // Returns null when the block must be taken from the heap.
+  void *alloc(int cls, size_t size)
+  {
+    AutoLock autolock(&lock);
+    stat.allocs++;
+    stat.bytes += size;
+
+    FreeBlock *block = cls >= 0? free_list[cls]: 0;
+    if (!block)
+    {
+      stat.heap_allocs++;
+      stat.heap_bytes += size;
+      return 0;
+    }
+
+    free_list[cls] = block->next;
+    cached -= class_size(cls);
+    return block;
+  }
+
+  bool put(void *ptr, int cls)
+  {
+    AutoLock autolock(&lock);
+    if (cached + class_size(cls) > pool_max_cache)
+      return false;
+
+    FreeBlock *block = (FreeBlock *)ptr;
+    block->next = free_list[cls];
+    free_list[cls] = block;
+    cached += class_size(cls);
+    return true;
+  }
+
+  void release()
+  {
+    AutoLock autolock(&lock);
+    for (int i = 0; i < nclasses; i++)
+      while (free_list[i])
+      {
+        FreeBlock *block = free_list[i];
+        free_list[i] = block->next;
+        block_free(block);
+      }
+    cached = 0;
+  }
+
+  size_t cache_size()
+  {
+    AutoLock autolock(&lock);
+    return cached;
+  }
+
+  PoolStat get_stat()
+  {
+    AutoLock autolock(&lock);
+    return stat;
+  }
+
+protected:
+  CritSec lock;
+  FreeBlock *free_list[nclasses];
+  size_t cached;
+  PoolStat stat;
+};
+
+static MemPool pool;
+
+///////////////////////////////////////////////////////////////////////////////
+
+void *pool_alloc(size_t size, size_t *allocated)
+{
+  if (size > size_t(-1) - pool_align)
+    throw std::bad_alloc();
+
+  int cls = size_class(size);
+  size_t block_size = cls < 0? (size + pool_align - 1) & ~(pool_align - 1): class_size(cls);
+
+  void *ptr = 0;
+  if (pool_alive)
+    ptr = pool.alloc(cls, block_size);
+  if (!ptr)
+    ptr = block_alloc(block_size, cls);
+
+  if (allocated)
+    *allocated = block_size;
+  return ptr;
+}
+
+void pool_free(void *ptr) throw()
+{
+  if (!ptr)
+    return;
+
+  int cls = header(ptr)->cls;
+  if (cls >= 0 && pool_alive && pool.put(ptr, cls))
+    return;
+  block_free(ptr);
+}
+
+size_t pool_cache_size()
+{
+  return pool_alive? pool.cache_size(): 0;
+}
+
+void pool_release()
+{
+  if (pool_alive)
+    pool.release();
+}
+
+PoolStat pool_stat()
+{
+  if (pool_alive)
+    return pool.get_stat();
+
+  PoolStat stat;
+  memset(&stat, 0, sizeof(stat));
+  return stat;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Arena
+
+Arena::Arena(size_t block_size_):
+block_size(block_size_), cur(0), pos(0)
+{}
+
+Arena::~Arena()
+{
+  release();
+}
+
+void *Arena::alloc(size_t size)
+{
+  if (size > size_t(-1) - pool_align)
+    throw std::bad_alloc();
+  size = (size + pool_align - 1) & ~(pool_align - 1);
+
+  // Skip blocks that are too small
+  while (cur < blocks.size() && blocks[cur].size - pos < size)
+  {
+    cur++;
+    pos = 0;
+  }
+
+  if (cur == blocks.size())
+  {
+    Block block;
+    block.data = (char *)pool_alloc(MAX(size, block_size), &block.size);
+    try
+    {
+      blocks.push_back(block);
+    }
+    catch (...)
+    {
+      pool_free(block.data);
+      throw;
+    }
+  }
+
+  void *ptr = blocks[cur].data + pos;
+  pos += size;
+  return ptr;
+}
+
+Arena::Mark Arena::mark() const
+{
+  Mark mark;
+  mark.block = cur;
+  mark.pos = pos;
+  return mark;
+}
+
+void Arena::rewind(Mark mark)
+{
+  assert(mark.block < cur || (mark.block == cur && mark.pos <= pos));
+  cur = mark.block;
+  pos = mark.pos;
+}
+
+void Arena::reset()
+{
+  cur = 0;
+  pos = 0;
+}
+
+void Arena::release()
+{
+  for (size_t i = 0; i < blocks.size(); i++)
+    pool_free(blocks[i].data);
+  blocks.clear();
+  cur = 0;
+  pos = 0;
+}
+
+size_t Arena::size() const
+{
+  size_t result = 0;
+  for (size_t i = 0; i < blocks.size(); i++)
+    result += blocks[i].size;
+  return result;
+}
+
+size_t Arena::used() const
+{
+  size_t result = pos;
+  for (size_t i = 0; i < cur && i < blocks.size(); i++)
+    result += blocks[i].size;
+  return result;
+}
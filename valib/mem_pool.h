@@ -0,0 +1,155 @@
+/**************************************************************************//**
+  \file mem_pool.h
+  \brief Aligned memory allocation with recycling of freed blocks
+******************************************************************************/
+
+#ifndef VALIB_MEM_POOL_H
+#define VALIB_MEM_POOL_H
+
+#include <vector>
+#include "defs.h"
+
+/**************************************************************************//**
+  \defgroup mem_pool Buffer memory pool
+
+  Buffers (AutoBuf, SampleBuf) get their memory from the pool. All blocks are
+  aligned at pool_align bytes, so SIMD code may use aligned loads at the
+  beginning of a buffer.
+
+  Block sizes are rounded up to a power of 2 (size classes from pool_align
+  to pool_max_block bytes). Freed blocks of these sizes are kept at the pool
+  and reused by the next allocation of the same class, so filter reopens and
+  chain rebuilds do not go to the heap each time. The pool keeps at most
+  pool_max_cache bytes, other blocks are freed. Larger blocks are never
+  cached.
+
+  All functions are thread-safe. Blocks may be freed by any thread.
+
+  \fn void *pool_alloc(size_t size, size_t *allocated = 0)
+    \param size      Number of bytes required.
+    \param allocated Receives the actual size of the block (may be larger
+                     than requested).
+
+    Allocate an aligned block. Can throw std::bad_alloc.
+
+  \fn void pool_free(void *ptr)
+    Free the block allocated with pool_alloc(). Null pointer is ignored.
+    Does not throw.
+
+  \fn size_t pool_cache_size()
+    Number of bytes kept at the pool for reuse.
+
+  \fn void pool_release()
+    Free all blocks kept at the pool.
+
+  \fn PoolStat pool_stat()
+    Allocation counters since the start of the program. Allocations made
+    during the static initialization or destruction are not counted.
+******************************************************************************/
+
+static const size_t pool_align = 64;
+static const size_t pool_max_block = 4 * 1024 * 1024;
+static const size_t pool_max_cache = 16 * 1024 * 1024;
+
+void *pool_alloc(size_t size, size_t *allocated = 0);
+void  pool_free(void *ptr) throw();
+
+size_t pool_cache_size();
+void   pool_release();
+
+struct PoolStat
+{
+  uint64_t allocs;      ///< Number of pool_alloc() calls
+  uint64_t bytes;       ///< Size of the blocks allocated
+  uint64_t heap_allocs; ///< Number of blocks taken from the heap (not reused)
+  uint64_t heap_bytes;  ///< Size of the blocks taken from the heap
+};
+
+PoolStat pool_stat();
+
+/**************************************************************************//**
+  \class Arena
+  \brief Stack-like allocator for the buffers with a common lifetime
+
+  Arena takes large blocks from the pool and cuts them into aligned pieces
+  (pool_align bytes). Pieces are never freed one by one. Instead, the arena
+  is rewound to a mark taken earlier, and all pieces allocated after the mark
+  are reused by the following allocations. Blocks are kept until release()
+  or destruction, so rewinding and allocating again does not touch the heap
+  unless the arena needs to grow.
+
+  FilterGraph owns an arena and gives it to the filters it opens (see
+  Filter::set_arena()). Filters of the chain are opened from the start to the
+  end and closed in the reverse order, so the graph just rewinds the arena
+  to the mark of the first removed node when it truncates the chain.
+
+  Arena is not thread-safe.
+
+  \fn Arena::Arena(size_t block_size)
+    \param block_size Minimal size of a block taken from the pool.
+
+  \fn void *Arena::alloc(size_t size)
+    Allocate an aligned piece of memory. Can throw std::bad_alloc.
+
+  \fn Arena::Mark Arena::mark() const
+    Returns the current position of the arena.
+
+  \fn void Arena::rewind(Mark mark)
+    Free all pieces allocated after the mark.
+
+  \fn void Arena::reset()
+    Free all pieces. Blocks are kept.
+
+  \fn void Arena::release()
+    Free all pieces and return the blocks to the pool.
+
+  \fn size_t Arena::size() const
+    Total size of the blocks of the arena.
+
+  \fn size_t Arena::used() const
+    Number of bytes used (including the unused tails of skipped blocks).
+******************************************************************************/
+
+static const size_t arena_block_size = 256 * 1024;
+
+class Arena
+{
+public:
+  struct Mark
+  {
+    size_t block;
+    size_t pos;
+  };
+
+  Arena(size_t block_size = arena_block_size);
+  ~Arena();
+
+  void *alloc(size_t size);
+
+  Mark mark() const;
+  void rewind(Mark mark);
+  void reset();
+  void release();
+
+  size_t size() const;
+  size_t used() const;
+
+protected:
+  struct Block
+  {
+    char  *data;
+    size_t size;
+  };
+
+  std::vector<Block> blocks;
+  size_t block_size;
+  size_t cur;   ///< Current block
+  size_t pos;   ///< Position at the current block
+
+private:
+  // Non-copyable
+  Arena(const Arena &);
+  Arena &operator =(const Arena &);
+};
+
+#endif
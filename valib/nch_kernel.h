@@ -0,0 +1,197 @@
+/**************************************************************************//**
+  \file nch_kernel.h
+  \brief Processing kernels specialized for the number of channels
+******************************************************************************/
+
+#ifndef VALIB_NCH_KERNEL_H
+#define VALIB_NCH_KERNEL_H
+
+#include <math.h>
+#include "spk.h"
+
+/**************************************************************************//**
+  \defgroup nch_kernel Channel count specialization
+
+  Filters loop over channels with the number of channels known at runtime
+  only, so the compiler cannot unroll the channel loop or keep the channel
+  pointers in registers. A kernel is a class template parameterized with the
+  number of channels, with a static process() function:
+
+  \code
+  template <int nch> struct GainKernel
+  {
+    static void process(samples_t samples, size_t size, sample_t gain)
+    {
+      for (int ch = 0; ch < nch; ch++)
+        ...
+    }
+  };
+  \endcode
+
+  nch_kernel() instantiates the kernel for 1..NCHANNELS channels and returns
+  the function for the given number of channels. A filter selects the
+  functions it needs once at init() and calls them through pointers at
+  processing time.
+
+  Kernels are written in terms of sample_t, so they are instantiated for the
+  sample type of the build (float or double). Kernels below keep the order
+  of operations of the generic functions of spk.h, so results are bit-exact.
+
+  \fn template <template <int> class Kernel, class Func> Func nch_kernel(int nch)
+    \param nch Number of channels
+
+    Returns Kernel<nch>::process, or null when nch is out of range. Func is
+    the function pointer type of the kernel, for example:
+
+    \code
+    gain_kernel_t gain = nch_kernel<GainKernel, gain_kernel_t>(spk.nch());
+    \endcode
+******************************************************************************/
+
+// nch_kernel() must be updated when NCHANNELS changes
+typedef char nch_kernel_nchannels_check[NCHANNELS == 8? 1: -1];
+
+template <template <int> class Kernel, class Func>
+Func nch_kernel(int nch)
+{
+  switch (nch)
+  {
+    case 1: return &Kernel<1>::process;
+    case 2: return &Kernel<2>::process;
+    case 3: return &Kernel<3>::process;
+    case 4: return &Kernel<4>::process;
+    case 5: return &Kernel<5>::process;
+    case 6: return &Kernel<6>::process;
+    case 7: return &Kernel<7>::process;
+    case 8: return &Kernel<8>::process;
+  }
+  return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Kernels
+
+//! Multiply all channels by a gain (see gain_samples()).
+typedef void (*gain_kernel_t)(samples_t samples, size_t size, sample_t gain);
+
+template <int nch> struct GainKernel
+{
+  static void process(samples_t samples, size_t size, sample_t gain)
+  {
+    for (int ch = 0; ch < nch; ch++)
+    {
+      sample_t *s = samples[ch];
+      for (size_t i = 0; i < size; i++)
+        s[i] *= gain;
+    }
+  }
+};
+
+//! Multiply all channels by a crossfade of two gains:
+//! s[i] *= gain1 * w1[i] + gain2 * w2[i]. The factor is computed once per
+//! sample for all channels.
+typedef void (*window_kernel_t)(samples_t samples, size_t size,
+  sample_t gain1, const sample_t *w1, sample_t gain2, const sample_t *w2);
+
+template <int nch> struct WindowKernel
+{
+  static void process(samples_t samples, size_t size,
+    sample_t gain1, const sample_t *w1, sample_t gain2, const sample_t *w2)
+  {
+    sample_t *s[nch];
+    for (int ch = 0; ch < nch; ch++)
+      s[ch] = samples[ch];
+
+    for (size_t i = 0; i < size; i++)
+    {
+      const sample_t factor = gain1 * w1[i] + gain2 * w2[i];
+      for (int ch = 0; ch < nch; ch++)
+        s[ch][i] *= factor;
+    }
+  }
+};
+
+//! Clip all channels to [-level, +level].
+typedef void (*clip_kernel_t)(samples_t samples, size_t size, sample_t level);
+
+template <int nch> struct ClipKernel
+{
+  static void process(samples_t samples, size_t size, sample_t level)
+  {
+    for (int ch = 0; ch < nch; ch++)
+    {
+      sample_t *s = samples[ch];
+      for (size_t i = 0; i < size; i++)
+        if (s[i] > +level)
+          s[i] = +level;
+        else if (s[i] < -level)
+          s[i] = -level;
+    }
+  }
+};
+
+//! Peak level of each channel (see max_samples()).
+typedef void (*peak_kernel_t)(sample_t *max, samples_t samples, size_t size);
+
+template <int nch> struct PeakKernel
+{
+  static void process(sample_t *max, samples_t samples, size_t size)
+  {
+    for (int ch = 0; ch < nch; ch++)
+    {
+      const sample_t *s = samples[ch];
+      sample_t m = 0;
+      for (size_t i = 0; i < size; i++)
+        if (fabs(s[i]) > m)
+          m = fabs(s[i]);
+      max[ch] = m;
+    }
+  }
+};
+
+//! Peak level of each channel of interleaved frames (see max_frames()).
+typedef void (*peak_frames_kernel_t)(sample_t *max, const sample_t *frames, size_t nframes);
+
+template <int nch> struct PeakFramesKernel
+{
+  static void process(sample_t *max, const sample_t *frames, size_t nframes)
+  {
+    sample_t m[nch];
+    for (int ch = 0; ch < nch; ch++)
+      m[ch] = 0;
+
+    for (size_t i = 0; i < nframes; i++, frames += nch)
+      for (int ch = 0; ch < nch; ch++)
+        if (fabs(frames[ch]) > m[ch])
+          m[ch] = fabs(frames[ch]);
+
+    for (int ch = 0; ch < nch; ch++)
+      max[ch] = m[ch];
+  }
+};
+
+//! Sum of squares of each channel.
+typedef void (*sum_squares_kernel_t)(sample_t *sum, samples_t samples, size_t size);
+
+template <int nch> struct SumSquaresKernel
+{
+  static void process(sample_t *sum, samples_t samples, size_t size)
+  {
+    sample_t *s[nch];
+    sample_t acc[nch];
+    for (int ch = 0; ch < nch; ch++)
+    {
+      s[ch] = samples[ch];
+      acc[ch] = 0;
+    }
+
+    for (size_t i = 0; i < size; i++)
+      for (int ch = 0; ch < nch; ch++)
+        acc[ch] += s[ch][i] * s[ch][i];
+
+    for (int ch = 0; ch < nch; ch++)
+      sum[ch] = acc[ch];
+  }
+};
+
+#endif
@@ -135,6 +135,8 @@ StreamBuffer::StreamBuffer()
 
   in_sync = false;
   new_stream = false;
+  zero_copy = false;
+  frame_direct = false;
 
   frames = 0;
 }
@@ -157,6 +159,8 @@ StreamBuffer::StreamBuffer(FrameParser *parser_)
 
   in_sync = false;
   new_stream = false;
+  zero_copy = false;
+  frame_direct = false;
 
   frames = 0;
 
@@ -209,6 +213,7 @@ StreamBuffer::release_parser()
 
   frame = 0;
   frame_size = 0;
+  frame_direct = false;
 
   in_sync = false;
   new_stream = false;
@@ -289,6 +294,7 @@ StreamBuffer::resync()
 
   frame = 0;
   frame_size = 0;
+  frame_direct = false;
 
   debris = 0;
   debris_size = 0;
@@ -528,13 +534,54 @@ StreamBuffer::load(uint8_t **data, uint8_t *end)
 
   if (frame_size || debris_size)
   {
-    DROP(debris_size + frame_size);
+    // Direct frame is not buffered (and there's no debris in this case)
+    if (frame_direct)
+      frame_direct = false;
+    else
+      DROP(debris_size + frame_size);
     debris_size = 0;
     frame_size = 0;
   }
 
   new_stream = false;
 
+  /////////////////////////////////////////////////////////////////////////////
+  // Zero-copy load
+  // When nothing is buffered and the input contains the whole frame, we can
+  // use the frame directly from the input buffer.
+
+  if (zero_copy && !sync_data)
+  {
+    size_t data_size = end - *data;
+    size_t load_size = const_frame_size;
+    if (!load_size && data_size >= header_size)
+    {
+      FrameInfo temp_finfo;
+      if (!parser->parse_header(*data, &temp_finfo))
+      {
+        resync();
+        return sync(data, end);
+      }
+      load_size = temp_finfo.frame_size;
+    }
+
+    if (load_size && data_size >= load_size)
+    {
+      if (!parser->next_frame(*data, load_size))
+      {
+        resync();
+        return sync(data, end);
+      }
+      finfo = parser->frame_info();
+      frame = *data;
+      frame_size = load_size;
+      frame_direct = true;
+      *data += load_size;
+      frames++;
+      return true;
+    }
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // Const frame size
 
@@ -630,6 +677,13 @@ StreamBuffer::load_frame(uint8_t **data, uint8_t *end)
 bool
 StreamBuffer::flush()
 {
+  if (frame_direct)
+  {
+    frame = 0;
+    frame_size = 0;
+    frame_direct = false;
+  }
+
   if (!sync_data)
     return false;
 
@@ -665,6 +665,21 @@ protected:
   \fn void StreamBuffer::release_parser()
     Forgets the parser set with set_parser().
 
+  \fn void StreamBuffer::set_zero_copy(bool zero_copy)
+    \param zero_copy Enable zero-copy frame loading
+
+    By default, frames are copied into the internal buffer. In zero-copy mode,
+    when the input buffer contains the whole frame (and nothing is buffered
+    internally), get_frame() points directly into the input buffer, so no copy
+    is done. Frames split between input buffers and data buffered during
+    synchronization are still copied.
+
+    The caller must keep the input buffer valid (and unchanged, except for
+    inplace frame processing) until the next load() call.
+
+  \fn bool StreamBuffer::get_zero_copy() const
+    Returns true when zero-copy mode is enabled.
+
   \name Processing
 
   \fn void StreamBuffer::reset()
@@ -882,6 +897,8 @@ protected:
 
   bool in_sync;                  //!< we're in sync with the stream
   bool new_stream;               //!< frame loaded belongs to a new stream
+  bool zero_copy;                //!< load frames without copy when possible
+  bool frame_direct;             //!< frame points into the input buffer
   int  frames;                   //!< number of frames loaded
 
   inline bool load_buffer(uint8_t **data, uint8_t *end, size_t required_size);
@@ -902,6 +919,9 @@ public:
   const FrameParser *get_parser() const { return parser; }
   void release_parser();
 
+  void set_zero_copy(bool zero_copy_) { zero_copy = zero_copy_; }
+  bool get_zero_copy() const { return zero_copy; }
+
   /////////////////////////////////////////////////////////
   // Processing
 
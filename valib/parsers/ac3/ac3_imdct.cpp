@@ -1,4 +1,10 @@
 #include "ac3_imdct.h"
+#include <string.h>
+#include "../../cpu.h"
+
+#ifdef VALIB_SSE2
+#include <emmintrin.h>
+#endif
 
 const sample_t imdct_window[] = 
 {
@@ -56,6 +62,9 @@ IMDCT::IMDCT()
   buf64_1 = buf128;
   buf64_2 = buf128 + 64;
 
+  memset(pad_data, 0, sizeof(pad_data));
+  memset(pad_delay, 0, sizeof(pad_delay));
+
   for (i = 0; i < 3; i++)
     roots16[i] = cos ((M_PI / 8) * (i + 1));
 
@@ -107,8 +116,8 @@ IMDCT::IMDCT()
 
 }
 
-void 
-IMDCT::ifft16(complex_t * buf)
+template <class C> void
+IMDCT::ifft16(C * buf)
 {
   ifft8 (buf);
   ifft4 (buf + 8);
@@ -116,8 +125,8 @@ IMDCT::ifft16(complex_t * buf)
   ifft_pass (buf, roots16 - 4, 4);
 }
 
-void 
-IMDCT::ifft32(complex_t *buf)
+template <class C> void
+IMDCT::ifft32(C *buf)
 {
   ifft16 (buf);
   ifft8 (buf + 16);
@@ -125,8 +134,8 @@ IMDCT::ifft32(complex_t *buf)
   ifft_pass (buf, roots32 - 8, 8);
 }
 
-void 
-IMDCT::ifft64(complex_t *buf)
+template <class C> void
+IMDCT::ifft64(C *buf)
 {
   ifft32 (buf);
   ifft16 (buf + 32);
@@ -134,8 +143,8 @@ IMDCT::ifft64(complex_t *buf)
   ifft_pass (buf, roots64 - 16, 16);
 }
 
-void 
-IMDCT::ifft128(complex_t *buf)
+template <class C> void
+IMDCT::ifft128(C *buf)
 {
   ifft32 (buf);
   ifft16 (buf + 32);
@@ -258,3 +267,151 @@ IMDCT::imdct_256(sample_t *data, sample_t *delay)
     delay[126-2*i] = d_i;
   }
 }
+
+///////////////////////////////////////////////////////////////////////////////
+// Batched transform
+
+#ifdef VALIB_SSE2
+
+// Vector of samples of several channels, one channel per lane.
+// Supports operations used by IFFT butterflies.
+
+#ifdef FLOAT_SAMPLE
+struct vsample_t
+{
+  enum { lanes = 4 };
+  __m128 v;
+
+  vsample_t() {}
+  vsample_t(__m128 v_): v(v_) {}
+  vsample_t(sample_t s): v(_mm_set1_ps(s)) {}
+
+  static vsample_t gather(sample_t **p, int i)
+  { return _mm_set_ps(p[3][i], p[2][i], p[1][i], p[0][i]); }
+
+  void scatter(sample_t **p, int i) const
+  {
+    float tmp[4];
+    _mm_storeu_ps(tmp, v);
+    p[0][i] = tmp[0]; p[1][i] = tmp[1]; p[2][i] = tmp[2]; p[3][i] = tmp[3];
+  }
+};
+
+inline vsample_t operator +(vsample_t a, vsample_t b) { return _mm_add_ps(a.v, b.v); }
+inline vsample_t operator -(vsample_t a, vsample_t b) { return _mm_sub_ps(a.v, b.v); }
+inline vsample_t operator *(vsample_t a, vsample_t b) { return _mm_mul_ps(a.v, b.v); }
+#else
+struct vsample_t
+{
+  enum { lanes = 2 };
+  __m128d v;
+
+  vsample_t() {}
+  vsample_t(__m128d v_): v(v_) {}
+  vsample_t(sample_t s): v(_mm_set1_pd(s)) {}
+
+  static vsample_t gather(sample_t **p, int i)
+  { return _mm_set_pd(p[1][i], p[0][i]); }
+
+  void scatter(sample_t **p, int i) const
+  {
+    _mm_storel_pd(p[0] + i, v);
+    _mm_storeh_pd(p[1] + i, v);
+  }
+};
+
+inline vsample_t operator +(vsample_t a, vsample_t b) { return _mm_add_pd(a.v, b.v); }
+inline vsample_t operator -(vsample_t a, vsample_t b) { return _mm_sub_pd(a.v, b.v); }
+inline vsample_t operator *(vsample_t a, vsample_t b) { return _mm_mul_pd(a.v, b.v); }
+#endif
+
+inline vsample_t &operator +=(vsample_t &a, vsample_t b) { return a = a + b; }
+inline vsample_t operator *(vsample_t a, sample_t b) { return a * vsample_t(b); }
+inline vsample_t operator *(sample_t a, vsample_t b) { return vsample_t(a) * b; }
+
+typedef complex_tpl<vsample_t> vcomplex_t;
+
+// Same as imdct_512() but transforms vsample_t::lanes channels at once
+void
+IMDCT::imdct_512_sse2(sample_t **data, sample_t **delay)
+{
+  int i, k;
+  sample_t t_r, t_i, w_1, w_2;
+  vsample_t a_r, a_i, b_r, b_i, dl;
+  const sample_t *window = imdct_window;
+  vcomplex_t vbuf[128];
+
+  for (i = 0; i < 128; i++) 
+  {
+    k = fftorder[i];
+    t_r = pre1[i].real;
+    t_i = pre1[i].imag;
+
+    vsample_t x1 = vsample_t::gather(data, 255-k);
+    vsample_t x2 = vsample_t::gather(data, k);
+    vbuf[i].real = t_i * x1 + t_r * x2;
+    vbuf[i].imag = t_r * x1 - t_i * x2;
+  }
+
+  ifft128 (vbuf);
+
+  for (i = 0; i < 64; i++) 
+  {
+    t_r = post1[i].real;
+    t_i = post1[i].imag;
+
+    a_r = t_r * vbuf[i].real     + t_i * vbuf[i].imag;
+    a_i = t_i * vbuf[i].real     - t_r * vbuf[i].imag;
+    b_r = t_i * vbuf[127-i].real + t_r * vbuf[127-i].imag;
+    b_i = t_r * vbuf[127-i].real - t_i * vbuf[127-i].imag;
+
+    w_1 = window[2*i];
+    w_2 = window[255-2*i];
+    dl = vsample_t::gather(delay, 2*i);
+    (dl * w_2 - a_r * w_1).scatter(data, 2*i);
+    (dl * w_1 + a_r * w_2).scatter(data, 255-2*i);
+    a_i.scatter(delay, 2*i);
+
+    w_1 = window[2*i+1];
+    w_2 = window[254-2*i];
+    dl = vsample_t::gather(delay, 2*i+1);
+    (dl * w_2 + b_r * w_1).scatter(data, 2*i+1);
+    (dl * w_1 - b_r * w_2).scatter(data, 254-2*i);
+    b_i.scatter(delay, 2*i+1);
+  }
+}
+
+#endif
+
+void
+IMDCT::imdct_512(sample_t * const *data, sample_t * const *delay, int nch)
+{
+#ifdef VALIB_SSE2
+  if (cpu_features() & cpu_sse2)
+  {
+    const int lanes = vsample_t::lanes;
+    for (int ch = 0; ch < nch; ch += lanes)
+    {
+      // Pad the last group with a dummy channel
+      sample_t *d[lanes], *dl[lanes];
+      for (int lane = 0; lane < lanes; lane++)
+        if (ch + lane < nch)
+        {
+          d[lane] = data[ch + lane];
+          dl[lane] = delay[ch + lane];
+        }
+        else
+        {
+          d[lane] = pad_data;
+          dl[lane] = pad_delay;
+        }
+
+      imdct_512_sse2(d, dl);
+    }
+    return;
+  }
+#endif
+
+  for (int ch = 0; ch < nch; ch++)
+    imdct_512(data[ch], delay[ch]);
+}
@@ -5,10 +5,29 @@
 #include <math.h>
 
 
-typedef struct complex_s {
-  sample_t real;
-  sample_t imag;
-} complex_t;
+// Complex value. IFFT code is shared between scalar and SIMD versions, so
+// complex type is a template. Temp is the type of intermediate values in
+// butterflies (scalar version uses double).
+template <class T, class Temp = T>
+struct complex_tpl
+{
+  typedef Temp temp_t;
+  T real;
+  T imag;
+};
+
+typedef complex_tpl<sample_t, double> complex_t;
+
+///////////////////////////////////////////////////////////////////////////////
+// IMDCT
+//
+// imdct_512(data, delay, nch)
+//   Batched long block transform of nch channels. With SSE2 several channels
+//   are transformed at once (2 channels for double samples, 4 for float), one
+//   channel per vector lane. The result is identical to the single-channel
+//   version with double samples. With float samples (FLOAT_SAMPLE) the
+//   difference is within 1e-6 of the output level because intermediate
+//   values are not promoted to double.
 
 class IMDCT
 {
@@ -29,15 +48,21 @@ protected:
   complex_t *buf64_1;
   complex_t *buf64_2;
 
+  // Lane padding for the batched transform
+  sample_t pad_data[256];
+  sample_t pad_delay[256];
+
   // IFFT functions
-  inline void ifft_pass(complex_t *buf, sample_t *weight, int n);
-  inline void ifft2(complex_t *buf);
-  inline void ifft4(complex_t *buf);
-  inline void ifft8(complex_t *buf);
-  void ifft16 (complex_t *buf);
-  void ifft32 (complex_t *buf);
-  void ifft64 (complex_t *buf);
-  void ifft128(complex_t *buf);
+  template <class C> inline void ifft_pass(C *buf, sample_t *weight, int n);
+  template <class C> inline void ifft2(C *buf);
+  template <class C> inline void ifft4(C *buf);
+  template <class C> inline void ifft8(C *buf);
+  template <class C> void ifft16 (C *buf);
+  template <class C> void ifft32 (C *buf);
+  template <class C> void ifft64 (C *buf);
+  template <class C> void ifft128(C *buf);
+
+  void imdct_512_sse2(sample_t **data, sample_t **delay);
 
   complex_t buf[128];
 
@@ -46,6 +71,8 @@ public:
 
   void imdct_512(sample_t *data, sample_t *delay);
   void imdct_256(sample_t *data, sample_t *delay);
+
+  void imdct_512(sample_t * const *data, sample_t * const *delay, int nch);
 };
 
 // the basic split-radix ifft butterfly
@@ -104,10 +131,10 @@ public:
   a1.imag += tmp4;				\
 } while (0)
 
-inline void 
-IMDCT::ifft2(complex_t *buf)
+template <class C> inline void
+IMDCT::ifft2(C *buf)
 {
-  double r, i;
+  typename C::temp_t r, i;
 
   r = buf[0].real;
   i = buf[0].imag;
@@ -117,10 +144,10 @@ IMDCT::ifft2(complex_t *buf)
   buf[1].imag = i - buf[1].imag;
 }
 
-inline void 
-IMDCT::ifft4(complex_t *buf)
+template <class C> inline void
+IMDCT::ifft4(C *buf)
 {
-  double tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8;
+  typename C::temp_t tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8;
 
   tmp1 = buf[0].real + buf[1].real;
   tmp2 = buf[3].real + buf[2].real;
@@ -141,10 +168,10 @@ IMDCT::ifft4(complex_t *buf)
   buf[3].imag = tmp6 - tmp8;
 }
 
-inline void 
-IMDCT::ifft8(complex_t *buf)
+template <class C> inline void
+IMDCT::ifft8(C *buf)
 {
-  double tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8;
+  typename C::temp_t tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8;
   
   ifft4 (buf);
   ifft2 (buf + 4);
@@ -153,13 +180,13 @@ IMDCT::ifft8(complex_t *buf)
   BUTTERFLY_HALF (buf[1], buf[3], buf[5], buf[7], roots16[1]);
 }
 
-inline void 
-IMDCT::ifft_pass(complex_t *buf, sample_t *weight, int n)
+template <class C> inline void
+IMDCT::ifft_pass(C *buf, sample_t *weight, int n)
 {
-  complex_t *buf1;
-  complex_t *buf2;
-  complex_t *buf3;
-  double tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8;
+  C *buf1;
+  C *buf2;
+  C *buf3;
+  typename C::temp_t tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8;
   int i;
   
   buf++;
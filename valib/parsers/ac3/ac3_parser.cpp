@@ -161,9 +161,13 @@ AC3Parser::parse_frame()
     return false;
 
   while (block < AC3_NBLOCKS)
-    if (!decode_block())
+    if (!unpack_block())
       return false;
 
+  if (do_imdct)
+    for (int b = 0; b < AC3_NBLOCKS; b++)
+      transform_block(b);
+
   return true;
 }
 
@@ -346,7 +350,18 @@ AC3Parser::parse_header()
 bool 
 AC3Parser::decode_block()
 {
-  samples_t d = delay;
+  int b = block;
+  if (!unpack_block())
+    return false;
+
+  if (do_imdct)
+    transform_block(b);
+  return true;
+}
+
+bool
+AC3Parser::unpack_block()
+{
   samples_t s = samples;
   s += (block * AC3_BLOCK_SAMPLES);
 
@@ -357,21 +372,42 @@ AC3Parser::decode_block()
   }
   parse_coeff(s);
 
-  if (do_imdct)
-  {
-    int nfchans = out_spk.lfe()? out_spk.nch() - 1: out_spk.nch();
-    for (int ch = 0; ch < nfchans; ch++)
-      if (blksw[ch])
-        imdct.imdct_256(s[ch], delay[ch]);
-      else
-        imdct.imdct_512(s[ch], delay[ch]);
+  memcpy(block_blksw[block], blksw, sizeof(blksw));
+  block++;
+  return true;
+}
+
+void
+AC3Parser::transform_block(int b)
+{
+  samples_t d = delay;
+  samples_t s = samples;
+  s += (b * AC3_BLOCK_SAMPLES);
+
+  // Long blocks of all channels are transformed in one batch
+  sample_t *long_data[NCHANNELS];
+  sample_t *long_delay[NCHANNELS];
+  int nlong = 0;
 
-    if (out_spk.lfe())
-      imdct.imdct_512(s[nfchans], d[nfchans]);
+  int nfchans = out_spk.lfe()? out_spk.nch() - 1: out_spk.nch();
+  for (int ch = 0; ch < nfchans; ch++)
+    if (block_blksw[b][ch])
+      imdct.imdct_256(s[ch], d[ch]);
+    else
+    {
+      long_data[nlong] = s[ch];
+      long_delay[nlong] = d[ch];
+      nlong++;
+    }
+
+  if (out_spk.lfe())
+  {
+    long_data[nlong] = s[nfchans];
+    long_delay[nlong] = d[nfchans];
+    nlong++;
   }
 
-  block++;
-  return true;
+  imdct.imdct_512(long_data, long_delay, nlong);
 }
 
 bool
@@ -9,7 +9,13 @@
 #include "ac3_imdct.h"
 #include "ac3_header.h"
 
-// todo: decode_block() for per-block decode
+// Frame decoding is done in 2 passes. First, mantissas of all blocks are
+// unpacked into the coefficient matrix (samples buffer) with unpack_block().
+// Then transform_block() runs IMDCT and window/overlap for each block, all
+// long-block channels of a block in one batch. This way bitstream parsing
+// tables and IMDCT tables stay in cache during each pass.
+//
+// decode_block() unpacks and transforms one block (for per-block decode).
 
 class AC3Info
 {
@@ -196,10 +202,13 @@ public:
 
 
   int block;
+  bool block_blksw[AC3_NBLOCKS][5]; // block switch flags of unpacked blocks
 
   bool parse_frame();
   bool crc_check();
   bool decode_block();
+  bool unpack_block();
+  void transform_block(int b);
   bool parse_header();
   bool parse_block();
   bool parse_exponents(int8_t *exps, int8_t absexp, int expstr, int nexpgrps);
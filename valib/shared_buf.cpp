@@ -0,0 +1,62 @@
+#include <new>
+#include "shared_buf.h"
+#include "thread.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Block header is placed at the beginning of the pool block, data follows
+// at pool_align offset, so it is aligned too.
+
+struct SharedBuf::Block
+{
+  AtomicInt refs;
+  size_t size;
+
+  Block(size_t size_): refs(1), size(size_)
+  {}
+};
+
+void
+SharedBuf::allocate(size_t size)
+{
+  release();
+  if (size > size_t(-1) - pool_align)
+    throw std::bad_alloc();
+
+  assert(sizeof(Block) <= pool_align);
+  void *ptr = pool_alloc(size + pool_align);
+  block = new (ptr) Block(size);
+}
+
+size_t
+SharedBuf::size() const
+{
+  return block? block->size: 0;
+}
+
+bool
+SharedBuf::is_shared() const
+{
+  return block && block->refs.get() > 1;
+}
+
+long
+SharedBuf::refs() const
+{
+  return block? block->refs.get(): 0;
+}
+
+void
+SharedBuf::add_ref() const
+{
+  block->refs.increment();
+}
+
+void
+SharedBuf::remove_ref()
+{
+  if (block->refs.decrement() == 0)
+  {
+    block->~Block();
+    pool_free(block);
+  }
+}
@@ -0,0 +1,129 @@
+/**************************************************************************//**
+  \file shared_buf.h
+  \brief SharedBuf: reference-counted data buffer
+******************************************************************************/
+
+#ifndef VALIB_SHARED_BUF_H
+#define VALIB_SHARED_BUF_H
+
+#include "defs.h"
+#include "mem_pool.h"
+
+/**************************************************************************//**
+  \class SharedBuf
+  \brief Reference to a reference-counted memory block
+
+  Several SharedBuf objects may refer to the same block. The block is freed
+  when the last reference is released. So a holder of a reference may keep
+  the data alive as long as required without copying it.
+
+  Memory is taken from the buffer pool (see pool_alloc()) and is aligned at
+  pool_align bytes. Reference counter is updated atomically, so references
+  to the same block may be held and released by different threads. The data
+  itself is not protected: shared data should not be changed (see
+  Chunk::make_writable()).
+
+  Null reference (with no block) costs nothing to copy and release.
+
+  \fn SharedBuf::SharedBuf()
+    Constructs a null reference.
+    Does not throw.
+
+  \fn SharedBuf::SharedBuf(size_t size)
+    \param size Size of the block in bytes
+
+    Allocates a new block. Can throw std::bad_alloc.
+
+  \fn SharedBuf::SharedBuf(const SharedBuf &other)
+    Refers to the block of the other reference.
+    Does not throw.
+
+  \fn void SharedBuf::allocate(size_t size)
+    \param size Size of the block in bytes
+
+    Releases the current block and allocates a new one (not shared).
+    Can throw std::bad_alloc, the reference becomes null in this case.
+
+  \fn void SharedBuf::release()
+    Releases the block. The reference becomes null.
+    Does not throw.
+
+  \fn uint8_t *SharedBuf::begin() const
+    Returns the pointer to the data or null for the null reference.
+
+  \fn size_t SharedBuf::size() const
+    Returns the size of the block (zero for the null reference).
+
+  \fn bool SharedBuf::is_null() const
+    Returns true when the reference does not refer to a block.
+
+  \fn bool SharedBuf::is_shared() const
+    Returns true when other references to the block exist.
+
+  \fn long SharedBuf::refs() const
+    Returns the number of references to the block (zero for the null
+    reference).
+
+  \fn bool SharedBuf::contains(const void *ptr) const
+    Returns true when the pointer points into the block (the end of the block
+    included).
+******************************************************************************/
+
+class SharedBuf
+{
+public:
+  SharedBuf(): block(0)
+  {}
+
+  explicit SharedBuf(size_t size): block(0)
+  { allocate(size); }
+
+  SharedBuf(const SharedBuf &other): block(other.block)
+  { if (block) add_ref(); }
+
+  ~SharedBuf()
+  { if (block) remove_ref(); }
+
+  SharedBuf &operator =(const SharedBuf &other)
+  {
+    if (block != other.block)
+    {
+      if (other.block) other.add_ref();
+      if (block) remove_ref();
+      block = other.block;
+    }
+    return *this;
+  }
+
+  void allocate(size_t size);
+
+  inline void release()
+  {
+    if (block) remove_ref();
+    block = 0;
+  }
+
+  // Data is placed after the block header
+  inline uint8_t *begin() const
+  { return block? (uint8_t *)block + pool_align: 0; }
+
+  size_t size() const;
+
+  inline bool is_null() const
+  { return block == 0; }
+
+  bool is_shared() const;
+  long refs() const;
+
+  inline bool contains(const void *ptr) const
+  { return block && (const uint8_t *)ptr >= begin() && (const uint8_t *)ptr <= begin() + size(); }
+
+protected:
+  struct Block;
+  Block *block;
+
+  void add_ref() const;
+  void remove_ref();
+};
+
+#endif
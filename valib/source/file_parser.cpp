@@ -32,6 +32,7 @@ FileParser::FileParser()
 {
   has_probe = false;
   is_new_stream = false;
+  use_mmap = false;
 
   buf.allocate(buf_size);
   buf_pos = buf.begin();
@@ -62,10 +63,20 @@ FileParser::open(const string &new_filename, FrameParser *new_parser, size_t new
   if (!f.open(new_filename.c_str()))
     return false;
 
+  if (use_mmap && f.size() != f.bad_size && !f.is_large())
+    map.open(new_filename.c_str());
+
   stream.set_parser(new_parser);
+  stream.set_zero_copy(true);
   max_scan = new_max_scan;
   filename = new_filename;
 
+  if (map.is_open())
+  {
+    buf_pos = map;
+    buf_end = map + map.size();
+  }
+
   stream_reset();
   return true;
 }
@@ -87,8 +98,12 @@ void
 FileParser::close()
 {
   stream.release_parser();
+  map.close();
   f.close();
 
+  buf_pos = buf.begin();
+  buf_end = buf.begin();
+
   has_probe = false;
   is_new_stream = false;
 
@@ -118,7 +133,7 @@ FileParser::stats(vtime_t precision, unsigned min_measurements, unsigned max_mea
 {
   if (!f) return false;
 
-  fsize_t old_pos = f.pos();
+  fsize_t old_pos = get_pos();
 
   // Do not measure if we cannot load a frame.
   // (If file format is unknown measurments may take much of time)
@@ -247,6 +262,8 @@ FileParser::units_factor(units_t units) const
 FileParser::fsize_t
 FileParser::get_pos() const
 {
+  if (map.is_open())
+    return fsize_t(buf_pos - map);
   return f.is_open()? fsize_t(f.pos() - (buf_end - buf_pos)): 0;
 }
 
@@ -271,6 +288,15 @@ FileParser::get_size(units_t units) const
 int
 FileParser::seek(fsize_t pos)
 {
+  if (map.is_open())
+  {
+    if (pos < 0 || pos > fsize_t(map.size()))
+      return -1;
+    buf_pos = map + size_t(pos);
+    stream_reset();
+    return 0;
+  }
+
   int result = f.seek(pos);
   stream_reset();
   return result;
@@ -291,8 +317,12 @@ FileParser::seek(double pos, units_t units)
 void
 FileParser::stream_reset()
 {
-  buf_pos = buf.begin();
-  buf_end = buf.begin();
+  // The mapping is not a buffer, so there's nothing to drop
+  if (!map.is_open())
+  {
+    buf_pos = buf.begin();
+    buf_end = buf.begin();
+  }
   stream.reset();
   has_probe = false;
   is_new_stream = false;
@@ -303,7 +333,28 @@ FileParser::load_frame()
 {
   size_t scan_size = 0;
 
-  while (!f.eof() || buf_pos < buf_end)
+  if (map.is_open())
+  {
+    // The whole file is available at once. Pass it by buf_size pieces
+    // during synchronization to check max_scan limit.
+    while (buf_pos < buf_end)
+    {
+      uint8_t *end = buf_end;
+      if (max_scan && !stream.is_in_sync() && size_t(buf_end - buf_pos) > buf_size)
+        end = buf_pos + buf_size;
+
+      size_t data_size = end - buf_pos;
+
+      if (stream.load_frame(&buf_pos, end))
+        return true;
+
+      scan_size += data_size;
+      if (max_scan && scan_size > max_scan)
+        return false;
+    }
+  }
+
+  while (!map.is_open() && (!f.eof() || buf_pos < buf_end))
   {
     if (buf_pos >= buf_end)
     {
@@ -19,6 +19,10 @@
   Uses StreamBuffer to sychronize and read frames. Allows seeking and provides
   extended info about the file.
 
+  Frames are returned directly from the file buffer (or from the file mapping,
+  see set_mmap()) when possible, and are valid until the next get_chunk(),
+  probe(), seek() or close() call.
+
   This source has data-driven output format. I.e. it does not report the
   format immediately after file open. To actually detect the data format use
   probe().
@@ -133,6 +137,22 @@
   \fn void FileParser::close()
     Close the file.
 
+  \fn void FileParser::set_mmap(bool use_mmap)
+    \param use_mmap Memory-map files
+
+    Use memory-mapped input for files opened after this call. Frames are
+    returned directly from the mapping and copied only when the parser needs
+    it (during synchronization). When the file cannot be mapped (too large
+    for the address space, for instance), it is read as usual.
+
+    Both modes provide the same data and support all file operations.
+
+  \fn bool FileParser::get_mmap() const
+    Returns true when memory-mapped input is enabled.
+
+  \fn bool FileParser::is_mapped() const
+    Returns true when the file currently open is memory-mapped.
+
   \fn bool FileParser::probe()
     Tries to synchronize and determine the file format. It does it at the
     current position, so you can seek to a certain file position before probing.
@@ -248,7 +268,10 @@ protected:
   bool has_probe;            //!< probe() was done
   bool is_new_stream;        //!< new_stream flag
 
-  Rawdata buf;               //!< Data buffer
+  bool use_mmap;             //!< map files opened
+  MMapFile map;              //!< File mapping (when mapped)
+
+  Rawdata buf;               //!< Data buffer (when not mapped)
   uint8_t *buf_pos;          //!< Current buffer position pointer
   uint8_t *buf_end;          //!< End of buffer data pointer
 
@@ -276,11 +299,15 @@ public:
   bool open_probe(const string &filename, FrameParser *parser, size_t max_scan = 0);
   void close();
 
+  void set_mmap(bool use_mmap_) { use_mmap = use_mmap_; }
+  bool get_mmap() const { return use_mmap; }
+  bool is_mapped() const { return map.is_open(); }
+
   bool probe();
   bool stats(vtime_t precision = 0.5, unsigned min_measurements = 10, unsigned max_measurements = 100);
 
   bool is_open() const { return f != 0; }
-  bool eof() const { return f.eof() && (buf_pos >= buf_end) && !stream.has_frame(); }
+  bool eof() const { return (map.is_open() || f.eof()) && (buf_pos >= buf_end) && !stream.has_frame(); }
 
   const string get_filename() const { return filename; }
   const FrameParser *get_parser() const { return stream.get_parser(); }
@@ -32,11 +32,11 @@ protected:
   uint64_t  stream_len;
   uint64_t  stream_pos;
 
-  Generator::Generator():
+  Generator():
   stream_len(0), chunk_size(0)
   {}
 
-  Generator::Generator(Speakers spk_, uint64_t stream_len_, size_t chunk_size_):
+  Generator(Speakers spk_, uint64_t stream_len_, size_t chunk_size_):
   stream_len(0), chunk_size(0)
   { init(spk_, stream_len_, chunk_size_); }
 
@@ -88,6 +88,8 @@ int sample_size(int format)
     // Special formats
     case FORMAT_RAWDATA: return 0;
     case FORMAT_LINEAR:  return sizeof(sample_t);
+    case FORMAT_INTERLEAVED_FLOAT:  return sizeof(float);
+    case FORMAT_INTERLEAVED_DOUBLE: return sizeof(double);
 
     // PCM formats
     case FORMAT_PCM16_BE:
@@ -143,6 +145,8 @@ format_text(int format)
   {
     case FORMAT_RAWDATA:     return "Raw data";
     case FORMAT_LINEAR:      return "Linear PCM";
+    case FORMAT_INTERLEAVED_FLOAT:  return "Interleaved Linear PCM Float";
+    case FORMAT_INTERLEAVED_DOUBLE: return "Interleaved Linear PCM Double";
 
     case FORMAT_PCM16:       return "PCM16";
     case FORMAT_PCM24:       return "PCM24";
@@ -441,6 +445,17 @@ sample_t max_samples(sample_t max, const sample_t *s, size_t size)
   return max;
 }
 
+void max_frames(sample_t *max, const sample_t *frames, int nch, size_t nframes)
+{
+  for (int ch = 0; ch < nch; ch++)
+    max[ch] = 0;
+
+  for (size_t i = 0; i < nframes; i++, frames += nch)
+    for (int ch = 0; ch < nch; ch++)
+      if (fabs(frames[ch]) > max[ch])
+        max[ch] = fabs(frames[ch]);
+}
+
 sample_t peak_diff(const sample_t *s1, const sample_t *s2, size_t size)
 {
   sample_t diff = 0;
@@ -35,6 +35,20 @@
 
     FORMAT_LINEAR: most of internal processing is done with this format.
 
+    FORMAT_INTERLEAVED: interleaved linear format. The same samples as for
+    FORMAT_LINEAR (sample_t, standard channel order, level), but placed
+    frame by frame into one raw data buffer, like PCM formats. Chunk::size is
+    the size in bytes, chunks contain whole frames only. Some filters (Mixer, Levels) accept this format too.
+    Filters that do not accept it get the data converted by FilterChain (see
+    FilterChain::next_id()).
+
+    Interleaved format has float (FORMAT_INTERLEAVED_FLOAT) and double
+    (FORMAT_INTERLEAVED_DOUBLE) variants, both available in any build.
+    FORMAT_INTERLEAVED is the variant of sample_t precision. So a chain may
+    select the precision at open time: Converter makes the float variant from
+    FORMAT_LINEAR, and Mixer mixes it at float precision (twice as many
+    samples per SIMD register and half of the memory traffic of double).
+
     Formats are divided into several format classes: PCM formats, compressed 
     formats, SPDIF'able formats and container formats.
 
@@ -276,6 +290,16 @@ using std::string;
 #define FORMAT_MLP        23
 #define FORMAT_TRUEHD     24
 
+// interleaved linear
+#define FORMAT_INTERLEAVED_FLOAT  25
+#define FORMAT_INTERLEAVED_DOUBLE 26
+
+#ifdef FLOAT_SAMPLE
+#define FORMAT_INTERLEAVED FORMAT_INTERLEAVED_FLOAT
+#else
+#define FORMAT_INTERLEAVED FORMAT_INTERLEAVED_DOUBLE
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Format masks
 ///////////////////////////////////////////////////////////////////////////////
@@ -286,6 +310,9 @@ using std::string;
 // special-purpose format masks
 #define FORMAT_MASK_RAWDATA      FORMAT_MASK(FORMAT_RAWDATA)
 #define FORMAT_MASK_LINEAR       FORMAT_MASK(FORMAT_LINEAR)
+#define FORMAT_MASK_INTERLEAVED  FORMAT_MASK(FORMAT_INTERLEAVED)
+#define FORMAT_MASK_INTERLEAVED_FLOAT  FORMAT_MASK(FORMAT_INTERLEAVED_FLOAT)
+#define FORMAT_MASK_INTERLEAVED_DOUBLE FORMAT_MASK(FORMAT_INTERLEAVED_DOUBLE)
 
 // PCM low-endian format masks
 #define FORMAT_MASK_PCM16        FORMAT_MASK(FORMAT_PCM16)
@@ -335,6 +362,8 @@ using std::string;
 #define FORMAT_CLASS_CONTAINER   (FORMAT_MASK_PES | FORMAT_MASK_SPDIF)
 #define FORMAT_CLASS_SPDIFABLE   (FORMAT_MASK_MPA | FORMAT_MASK_AC3 | FORMAT_MASK_DTS)
 #define FORMAT_CLASS_COMPRESSED  (FORMAT_MASK_MPA | FORMAT_MASK_AC3 | FORMAT_MASK_DTS)
+#define FORMAT_CLASS_INTERLEAVED (FORMAT_MASK_INTERLEAVED_FLOAT | FORMAT_MASK_INTERLEAVED_DOUBLE)
+#define FORMAT_CLASS_LINEAR      (FORMAT_MASK_LINEAR | FORMAT_CLASS_INTERLEAVED)
 
 ///////////////////////////////////////////////////////////////////////////////
 // Channel numbers (that also define 'standard' channel order)
@@ -511,6 +540,7 @@ public:
 
   inline bool is_unknown() const;
   inline bool is_linear() const;
+  inline bool is_interleaved() const;
   inline bool is_rawdata() const;
 
   inline bool is_pcm() const;
@@ -611,6 +641,7 @@ void sum_samples(sample_t *dst, const sample_t *src, size_t size);
 void mul_samples(sample_t *dst, const sample_t *src, size_t size);
 
 sample_t max_samples(sample_t max, const sample_t *s, size_t size);
+void max_frames(sample_t *max, const sample_t *frames, int nch, size_t nframes);
 sample_t peak_diff(const sample_t *s1, const sample_t *s2, size_t size);
 sample_t rms_diff(const sample_t *s1, const sample_t *s2, size_t size);
 
@@ -648,6 +679,9 @@ inline bool Speakers::is_unknown() const
 inline bool Speakers::is_linear() const
 { return format == FORMAT_LINEAR; }
 
+inline bool Speakers::is_interleaved() const
+{ return (FORMAT_MASK(format) & FORMAT_CLASS_INTERLEAVED) != 0; }
+
 inline bool Speakers::is_rawdata() const
 { return format != FORMAT_LINEAR; }
 
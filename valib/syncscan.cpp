@@ -1,5 +1,11 @@
 #include <iostream>
+#include <string.h>
 #include "syncscan.h"
+#include "cpu.h"
+
+#ifdef VALIB_SSE2
+#include <emmintrin.h>
+#endif
 
 using namespace std;
 
@@ -421,6 +427,40 @@ SyncScan::build_booster(uint16_t word, int node, int depth)
   if (r != SyncTrie::node_deny) build_booster(word | (0x8000 >> depth), r, depth + 1);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Pre-filter is built from the booster: it holds byte values that may start
+// a 16bit word allowed by the booster (first byte), and values that may
+// follow any allowed first byte (second byte). When there're too many values,
+// comparison does not worth and the byte is not filtered.
+
+void
+SyncScan::build_filter()
+{
+  bool first[256], second[256];
+  memset(first, 0, sizeof(first));
+  memset(second, 0, sizeof(second));
+
+  for (int word = 0; word < 65536; word++)
+    if (booster[word >> 5] & (0x80000000 >> (word & 0x1f)))
+      first[word >> 8] = second[word & 0xff] = true;
+
+  const bool *values[2] = { first, second };
+  for (int i = 0; i < 2; i++)
+  {
+    filter_size[i] = 0;
+    for (int v = 0; v < 256; v++)
+      if (values[i][v])
+      {
+        if (filter_size[i] >= max_filter_size)
+        {
+          filter_size[i] = 0;
+          break;
+        }
+        filter[i][filter_size[i]++] = uint8_t(v);
+      }
+  }
+}
+
 void
 SyncScan::set_trie(const SyncTrie &gr)
 {
@@ -429,8 +469,58 @@ SyncScan::set_trie(const SyncTrie &gr)
   memset(booster, 0, sizeof(booster));
   if (!graph.is_empty())
     build_booster(0, 0, 0);
+  build_filter();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// SIMD pre-filter scan
+// Scan for a syncpoint starting at [pos, last). Returns true and sets pos to
+// the syncpoint found. Otherwise, returns false and sets pos to the position
+// to continue the scan from. Reads one byte after the last position.
+
+#ifdef VALIB_SSE2
+
+static inline __m128i match_sse2(__m128i data, const __m128i *values, int size)
+{
+  __m128i result = _mm_cmpeq_epi8(data, values[0]);
+  for (int i = 1; i < size; i++)
+    result = _mm_or_si128(result, _mm_cmpeq_epi8(data, values[i]));
+  return result;
+}
+
+bool
+SyncScan::scan_simd(const uint8_t *buf, size_t &pos, size_t last) const
+{
+  __m128i values[2][max_filter_size];
+  for (int i = 0; i < 2; i++)
+    for (int j = 0; j < filter_size[i]; j++)
+      values[i][j] = _mm_set1_epi8(char(filter[i][j]));
+
+  for (; pos + 16 <= last; pos += 16)
+  {
+    __m128i match = match_sse2(_mm_loadu_si128((const __m128i *)(buf + pos)), values[0], filter_size[0]);
+    if (filter_size[1])
+      match = _mm_and_si128(match,
+        match_sse2(_mm_loadu_si128((const __m128i *)(buf + pos + 1)), values[1], filter_size[1]));
+
+    int mask = _mm_movemask_epi8(match);
+    for (int i = 0; mask; i++, mask >>= 1)
+      if (mask & 1)
+      {
+        uint32_t word = (buf[pos + i] << 8) | buf[pos + i + 1];
+        if (booster[word >> 5] & (0x80000000 >> (word & 0x1f)))
+          if (graph.is_sync(buf + pos + i))
+          {
+            pos += i;
+            return true;
+          }
+      }
+  }
+  return false;
+}
+
+#endif
+
 SyncTrie
 SyncScan::get_trie() const
 { return SyncTrie(graph); }
@@ -455,11 +545,19 @@ SyncScan::scan_pos(const uint8_t *buf, size_t size, size_t &pos) const
 
   if (size - pos >= 4)
   {
-    uint32_t sync = (buf[pos] << 16) | (buf[pos+1] << 8) | buf[pos+2];
     size_t last = size;
     if (sync_size > 4)
       last = size - sync_size + 4;
 
+#ifdef VALIB_SSE2
+    // Syncpoint may start at [pos, last - 3)
+    if (filter_size[0] && (cpu_features() & cpu_sse2))
+      if (scan_simd(buf, pos, last - 3))
+        return true;
+#endif
+
+    uint32_t sync = (buf[pos] << 16) | (buf[pos+1] << 8) | buf[pos+2];
+
     for (size_t i = pos + 3; i < last; i++)
     {
       sync = (sync << 8) | buf[i];
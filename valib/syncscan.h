@@ -281,6 +281,10 @@ public:
     trie.sync_size() - 1 bytes may belong to a syncpoint, but we cannot check
     this because we need more data to continue scanning. Therefore, if you
     have more data to scan, you have to save these bytes.
+
+    When the syncpoint may start only with a few byte values, SIMD pre-filter
+    compares 16 bytes at a time with these values, so only candidate
+    positions are checked with the booster and the trie.
 ******************************************************************************/
 
 class SyncScan
@@ -290,9 +294,17 @@ protected:
   uint32_t booster[2048];
   void build_booster(uint16_t word, int node, int depth);
 
+  // SIMD pre-filter: values allowed for the first 2 bytes of a syncpoint.
+  // Zero filter size means that the byte is not filtered.
+  enum { max_filter_size = 8 };
+  uint8_t filter[2][max_filter_size];
+  int filter_size[2];
+  void build_filter();
+  bool scan_simd(const uint8_t *buf, size_t &pos, size_t last) const;
+
 public:
   SyncScan()
-  {}
+  { filter_size[0] = filter_size[1] = 0; }
 
   explicit SyncScan(const SyncTrie &t)
   { set_trie(t); }
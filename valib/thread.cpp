@@ -0,0 +1,332 @@
+#include "thread.h"
+
+#ifndef _WIN32
+#include <errno.h>
+#include <sys/time.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Win32 implementation
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef _WIN32
+
+///////////////////////////////////////////////////////////
+// Thread
+
+Thread::Thread()
+{
+  f_terminate = false;
+  f_threadId = 0;
+  f_thread = 0;
+  f_exists = false;
+  f_suspended = true;
+}
+
+Thread::~Thread()
+{
+  if (f_exists)
+    terminate(0);
+}
+
+DWORD WINAPI
+Thread::ThreadProc(LPVOID param)
+{
+  if (param)
+  {
+    Thread *thread = (Thread *)param;
+    DWORD exit_code = thread->process();
+    thread->f_exists = false;
+    return exit_code;
+  }
+  return 0;
+}
+
+bool
+Thread::create(bool suspended)
+{
+  if (f_thread)
+    terminate(0);
+
+  f_terminate = false;
+  f_threadId = 0;
+  f_exists = true;
+  f_suspended = suspended;
+  f_thread = CreateThread(0, 0, ThreadProc, this, suspended? CREATE_SUSPENDED :0, &f_threadId);
+  if (!f_thread)
+  {
+    f_exists = false;
+    f_suspended = true;
+  }
+  return f_thread != 0;
+}
+
+void
+Thread::suspend()
+{
+  if (f_exists && SuspendThread(f_thread) != -1)
+    f_suspended = true;
+}
+
+void
+Thread::resume()
+{
+  if (f_exists && ResumeThread(f_thread) != -1)
+    f_suspended = false;
+}
+
+void
+Thread::terminate(int timeout_ms, unsigned long exit_code)
+{
+  if (!f_thread) return;
+
+  // wait for thread to finish correctly
+  f_terminate = true;
+  if (f_suspended)
+    resume();
+  if (timeout_ms > 0)
+    WaitForSingleObject(f_thread, timeout_ms);
+
+  // terminate it if it was not finished
+  if (f_exists)
+    TerminateThread(f_thread, exit_code);
+
+  CloseHandle(f_thread);
+  f_thread = 0;
+  f_exists = false;
+  f_suspended = true;
+}
+
+///////////////////////////////////////////////////////////
+// CritSec
+
+CritSec::CritSec()
+{
+  InitializeCriticalSection(&crit_sec);
+  lock_count = 0;
+}
+
+CritSec::~CritSec()
+{
+  DeleteCriticalSection(&crit_sec);
+}
+
+///////////////////////////////////////////////////////////
+// Event
+
+Event::Event()
+{
+  event = CreateEvent(0, false, false, 0);
+}
+
+Event::~Event()
+{
+  CloseHandle(event);
+}
+
+void
+Event::set()
+{
+  SetEvent(event);
+}
+
+bool
+Event::wait(int timeout_ms)
+{
+  return WaitForSingleObject(event, timeout_ms < 0? INFINITE: timeout_ms) == WAIT_OBJECT_0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// POSIX implementation
+///////////////////////////////////////////////////////////////////////////////
+
+#else
+
+///////////////////////////////////////////////////////////
+// Thread
+// POSIX threads cannot be suspended and terminated
+// gracefully from the outside. Suspended start is made
+// with the gate event and exit wait with the finish
+// event.
+
+class Thread::Private
+{
+public:
+  Event gate;
+  Event finished;
+  unsigned long exit_code;
+};
+
+static unsigned long next_thread_id = 1;
+
+Thread::Thread()
+{
+  f_terminate = false;
+  f_threadId = 0;
+  f_exists = false;
+  f_suspended = true;
+  p = new Private();
+}
+
+Thread::~Thread()
+{
+  if (f_exists)
+    terminate(0);
+  delete p;
+}
+
+void *
+Thread::ThreadProc(void *param)
+{
+  Thread *thread = (Thread *)param;
+
+  // Suspended start
+  while (thread->f_suspended && !thread->f_terminate)
+    thread->p->gate.wait();
+
+  thread->p->exit_code = thread->process();
+
+  thread->f_exists = false;
+  thread->p->finished.set();
+  return 0;
+}
+
+bool
+Thread::create(bool suspended)
+{
+  if (f_threadId)
+    terminate(0);
+
+  f_terminate = false;
+  f_exists = true;
+  f_suspended = suspended;
+  p->exit_code = 0;
+  if (pthread_create(&f_thread, 0, ThreadProc, this) != 0)
+  {
+    f_exists = false;
+    f_suspended = true;
+    return false;
+  }
+  f_threadId = __sync_fetch_and_add(&next_thread_id, 1);
+  return true;
+}
+
+void
+Thread::suspend()
+{
+  // Cannot suspend a running thread
+}
+
+void
+Thread::resume()
+{
+  if (f_exists && f_suspended)
+  {
+    f_suspended = false;
+    p->gate.set();
+  }
+}
+
+void
+Thread::terminate(int timeout_ms, unsigned long exit_code)
+{
+  if (!f_threadId) return;
+
+  // wait for thread to finish correctly
+  f_terminate = true;
+  p->gate.set();
+  if (f_exists && timeout_ms > 0)
+    p->finished.wait(timeout_ms);
+
+  // kill it if it was not finished
+  if (f_exists)
+  {
+    pthread_cancel(f_thread);
+    pthread_detach(f_thread);
+    p->exit_code = exit_code;
+  }
+  else
+    pthread_join(f_thread, 0);
+
+  f_threadId = 0;
+  f_exists = false;
+  f_suspended = true;
+}
+
+///////////////////////////////////////////////////////////
+// CritSec
+
+CritSec::CritSec()
+{
+  pthread_mutexattr_t attr;
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&crit_sec, &attr);
+  pthread_mutexattr_destroy(&attr);
+  lock_count = 0;
+}
+
+CritSec::~CritSec()
+{
+  pthread_mutex_destroy(&crit_sec);
+}
+
+///////////////////////////////////////////////////////////
+// Event
+
+Event::Event(): signaled(false)
+{
+  pthread_mutex_init(&mutex, 0);
+  pthread_cond_init(&cond, 0);
+}
+
+Event::~Event()
+{
+  pthread_cond_destroy(&cond);
+  pthread_mutex_destroy(&mutex);
+}
+
+void
+Event::set()
+{
+  pthread_mutex_lock(&mutex);
+  signaled = true;
+  pthread_cond_signal(&cond);
+  pthread_mutex_unlock(&mutex);
+}
+
+bool
+Event::wait(int timeout_ms)
+{
+  pthread_mutex_lock(&mutex);
+  if (timeout_ms < 0)
+  {
+    while (!signaled)
+      pthread_cond_wait(&cond, &mutex);
+  }
+  else
+  {
+    timeval now;
+    gettimeofday(&now, 0);
+
+    timespec deadline;
+    deadline.tv_sec = now.tv_sec + timeout_ms / 1000;
+    deadline.tv_nsec = now.tv_usec * 1000 + (timeout_ms % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000)
+    {
+      deadline.tv_sec++;
+      deadline.tv_nsec -= 1000000000;
+    }
+
+    while (!signaled)
+      if (pthread_cond_timedwait(&cond, &mutex, &deadline) == ETIMEDOUT)
+        break;
+  }
+
+  bool result = signaled;
+  signaled = false;
+  pthread_mutex_unlock(&mutex);
+  return result;
+}
+
+#endif
@@ -0,0 +1,272 @@
+/**************************************************************************//**
+  \file thread.h
+  \brief Portable threading primitives
+
+  Win32 implementation uses native Win32 API, other platforms use POSIX
+  threads.
+******************************************************************************/
+
+#ifndef VALIB_THREAD_H
+#define VALIB_THREAD_H
+
+#include "defs.h"
+
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <pthread.h>
+#endif
+
+/**************************************************************************//**
+  \class Thread
+  \brief Abstract base for thread classes.
+
+  Override process() to do the job. process() should check terminating() flag
+  periodically and exit when it is set.
+
+  \fn bool Thread::create(bool suspended = true)
+    \param suspended Create the thread in suspended state.
+    \return Returns true on success and false otherwise.
+
+    Create a new thread. When the thread already exists it is terminated.
+
+    Suspended thread does not call process() until resume() is called.
+
+  \fn void Thread::suspend()
+    Suspend the thread.
+
+    POSIX threads cannot be suspended from the outside, so on non-Win32
+    platforms only a thread created in suspended state may be suspended until
+    the first resume() call. This call is ignored for a running thread.
+
+  \fn void Thread::resume()
+    Resume the suspended thread.
+
+  \fn void Thread::terminate(int timeout_ms = 1000, unsigned long exit_code = 0)
+    \param timeout_ms Time to wait for the thread to exit gracefully.
+    \param exit_code  Exit code for the thread killed.
+
+    Set the termination flag and wait for the thread to exit. Kill the thread
+    if it did not exit in time.
+
+  \fn unsigned long Thread::thread_id() const
+    Returns the thread's identifier.
+
+  \fn bool Thread::thread_exists() const
+    Returns true when the thread is running or suspended.
+
+  \fn bool Thread::terminating() const
+    Returns true when the thread is asked to exit.
+
+  \fn bool Thread::suspended() const
+    Returns true when the thread is suspended (or does not exist).
+
+******************************************************************************/
+
+class Thread
+{
+private:
+  // Disallow thread object copy
+  Thread(const Thread &);
+  Thread &operator=(const Thread &);
+
+#ifdef _WIN32
+  HANDLE f_thread;
+  DWORD  f_threadId;
+  static DWORD WINAPI ThreadProc(LPVOID param);
+#else
+  pthread_t f_thread;
+  unsigned long f_threadId;
+  static void *ThreadProc(void *param);
+  class Private;
+  Private *p;
+#endif
+
+  volatile bool f_exists;
+  volatile bool f_suspended;
+
+protected:
+  volatile bool f_terminate;
+  virtual unsigned long process() = 0;
+
+public:
+  Thread();
+  virtual ~Thread();
+
+  virtual bool create(bool suspended = true);
+  virtual void suspend();
+  virtual void resume();
+  virtual void terminate(int timeout_ms = 1000, unsigned long exit_code = 0);
+
+#ifdef _WIN32
+  HANDLE handle()               const { return f_thread; }
+#endif
+  unsigned long thread_id()     const { return f_threadId; }
+  bool          thread_exists() const { return f_exists; }
+  bool          terminating()   const { return f_terminate; }
+  bool          suspended()     const { return f_exists? f_suspended: true; }
+};
+
+/**************************************************************************//**
+  \class CritSec
+  \brief Critical section (recursive mutex).
+
+  The same thread may lock the critical section several times. It must unlock
+  it the same number of times.
+
+  \class AutoLock
+  \brief Locks the critical section for the lifetime of the object.
+
+******************************************************************************/
+
+class CritSec
+{
+protected:
+  // Disallow critical section object copy
+  CritSec(const CritSec &);
+  CritSec &operator=(const CritSec &);
+
+#ifdef _WIN32
+  CRITICAL_SECTION crit_sec;
+#else
+  pthread_mutex_t crit_sec;
+#endif
+  int lock_count;
+
+public:
+  CritSec();
+  ~CritSec();
+
+#ifdef _WIN32
+  inline void lock()   { EnterCriticalSection(&crit_sec); lock_count++; };
+  inline void unlock() { LeaveCriticalSection(&crit_sec); lock_count--; };
+#else
+  inline void lock()   { pthread_mutex_lock(&crit_sec); lock_count++;   };
+  inline void unlock() { lock_count--; pthread_mutex_unlock(&crit_sec); };
+#endif
+};
+
+
+class AutoLock
+{
+protected:
+  // Disallow autolock object copy
+  AutoLock(const AutoLock &);
+  AutoLock &operator=(const AutoLock &);
+
+  CritSec *lock;
+
+public:
+  AutoLock(CritSec *_lock)
+  {
+    lock = _lock;
+    lock->lock();
+  };
+
+  ~AutoLock()
+  {
+    lock->unlock();
+  };
+};
+
+/**************************************************************************//**
+  \class Event
+  \brief Auto-reset event (condition) to wake up a waiting thread.
+
+  \fn void Event::set()
+    Wake up one waiting thread. When nobody waits, the event stays signaled
+    and the next wait() returns immediately.
+
+  \fn bool Event::wait(int timeout_ms = -1)
+    \param timeout_ms Time to wait in milliseconds. Negative value means
+                      infinite wait.
+    \return Returns true when the event was signaled and false on timeout.
+
+    Wait for the event and reset it.
+
+******************************************************************************/
+
+class Event
+{
+protected:
+  // Disallow event object copy
+  Event(const Event &);
+  Event &operator=(const Event &);
+
+#ifdef _WIN32
+  HANDLE event;
+#else
+  pthread_mutex_t mutex;
+  pthread_cond_t  cond;
+  bool signaled;
+#endif
+
+public:
+  Event();
+  ~Event();
+
+  void set();
+  bool wait(int timeout_ms = -1);
+};
+
+/**************************************************************************//**
+  \class AtomicInt
+  \brief Integer (or a flag) shared between threads.
+
+  All operations are atomic and act as full memory barriers. So a value
+  published with set() guarantees that all memory writes done before are
+  visible to the thread that reads the value with get().
+
+  \fn long AtomicInt::get() const
+    Returns the value.
+
+  \fn void AtomicInt::set(long value)
+    Set the value.
+
+  \fn long AtomicInt::increment()
+    Increment the value and return the result.
+
+  \fn long AtomicInt::decrement()
+    Decrement the value and return the result.
+
+  \fn bool AtomicInt::compare_and_set(long old_value, long new_value)
+    Set the value to new_value only if it equals to old_value.
+    Returns true when the value was changed.
+
+******************************************************************************/
+
+class AtomicInt
+{
+protected:
+  // Disallow atomic object copy
+  AtomicInt(const AtomicInt &);
+  AtomicInt &operator=(const AtomicInt &);
+
+#ifdef _WIN32
+  volatile LONG value;
+#else
+  volatile long value;
+#endif
+
+public:
+  AtomicInt(long value_ = 0): value(value_)
+  {}
+
+#ifdef _WIN32
+  inline long get() const { long v = value; MemoryBarrier(); return v; }
+  inline void set(long new_value) { InterlockedExchange(&value, new_value); }
+  inline long increment() { return InterlockedIncrement(&value); }
+  inline long decrement() { return InterlockedDecrement(&value); }
+  inline bool compare_and_set(long old_value, long new_value)
+  { return InterlockedCompareExchange(&value, new_value, old_value) == old_value; }
+#else
+  inline long get() const { long v = value; __sync_synchronize(); return v; }
+  inline void set(long new_value) { __sync_synchronize(); value = new_value; __sync_synchronize(); }
+  inline long increment() { return __sync_add_and_fetch(&value, 1); }
+  inline long decrement() { return __sync_sub_and_fetch(&value, 1); }
+  inline bool compare_and_set(long old_value, long new_value)
+  { return __sync_bool_compare_and_swap(&value, old_value, new_value); }
+#endif
+};
+
+#endif
@@ -55,14 +55,45 @@ vtime_t to_utc(vtime_t _time)
 }
 
 ///////////////////////////////////////////////////////////
-// Time.h implementation
+// POSIX implementation
 
-#elif __GNUC__
+#else
 
-#error "No implementation"
+#include <time.h>
+#include <sys/time.h>
 
-#else
+static long utc_offset(time_t t)
+{
+  tm local;
+  if (!localtime_r(&t, &local))
+    return 0;
+  return local.tm_gmtoff;
+}
+
+vtime_t utc_time()
+{
+  timeval tv;
+  gettimeofday(&tv, 0);
+  return vtime_t(tv.tv_sec) + vtime_t(tv.tv_usec) / 1000000;
+}
 
-#error "No implementations for time functions"
+vtime_t local_time()
+{
+  vtime_t t = utc_time();
+  return t + utc_offset((time_t)t);
+}
+
+vtime_t to_local(vtime_t _time)
+{
+  return _time + utc_offset((time_t)_time);
+}
+
+vtime_t to_utc(vtime_t _time)
+{
+  // Offset is taken for the local time treated as UTC, it may differ from
+  // the correct one near daylight saving time switches.
+  long offset = utc_offset((time_t)_time);
+  return _time - utc_offset((time_t)(_time - offset));
+}
 
 #endif